@@ -17,6 +17,7 @@
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
@@ -71,7 +72,9 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        iox::popo::ChunkDistributor<iox::popo::ClientChunkDistributorData_t>(&sutPort->m_chunkSenderData)
+            .tryAddQueue(&serverChunkQueueData)
+            .expect("Adding the server queue must succeed");
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
@@ -17,6 +17,7 @@
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
@@ -86,7 +87,9 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        iox::popo::ChunkDistributor<iox::popo::ServerChunkDistributorData_t>(&sutPort->m_chunkSenderData)
+            .tryAddQueue(&clientResponseQueueData)
+            .expect("Adding the client queue must succeed");
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
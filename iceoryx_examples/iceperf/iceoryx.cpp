@@ -27,8 +27,20 @@ Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::
 Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
                  const iox::capro::IdString_t& subscriberName,
                  const iox::capro::IdString_t& eventName) noexcept
-    : m_publisher({"IcePerf", publisherName, eventName}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, eventName}, iox::popo::SubscriberOptions{1U, 1U})
+    : Iceoryx(publisherName,
+              subscriberName,
+              eventName,
+              iox::popo::PublisherOptions{1U},
+              iox::popo::SubscriberOptions{1U, 1U})
+{
+}
+Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
+                 const iox::capro::IdString_t& subscriberName,
+                 const iox::capro::IdString_t& eventName,
+                 const iox::popo::PublisherOptions& publisherOptions,
+                 const iox::popo::SubscriberOptions& subscriberOptions) noexcept
+    : m_publisher({"IcePerf", publisherName, eventName}, publisherOptions)
+    , m_subscriber({"IcePerf", subscriberName, eventName}, subscriberOptions)
 {
 }
 
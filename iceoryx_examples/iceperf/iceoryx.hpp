@@ -34,6 +34,11 @@ class Iceoryx : public IcePerfBase
     Iceoryx(const iox::capro::IdString_t& publisherName,
             const iox::capro::IdString_t& subscriberName,
             const iox::capro::IdString_t& eventName) noexcept;
+    Iceoryx(const iox::capro::IdString_t& publisherName,
+            const iox::capro::IdString_t& subscriberName,
+            const iox::capro::IdString_t& eventName,
+            const iox::popo::PublisherOptions& publisherOptions,
+            const iox::popo::SubscriberOptions& subscriberOptions) noexcept;
     virtual void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
@@ -0,0 +1,44 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_blocking.hpp"
+
+IceoryxBlocking::IceoryxBlocking(const iox::capro::IdString_t& publisherName,
+                                 const iox::capro::IdString_t& subscriberName) noexcept
+    : Iceoryx(publisherName,
+              subscriberName,
+              "C++-Blocking-API",
+              blockingPublisherOptions(),
+              blockingSubscriberOptions())
+{
+}
+
+iox::popo::PublisherOptions IceoryxBlocking::blockingPublisherOptions() noexcept
+{
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    options.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    return options;
+}
+
+iox::popo::SubscriberOptions IceoryxBlocking::blockingSubscriberOptions() noexcept
+{
+    iox::popo::SubscriberOptions options;
+    options.queueCapacity = 1U;
+    options.historyRequest = 1U;
+    options.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    return options;
+}
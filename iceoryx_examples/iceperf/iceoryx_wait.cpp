@@ -17,8 +17,13 @@
 #include "iceoryx_wait.hpp"
 
 IceoryxWait::IceoryxWait(const iox::capro::IdString_t& publisherName,
-                         const iox::capro::IdString_t& subscriberName) noexcept
-    : Iceoryx(publisherName, subscriberName, "C++-Wait-API")
+                         const iox::capro::IdString_t& subscriberName,
+                         const iox::units::Duration spinDuration) noexcept
+    : Iceoryx(publisherName,
+              subscriberName,
+              spinDuration == iox::units::Duration::zero() ? iox::capro::IdString_t("C++-Wait-API")
+                                                           : iox::capro::IdString_t("C++-Wait-Spin-API"))
+    , waitset(spinDuration)
 {
 }
 
@@ -21,7 +21,12 @@
 class IceoryxWait : public Iceoryx
 {
   public:
-    IceoryxWait(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    /// @brief the time the WaitSet of the spinning variant polls before it puts the thread to sleep
+    static constexpr iox::units::Duration SPIN_DURATION{iox::units::Duration::fromMicroseconds(100U)};
+
+    IceoryxWait(const iox::capro::IdString_t& publisherName,
+                const iox::capro::IdString_t& subscriberName,
+                const iox::units::Duration spinDuration = iox::units::Duration::zero()) noexcept;
 
   private:
     void init() noexcept override;
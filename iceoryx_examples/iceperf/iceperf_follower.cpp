@@ -17,6 +17,7 @@
 
 #include "iceperf_follower.hpp"
 #include "iceoryx.hpp"
+#include "iceoryx_blocking.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_wait.hpp"
@@ -128,6 +129,20 @@ int IcePerfFollower::run() noexcept
         doMeasurement(iceoryxwait);
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_BLOCKING_API)
+    {
+        std::cout << std::endl << "******  ICEORYX BLOCKING  ********" << std::endl;
+        IceoryxBlocking iceoryxblocking(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxblocking);
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_SPIN_API)
+    {
+        std::cout << std::endl << "****** ICEORYX WAITSET SPIN ******" << std::endl;
+        IceoryxWait iceoryxwaitspin(PUBLISHER, SUBSCRIBER, IceoryxWait::SPIN_DURATION);
+        doMeasurement(iceoryxwaitspin);
+    }
+
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
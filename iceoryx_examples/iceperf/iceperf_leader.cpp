@@ -18,6 +18,7 @@
 
 #include "iceperf_leader.hpp"
 #include "iceoryx.hpp"
+#include "iceoryx_blocking.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
@@ -28,6 +29,8 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <chrono>
+#include <ctime>
 #include <iomanip>
 #include <iostream>
 #include <vector>
@@ -73,7 +76,7 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
         return (std::make_tuple(memorySize, iox::string<2>("B")));
     };
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
+    std::vector<std::tuple<uint32_t, iox::units::Duration, double>> latencyMeasurements;
     const std::vector<uint32_t> payloadSizes{16,
                                              32,
                                              64,
@@ -105,9 +108,18 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
         ipcTechnology.preLatencyPerfTestLeader(payloadSize);
 
+        // the processor time of the leader relative to the wall time shows whether the application sleeps or spins
+        // while it waits for the follower
+        const auto cpuTimeStart = std::clock();
+        const auto wallTimeStart = std::chrono::steady_clock::now();
+
         auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSize, latency));
+        const auto cpuTime = static_cast<double>(std::clock() - cpuTimeStart) / CLOCKS_PER_SEC;
+        const auto wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallTimeStart).count();
+        const auto cpuUsageInPercent = (wallTime > 0.0) ? 100.0 * cpuTime / wallTime : 0.0;
+
+        latencyMeasurements.push_back(std::make_tuple(payloadSize, latency, cpuUsageInPercent));
 
         ipcTechnology.postLatencyPerfTestLeader();
     }
@@ -121,8 +133,8 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
     std::cout << "#### Measurement Result ####" << std::endl;
     std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
     std::cout << std::endl;
-    std::cout << "| Payload Size | Average Latency [µs] |" << std::endl;
-    std::cout << "|-------------:|---------------------:|" << std::endl;
+    std::cout << "| Payload Size | Average Latency [µs] | CPU Usage [%] |" << std::endl;
+    std::cout << "|-------------:|---------------------:|--------------:|" << std::endl;
     for (const auto& latencyMeasuement : latencyMeasurements)
     {
         uint64_t humanReadablePayloadSize{0};
@@ -133,8 +145,9 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
         unitString.append(iox::TruncateToCapacity, memorySizeUnit);
         unitString.append(iox::TruncateToCapacity, "]");
         std::cout << "| " << std::setw(7) << humanReadablePayloadSize << " " << std::setw(4) << std::left << unitString
-                  << std::right << " | " << std::setw(20) << std::setprecision(2) << latencyInMicroseconds << " |"
-                  << std::endl;
+                  << std::right << " | " << std::setw(20) << std::setprecision(2) << latencyInMicroseconds << " | "
+                  << std::setw(13) << std::fixed << std::setprecision(1) << std::get<2>(latencyMeasuement)
+                  << std::defaultfloat << " |" << std::endl;
     }
 
     std::cout << std::endl;
@@ -201,6 +214,20 @@ int IcePerfLeader::run() noexcept
         IceoryxWait iceoryxwait(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxwait);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_BLOCKING_API)
+    {
+        std::cout << std::endl << "******  ICEORYX BLOCKING  ********" << std::endl;
+        IceoryxBlocking iceoryxblocking(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxblocking);
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_SPIN_API)
+    {
+        std::cout << std::endl << "****** ICEORYX WAITSET SPIN ******" << std::endl;
+        IceoryxWait iceoryxwaitspin(PUBLISHER, SUBSCRIBER, IceoryxWait::SPIN_DURATION);
+        doMeasurement(iceoryxwaitspin);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
@@ -54,6 +54,8 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-cpp-waitset-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-waitset-spin-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-blocking-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
@@ -95,6 +97,14 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_CPP_WAIT_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-waitset-spin-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_WAIT_SPIN_API;
+            }
+            else if (strcmp(optarg, "iceoryx-cpp-blocking-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_BLOCKING_API;
+            }
             else if (strcmp(optarg, "iceoryx-c-api") == 0)
             {
                 settings.technology = Technology::ICEORYX_C_API;
@@ -109,8 +119,10 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-waitset-api', "
+                             "'iceoryx-cpp-waitset-spin-api', 'iceoryx-cpp-blocking-api', 'iceoryx-c-api', "
+                             "'posix-message-queue' and "
+                             "'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
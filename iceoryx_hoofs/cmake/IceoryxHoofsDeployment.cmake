@@ -22,6 +22,10 @@ configure_option(
     NAME IOX_MINIMAL_LOG_LEVEL
     DEFAULT_VALUE "Trace"
 )
+configure_option(
+    NAME IOX_LOGGER_BACKEND
+    DEFAULT_VALUE "ConsoleLogger"
+)
 configure_option(
     NAME IOX_MAX_NAMED_PIPE_MESSAGE_SIZE
     DEFAULT_VALUE 4096
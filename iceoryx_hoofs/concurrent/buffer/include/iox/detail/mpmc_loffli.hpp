@@ -93,6 +93,23 @@ class MpmcLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop up to 'count' values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices pointer to a memory with the capacity for at least 'count' indices
+    /// @param [in] count is the maximum number of indices to pop
+    /// @param [out] numberOfOwnedIndices if not nullptr, it is updated after each index which is handed over to the
+    /// caller; when the caller lives in shared memory, this keeps the popped indices trackable even if the process
+    /// terminates during the pop
+    /// @return the number of popped indices which are stored at the beginning of 'indices'
+    uint32_t
+    popN(Index_t* const indices, const uint32_t count, uint32_t* const numberOfOwnedIndices = nullptr) noexcept;
+
+    /// Push previously poped elements with a single compare-and-swap on the head
+    /// @param [in] indices pointer to 'count' previously poped elements
+    /// @param [in] count is the number of indices to push
+    /// @return true if all indices are valid, not yet pushed and unique, false otherwise; in the latter case none of
+    /// the indices is pushed
+    bool pushN(const Index_t* const indices, const uint32_t count) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -111,5 +111,106 @@ bool MpmcLoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t MpmcLoFFLi::popN(Index_t* const indices, const uint32_t count, uint32_t* const numberOfOwnedIndices) noexcept
+{
+    if (count == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        /// the run of free indices is read without synchronization like in 'pop'; if another thread modifies the
+        /// free-list meanwhile, the abaCounter of the head changes and the compare-and-swap fails
+        numberOfIndices = 0U;
+        Index_t index = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < count && index < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides 'count' indices
+            indices[numberOfIndices] = index;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            index = m_nextFreeIndex.get()[index];
+        }
+
+        // we are empty if next points to an element with index of Size
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = index;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices are limited by m_size
+        m_nextFreeIndex.get()[indices[i]] = m_invalidIndex;
+        if (numberOfOwnedIndices != nullptr)
+        {
+            *numberOfOwnedIndices = i + 1U;
+        }
+    }
+
+    /// same synchronization with 'push' and 'pushN' as in 'pop'
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool MpmcLoFFLi::pushN(const Index_t* const indices, const uint32_t count) noexcept
+{
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (count == 0U)
+    {
+        return true;
+    }
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    /// link the indices to a run which is spliced into the free-list with a single compare-and-swap; an index which
+    /// was not acquired in pop or which occurs twice in 'indices' is not marked as invalid anymore and is detected
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices are limited by count and capacity
+        const Index_t index = indices[i];
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                m_nextFreeIndex.get()[indices[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+        m_nextFreeIndex.get()[index] = (i + 1U < count) ? indices[i + 1U] : m_size;
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides 'count' indices
+    const Index_t lastIndex = indices[count - 1U];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
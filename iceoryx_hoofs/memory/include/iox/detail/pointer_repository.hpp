@@ -18,9 +18,12 @@
 #ifndef IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 #define IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 
+#include "iox/atomic.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
+#include <cstdint>
+
 namespace iox
 {
 constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
@@ -30,6 +33,10 @@ constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// The registered segments are additionally kept in an index which is sorted by their start address. 'searchId'
+/// performs a binary search on this index and is therefore lock-free and logarithmic in the number of registered
+/// segments. Readers are synchronized with the registration functions by a sequence counter, the registration
+/// functions themselves must not be called concurrently.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = MAX_POINTER_REPO_CAPACITY>
 class PointerRepository final
 {
@@ -40,6 +47,14 @@ class PointerRepository final
         ptr_t endPtr{nullptr};
     };
 
+    /// @brief entry of the search index; the members are atomics since they are read concurrently to updates
+    struct IndexEntry
+    {
+        concurrent::Atomic<uintptr_t> startAddress{0U};
+        concurrent::Atomic<uintptr_t> endAddress{0U};
+        concurrent::Atomic<id_t> id{0U};
+    };
+
     static constexpr id_t MIN_ID{1U};
     static constexpr id_t MAX_ID{CAPACITY - 1U};
 
@@ -92,7 +107,9 @@ class PointerRepository final
 
     /// @brief returns the id for a given pointer ptr
     /// @param[in] ptr is the pointer whose corresponding id is searched for
-    /// @return the id the pointer was registered to
+    /// @return the id the pointer was registered to, if the pointer is contained in multiple segments the smallest id
+    /// is returned
+    /// @note this method is lock-free and can be called concurrently to the registration methods
     id_t searchId(const ptr_t ptr) const noexcept;
 
   private:
@@ -103,9 +120,22 @@ class PointerRepository final
     /// and each needs to initialize it via register calls above
 
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    IndexEntry m_index[CAPACITY];
+    concurrent::Atomic<uint64_t> m_indexSize{0U};
+    /// @brief odd while the index is modified, readers retry when it changed during their search
+    concurrent::Atomic<uint64_t> m_indexVersion{0U};
+    /// @brief whether segments overlap; only then the search has to look beyond the closest start address
+    concurrent::Atomic<bool> m_hasOverlappingSegments{false};
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+
+    void addToIndex(const id_t id) noexcept;
+    void removeFromIndex(const id_t id) noexcept;
+    void beginIndexUpdate() noexcept;
+    void endIndexUpdate() noexcept;
+    id_t searchIdInIndex(const uintptr_t address) const noexcept;
 };
 } // namespace iox
 
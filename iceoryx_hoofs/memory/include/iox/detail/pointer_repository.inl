@@ -20,6 +20,8 @@
 
 #include "iox/detail/pointer_repository.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -62,6 +64,7 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
     {
         if (m_info[id].basePtr != nullptr)
         {
+            removeFromIndex(id);
             m_info[id].basePtr = nullptr;
 
             /// @note do not search for next lower registered index but we could do it here
@@ -75,11 +78,14 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
+    beginIndexUpdate();
+    m_indexSize.store(0U, std::memory_order_relaxed);
+    endIndexUpdate();
+
     for (auto& info : m_info)
     {
         info.basePtr = nullptr;
     }
-    m_maxRegistered = 0U;
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -100,19 +106,75 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(const ptr_t ptr) const noexcept
 {
-    for (id_t id{1U}; id <= m_maxRegistered; ++id)
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : Used for address comparison, uintptr_t is capable of holding a
+    // void ptr
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+
+    // the index is only modified while the version is odd; if the version changed during the search the result might
+    // be inconsistent and the search is repeated
+    while (true)
     {
-        // return first id where the ptr is in the corresponding interval
-        // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
-        if ((ptr >= m_info[id].basePtr) && (ptr <= m_info[id].endPtr))
+        const auto version = m_indexVersion.load(std::memory_order_acquire);
+        if (version % 2U == 0U)
         {
-            return id;
+            const auto id = searchIdInIndex(address);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_indexVersion.load(std::memory_order_relaxed) == version)
+            {
+                return id;
+            }
+        }
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchIdInIndex(const uintptr_t address) const noexcept
+{
+    // find the first segment which starts behind the address, the segment in front of it is the only candidate
+    // which can contain the address unless segments overlap
+    uint64_t lower{0U};
+    uint64_t upper{m_indexSize.load(std::memory_order_relaxed)};
+    while (lower < upper)
+    {
+        const uint64_t middle{lower + ((upper - lower) / 2U)};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) middle is always smaller than the index size
+        if (m_index[middle].startAddress.load(std::memory_order_relaxed) <= address)
+        {
+            lower = middle + 1U;
+        }
+        else
+        {
+            upper = middle;
         }
     }
+
+    const bool hasOverlappingSegments{m_hasOverlappingSegments.load(std::memory_order_relaxed)};
+    id_t foundId{RAW_POINTER_BEHAVIOUR_ID};
+    for (uint64_t position{lower}; position > 0U; --position)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) position is always in the index range
+        const auto& entry = m_index[position - 1U];
+        if (address <= entry.endAddress.load(std::memory_order_relaxed))
+        {
+            const id_t id{entry.id.load(std::memory_order_relaxed)};
+            if ((foundId == RAW_POINTER_BEHAVIOUR_ID) || (id < foundId))
+            {
+                foundId = id;
+            }
+        }
+
+        if (!hasOverlappingSegments)
+        {
+            break;
+        }
+    }
+
     /// @note treat the pointer as a regular pointer if not found
     /// by setting id to RAW_POINTER_BEHAVIOUR_ID
-    return RAW_POINTER_BEHAVIOUR_ID;
+    return foundId;
 }
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const id_t id,
                                                                            const ptr_t ptr,
@@ -127,15 +189,112 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U));
 
-        if (id > m_maxRegistered)
+        // a segment without a size cannot contain any pointer and is therefore not searchable
+        if ((ptr != nullptr) && (size > 0U))
         {
-            m_maxRegistered = id;
+            addToIndex(id);
         }
         return true;
     }
     return false;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addToIndex(const id_t id) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : Used for address comparison, uintptr_t is capable of holding a
+    // void ptr
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto startAddress = reinterpret_cast<uintptr_t>(m_info[id].basePtr);
+    const auto endAddress = reinterpret_cast<uintptr_t>(m_info[id].endPtr);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    beginIndexUpdate();
+
+    // insertion sort step, all segments starting behind the new one are moved one position back
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index) positions are always in the index range
+    uint64_t position{m_indexSize.load(std::memory_order_relaxed)};
+    while ((position > 0U) && (m_index[position - 1U].startAddress.load(std::memory_order_relaxed) > startAddress))
+    {
+        auto& source = m_index[position - 1U];
+        auto& destination = m_index[position];
+        destination.startAddress.store(source.startAddress.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        destination.endAddress.store(source.endAddress.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        destination.id.store(source.id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        --position;
+    }
+
+    m_index[position].startAddress.store(startAddress, std::memory_order_relaxed);
+    m_index[position].endAddress.store(endAddress, std::memory_order_relaxed);
+    m_index[position].id.store(id, std::memory_order_relaxed);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    m_indexSize.fetch_add(1U, std::memory_order_relaxed);
+
+    endIndexUpdate();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromIndex(const id_t id) noexcept
+{
+    beginIndexUpdate();
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index) positions are always in the index range
+    const uint64_t indexSize{m_indexSize.load(std::memory_order_relaxed)};
+    bool isRemoved{false};
+    for (uint64_t position{0U}; position < indexSize; ++position)
+    {
+        auto& entry = m_index[position];
+        if (isRemoved)
+        {
+            auto& previousEntry = m_index[position - 1U];
+            previousEntry.startAddress.store(entry.startAddress.load(std::memory_order_relaxed),
+                                             std::memory_order_relaxed);
+            previousEntry.endAddress.store(entry.endAddress.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            previousEntry.id.store(entry.id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        else if (entry.id.load(std::memory_order_relaxed) == id)
+        {
+            isRemoved = true;
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    if (isRemoved)
+    {
+        m_indexSize.store(indexSize - 1U, std::memory_order_relaxed);
+    }
+
+    endIndexUpdate();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::beginIndexUpdate() noexcept
+{
+    m_indexVersion.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::endIndexUpdate() noexcept
+{
+    // since the index is sorted by the start address, overlapping segments always show up as neighbours
+    bool hasOverlappingSegments{false};
+    const uint64_t indexSize{m_indexSize.load(std::memory_order_relaxed)};
+    for (uint64_t position{1U}; position < indexSize; ++position)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) position is always in the index range
+        if (m_index[position].startAddress.load(std::memory_order_relaxed)
+            <= m_index[position - 1U].endAddress.load(std::memory_order_relaxed))
+        {
+            hasOverlappingSegments = true;
+            break;
+        }
+    }
+    m_hasOverlappingSegments.store(hasOverlappingSegments, std::memory_order_relaxed);
+
+    m_indexVersion.fetch_add(1U, std::memory_order_release);
+}
+
 } // namespace iox
 
 #endif // IOX_HOOFS_MEMORY_POINTER_REPOSITORY_INL
@@ -38,6 +38,7 @@ enum class PosixSharedMemoryObjectError : uint8_t
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    LOCKING_MEMORY_FAILED,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -78,10 +79,22 @@ class PosixSharedMemoryObject : public FileManagementInterface<PosixSharedMemory
     ///        existing shared memory was opened.
     bool hasOwnership() const noexcept;
 
+    /// @brief Returns the size of the pages the shared memory is mapped with. It is the huge page size
+    ///        only when huge pages were requested and the memory, which was touched on creation,
+    ///        is actually backed by huge pages, otherwise the regular page size.
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief Returns the NUMA node the shared memory is bound to. If no node was requested or the
+    ///        binding failed, nullopt is returned.
+    optional<uint32_t> getNumaNode() const noexcept;
+
     friend class PosixSharedMemoryObjectBuilder;
 
   private:
-    PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory, detail::PosixMemoryMap&& memoryMap) noexcept;
+    PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory,
+                            detail::PosixMemoryMap&& memoryMap,
+                            const uint64_t pageSize,
+                            const optional<uint32_t> numaNode) noexcept;
 
     friend struct FileManagementInterface<PosixSharedMemoryObject>;
     shm_handle_t get_file_handle() const noexcept;
@@ -89,6 +102,8 @@ class PosixSharedMemoryObject : public FileManagementInterface<PosixSharedMemory
   private:
     detail::PosixSharedMemory m_sharedMemory;
     detail::PosixMemoryMap m_memoryMap;
+    uint64_t m_pageSize{0U};
+    optional<uint32_t> m_numaNode;
 };
 
 class PosixSharedMemoryObjectBuilder
@@ -117,6 +132,34 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Advises the operating system to back the shared memory with huge pages to reduce
+    ///        the TLB misses when large segments are accessed. This is only a hint and is ignored
+    ///        with a warning when the platform or the kernel configuration does not support it.
+    IOX_BUILDER_PARAMETER(bool, useHugePages, false)
+
+    /// @brief Locks the shared memory into RAM so that it is never paged out. The creation fails
+    ///        when the memory cannot be locked, e.g. due to RLIMIT_MEMLOCK.
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+    /// @brief Touches every page of the shared memory on creation so that the first access on the
+    ///        data path does not cause a page fault
+    IOX_BUILDER_PARAMETER(bool, prefaultMemory, false)
+
+    /// @brief Defines how many threads zero or prefault the shared memory on creation. Every thread
+    ///        touches a contiguous range of pages first, therefore on NUMA systems the pages are
+    ///        distributed over the nodes of the CPUs the threads are running on. A value of 0 uses
+    ///        one thread per CPU the calling thread is allowed to run on. The value is limited to
+    ///        MAX_INITIALIZATION_THREADS.
+    IOX_BUILDER_PARAMETER(uint32_t, initializationThreads, 1U)
+
+    /// @brief Binds the shared memory to the given NUMA node before it is touched for the first time
+    ///        so that all pages are allocated on this node. When the platform does not support it or
+    ///        the node does not exist, a warning is printed and the memory is not bound.
+    IOX_BUILDER_PARAMETER(optional<uint32_t>, numaNode, nullopt)
+
+  public:
+    static constexpr uint32_t MAX_INITIALIZATION_THREADS{64U};
+
   public:
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
@@ -17,16 +17,24 @@
 
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/pthread.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/attributes.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/signal_handler.hpp"
+#include "iox/vector.hpp"
 
+#include <algorithm>
 #include <bitset>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <mutex>
+#include <thread>
 
 namespace iox
 {
@@ -50,6 +58,85 @@ static void memsetSigbusHandler(int) noexcept
     IOX_DISCARD_RESULT(result);
     _exit(EXIT_FAILURE);
 }
+
+/// @brief Splits the memory into page aligned ranges and applies the operation to every range on a separate thread.
+///        The calling thread processes the first range itself. A SIGBUS raised by any of the threads is delivered to
+///        the process wide signal handler.
+template <typename Operation>
+static void processMemoryInParallel(void* const baseAddress,
+                                    const uint64_t sizeInBytes,
+                                    const uint32_t requestedThreads,
+                                    const Operation& operation) noexcept
+{
+    const uint64_t regularPageSize = pageSize();
+    const uint64_t numberOfPages = (sizeInBytes + regularPageSize - 1U) / regularPageSize;
+
+    // the workers inherit the affinity of the calling thread, hence they are spread over the CPUs it is allowed to
+    // run on; this distributes the first touch of the pages over the NUMA nodes of these CPUs
+    constexpr uint32_t MAX_NUMBER_OF_CPUS{1024U};
+    // NOLINTJUSTIFICATION c array required by the platform call; it is only used in this scope
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint32_t allowedCpus[MAX_NUMBER_OF_CPUS];
+    uint32_t numberOfAllowedCpus{0U};
+    const auto affinityResult =
+        iox_pthread_getaffinity(iox_pthread_self(), &allowedCpus[0], MAX_NUMBER_OF_CPUS, &numberOfAllowedCpus);
+    if (affinityResult != 0)
+    {
+        if (affinityResult != ENOSYS)
+        {
+            IOX_LOG(Warn,
+                    "Unable to acquire the CPUs the initialization threads are allowed to run on; error code "
+                        << affinityResult << ". The threads are not pinned.");
+        }
+        numberOfAllowedCpus = 0U;
+    }
+    const uint64_t availableCpus = (numberOfAllowedCpus > 0U)
+                                       ? numberOfAllowedCpus
+                                       : std::max(1U, std::thread::hardware_concurrency());
+
+    uint64_t numberOfThreads = (requestedThreads == 0U) ? availableCpus : requestedThreads;
+    numberOfThreads = std::min({numberOfThreads,
+                                static_cast<uint64_t>(PosixSharedMemoryObjectBuilder::MAX_INITIALIZATION_THREADS),
+                                std::max(numberOfPages, static_cast<uint64_t>(1U))});
+
+    const uint64_t bytesPerThread = ((numberOfPages + numberOfThreads - 1U) / numberOfThreads) * regularPageSize;
+    auto* memory = static_cast<uint8_t*>(baseAddress);
+    auto processRange = [&](const uint64_t index) {
+        const uint64_t offset = index * bytesPerThread;
+        if (offset < sizeInBytes)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the range is within the mapping
+            operation(memory + offset, std::min(bytesPerThread, sizeInBytes - offset));
+        }
+    };
+
+    vector<std::thread, PosixSharedMemoryObjectBuilder::MAX_INITIALIZATION_THREADS> workers;
+    for (uint64_t i = 1U; i < numberOfThreads; ++i)
+    {
+        workers.emplace_back([&processRange, &allowedCpus, numberOfAllowedCpus, i, numberOfThreads] {
+            // the thread pins itself before it touches the first page
+            if (numberOfAllowedCpus > 0U)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the index is below the count
+                const auto cpu = allowedCpus[(i * numberOfAllowedCpus) / numberOfThreads];
+                const auto result = iox_pthread_setaffinity(iox_pthread_self(), cpu);
+                if (result != 0)
+                {
+                    IOX_LOG(Warn,
+                            "Unable to pin an initialization thread to CPU " << cpu << "; error code " << result);
+                }
+            }
+            processRange(i);
+        });
+    }
+
+    processRange(0U);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
 } // namespace detail
 constexpr const void* const PosixSharedMemoryObject::NO_ADDRESS_HINT;
 
@@ -76,7 +163,9 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                     << m_name << ", sizeInBytes = " << m_memorySizeInBytes
                     << ", access mode = " << asStringLiteral(m_accessMode)
                     << ", open mode = " << asStringLiteral(m_openMode) << ", baseAddressHint = " << logBaseAddressHint
-                    << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]");
+                    << ", permissions = " << iox::log::oct(m_permissions.value()) << ", useHugePages = "
+                    << m_useHugePages << ", lockMemory = " << m_lockMemory << ", prefaultMemory = " << m_prefaultMemory
+                    << ", initializationThreads = " << m_initializationThreads << " ]");
     };
 
     auto sharedMemory = detail::PosixSharedMemoryBuilder()
@@ -130,10 +219,57 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
         return err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    uint64_t pageSize = detail::pageSize();
+    bool isHugePageAdviceAccepted{false};
+    if (m_useHugePages)
+    {
+        // the advice must be given before the memory is touched for the first time, otherwise the pages are
+        // already backed with regular pages
+        auto adviseResult = IOX_POSIX_CALL(iox_shm_advise_huge_pages)(memoryMap->getBaseAddress(),
+                                                                    static_cast<size_t>(realSize))
+                                .failureReturnValue(-1)
+                                .evaluate();
+        const uint64_t hugePageSize = iox_huge_page_size();
+        if (adviseResult.has_error() || hugePageSize == 0U)
+        {
+            IOX_LOG(Warn,
+                    "Huge pages are not available for the shared memory [" << m_name
+                                                                          << "], falling back to regular pages");
+        }
+        else
+        {
+            isHugePageAdviceAccepted = true;
+        }
+    }
+
+    optional<uint32_t> numaNode;
+    if (m_numaNode.has_value())
+    {
+        // like the huge page advice the binding must be applied before the memory is touched for the first time
+        auto bindResult = IOX_POSIX_CALL(iox_shm_bind_to_numa_node)(
+                              memoryMap->getBaseAddress(), static_cast<size_t>(realSize), m_numaNode.value())
+                              .failureReturnValue(-1)
+                              .evaluate();
+        if (bindResult.has_error())
+        {
+            IOX_LOG(Warn,
+                    "Unable to bind the shared memory [" << m_name << "] to the NUMA node " << m_numaNode.value()
+                                                         << " [" << bindResult.error().getHumanReadableErrnum()
+                                                         << "], the memory is not bound to any node");
+        }
+        else
+        {
+            numaNode = m_numaNode;
+        }
+    }
+
+    bool isMemoryTouched{false};
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(Debug, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        // writing zeros to the freshly created memory faults in every page, therefore prefaulting is done this way
+        // for the owner since it cannot alter the content
+        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION || (m_prefaultMemory && m_accessMode == AccessMode::ReadWrite))
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -163,19 +299,82 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, static_cast<size_t>(m_memorySizeInBytes));
+            detail::processMemoryInParallel(memoryMap->getBaseAddress(),
+                                            m_memorySizeInBytes,
+                                            m_initializationThreads,
+                                            [](uint8_t* const memory, const uint64_t sizeInBytes) {
+                                                memset(memory, 0, static_cast<size_t>(sizeInBytes));
+                                            });
+            isMemoryTouched = true;
         }
         IOX_LOG(Debug,
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
     }
 
-    return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
+    if (m_prefaultMemory && !isMemoryTouched)
+    {
+        // reading is sufficient to map the pages and does not alter content which might already be in use
+        detail::processMemoryInParallel(
+            memoryMap->getBaseAddress(),
+            realSize,
+            m_initializationThreads,
+            [](uint8_t* const memory, const uint64_t sizeInBytes) {
+                const volatile uint8_t* pages = memory;
+                const uint64_t regularPageSize = detail::pageSize();
+                for (uint64_t offset = 0U; offset < sizeInBytes; offset += regularPageSize)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) touching every page of the range
+                    IOX_DISCARD_RESULT(pages[offset]);
+                }
+            });
+    }
+
+    // the advice is only a hint, hence the huge page size is only reported when the touched memory is actually
+    // backed by huge pages; memory which is touched later might still be backed by regular pages
+    if (isHugePageAdviceAccepted)
+    {
+        if ((isMemoryTouched || m_prefaultMemory)
+            && iox_shm_is_backed_by_huge_pages(memoryMap->getBaseAddress(), static_cast<size_t>(realSize)) == 1)
+        {
+            pageSize = iox_huge_page_size();
+        }
+        else
+        {
+            IOX_LOG(Debug,
+                    "The shared memory [" << m_name
+                                          << "] is not verified to be backed by huge pages, the regular page size is "
+                                             "reported");
+        }
+    }
+
+    if (m_lockMemory)
+    {
+        auto lockResult =
+            IOX_POSIX_CALL(iox_mlock)(memoryMap->getBaseAddress(), static_cast<size_t>(realSize))
+                .failureReturnValue(-1)
+                .evaluate();
+        if (lockResult.has_error())
+        {
+            printErrorDetails();
+            IOX_LOG(Error,
+                    "Unable to lock the shared memory into RAM ["
+                        << lockResult.error().getHumanReadableErrnum()
+                        << "]. The limit for locked memory might be too low (see RLIMIT_MEMLOCK).");
+            return err(PosixSharedMemoryObjectError::LOCKING_MEMORY_FAILED);
+        }
+    }
+
+    return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap), pageSize, numaNode));
 }
 
 PosixSharedMemoryObject::PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory,
-                                                 detail::PosixMemoryMap&& memoryMap) noexcept
+                                                 detail::PosixMemoryMap&& memoryMap,
+                                                 const uint64_t pageSize,
+                                                 const optional<uint32_t> numaNode) noexcept
     : m_sharedMemory(std::move(sharedMemory))
     , m_memoryMap(std::move(memoryMap))
+    , m_pageSize(pageSize)
+    , m_numaNode(numaNode)
 {
 }
 
@@ -189,6 +388,16 @@ void* PosixSharedMemoryObject::getBaseAddress() noexcept
     return m_memoryMap.getBaseAddress();
 }
 
+uint64_t PosixSharedMemoryObject::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+optional<uint32_t> PosixSharedMemoryObject::getNumaNode() const noexcept
+{
+    return m_numaNode;
+}
+
 shm_handle_t PosixSharedMemoryObject::get_file_handle() const noexcept
 {
     return m_sharedMemory.getHandle();
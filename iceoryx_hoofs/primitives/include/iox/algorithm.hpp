@@ -24,6 +24,10 @@
 #include <cstdint>
 #include <limits>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace iox
 {
 namespace algorithm
@@ -236,6 +240,21 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Returns the index of the least significant set bit of an unsigned integer
+/// @param[in] value must not be zero
+/// @return the index of the lowest set bit, the least significant bit has the index zero
+inline uint64_t indexOfLowestSetBit(const uint64_t value) noexcept
+{
+    IOX_ASSERT(value != 0U, "The index of the lowest set bit is undefined for zero!");
+#if defined(_MSC_VER)
+    unsigned long index{0U};
+    _BitScanForward64(&index, value);
+    return index;
+#else
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#endif
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_INL
+#define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_INL
+
+#include "iox/log/building_blocks/binary_log_format.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+// AXIVION DISABLE STYLE AutosarC++19_03-A3.9.1 : Basic numeric types are used in order to map all the types for which a
+// format string exists
+template <>
+struct BinaryLogValueTypeOf<char>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Char};
+};
+template <>
+struct BinaryLogValueTypeOf<signed char>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::SignedChar};
+};
+template <>
+struct BinaryLogValueTypeOf<unsigned char>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::UnsignedChar};
+};
+template <>
+struct BinaryLogValueTypeOf<short>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Short};
+};
+template <>
+struct BinaryLogValueTypeOf<unsigned short>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::UnsignedShort};
+};
+template <>
+struct BinaryLogValueTypeOf<int>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Int};
+};
+template <>
+struct BinaryLogValueTypeOf<unsigned int>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::UnsignedInt};
+};
+template <>
+struct BinaryLogValueTypeOf<long>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Long};
+};
+template <>
+struct BinaryLogValueTypeOf<unsigned long>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::UnsignedLong};
+};
+template <>
+struct BinaryLogValueTypeOf<long long>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::LongLong};
+};
+template <>
+struct BinaryLogValueTypeOf<unsigned long long>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::UnsignedLongLong};
+};
+template <>
+struct BinaryLogValueTypeOf<float>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Float};
+};
+template <>
+struct BinaryLogValueTypeOf<double>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Double};
+};
+template <>
+struct BinaryLogValueTypeOf<long double>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::LongDouble};
+};
+template <typename T>
+struct BinaryLogValueTypeOf<T*>
+{
+    static constexpr BinaryLogValueType VALUE{BinaryLogValueType::Pointer};
+};
+// AXIVION ENABLE STYLE AutosarC++19_03-A3.9.1
+
+constexpr uint64_t alignedBinaryLogRecordSize(const uint64_t recordSize) noexcept
+{
+    return ((recordSize + BINARY_LOG_RECORD_ALIGNMENT - 1U) / BINARY_LOG_RECORD_ALIGNMENT)
+           * BINARY_LOG_RECORD_ALIGNMENT;
+}
+
+template <typename Callable>
+inline void forEachBinaryLogRecord(const char* records, const uint64_t recordsEnd, const Callable& callable) noexcept
+{
+    uint64_t offset{0U};
+    while (offset + sizeof(BinaryLogRecordHeader) <= recordsEnd)
+    {
+        BinaryLogRecordHeader header{};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the offset is within the records
+        std::memcpy(&header, records + offset, sizeof(header));
+        if (header.size == 0U)
+        {
+            // the writer was interrupted before it wrote the header of its record; the reserved space is zero filled
+            // and the next record starts at the next aligned position with a non-zero size
+            offset += BINARY_LOG_RECORD_ALIGNMENT;
+            continue;
+        }
+        if (header.size < sizeof(BinaryLogRecordHeader) || offset + header.size > recordsEnd)
+        {
+            return;
+        }
+
+        if (header.type != BinaryLogRecordType::Incomplete)
+        {
+            constexpr uint64_t HEADER_SIZE{sizeof(BinaryLogRecordHeader)};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the record is within the records
+            callable(header, records + offset + HEADER_SIZE, header.size - HEADER_SIZE);
+        }
+        offset += alignedBinaryLogRecordSize(header.size);
+    }
+}
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_INL
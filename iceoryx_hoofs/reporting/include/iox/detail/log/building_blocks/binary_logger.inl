@@ -0,0 +1,88 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_INL
+#define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_INL
+
+#include "iox/log/building_blocks/binary_logger.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+inline void BinaryLogger::logChar(const char value) noexcept
+{
+    appendArgument(BinaryLogArgumentType::Char, &value, sizeof(value));
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+inline void BinaryLogger::logBool(const bool value) noexcept
+{
+    const uint8_t byte{value ? static_cast<uint8_t>(1U) : static_cast<uint8_t>(0U)};
+    appendArgument(BinaryLogArgumentType::Bool, &byte, sizeof(byte));
+}
+
+template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value, bool>>
+inline void BinaryLogger::logDec(const T value) noexcept
+{
+    logValue(BinaryLogArgumentType::Dec, value);
+}
+
+template <typename T,
+          typename std::enable_if_t<(std::is_integral<T>::value && std::is_unsigned<T>::value)
+                                        || std::is_floating_point<T>::value || std::is_pointer<T>::value,
+                                    bool>>
+inline void BinaryLogger::logHex(const T value) noexcept
+{
+    logValue(BinaryLogArgumentType::Hex, value);
+}
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool>>
+inline void BinaryLogger::logOct(const T value) noexcept
+{
+    logValue(BinaryLogArgumentType::Oct, value);
+}
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool>>
+inline void BinaryLogger::logBin(const T value) noexcept
+{
+    logValue(BinaryLogArgumentType::Bin, value);
+}
+
+template <typename T>
+inline void BinaryLogger::logValue(const BinaryLogArgumentType argumentType, const T value) noexcept
+{
+    constexpr uint32_t VALUE_TYPE_SIZE{1U};
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as raw memory
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char data[VALUE_TYPE_SIZE + sizeof(T)];
+    data[0] = static_cast<char>(BinaryLogValueTypeOf<T>::VALUE);
+    std::memcpy(&data[VALUE_TYPE_SIZE], &value, sizeof(T));
+    appendArgument(argumentType, &data[0], sizeof(data));
+}
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_INL
@@ -100,6 +100,32 @@ inline void report(const SourceLocation& location, Kind, const Error& error, con
     h.onReportError(ErrorDescriptor(location, code, module));
 }
 
+// Report a non-fatal error with a rate limited log output, e.g. on hot paths.
+// The handler is informed about each error, only the logging is coalesced.
+template <class Kind, class Error>
+inline void reportRateLimited(const SourceLocation& location, Kind, const Error& error, log::RateLimiter& rateLimiter)
+{
+    auto code = toCode(error);
+    auto module = toModule(error);
+
+    uint64_t numberOfSuppressedReports{0U};
+    if (rateLimiter.tryEmit(numberOfSuppressedReports))
+    {
+        auto moduleName = toModuleName(error);
+        auto errorName = toErrorName(error);
+
+        IOX_ERROR_INTERNAL_LOG(location,
+                               "[" << errorName << " (code = " << code.value << ")] in module [" << moduleName
+                                   << " (id = " << module.value << ")]" <<
+                                   [numberOfSuppressedReports](auto& stream) -> auto& {
+                                       return log::internal::logSuppressedOccurrences(stream,
+                                                                                      numberOfSuppressedReports);
+                                   });
+    }
+    auto& h = ErrorHandler::get();
+    h.onReportError(ErrorDescriptor(location, code, module));
+}
+
 // Report any error, specialization for specific types overrides the general version.
 // Any behaviour for specific error types (and kinds) has to be defined like this.
 //
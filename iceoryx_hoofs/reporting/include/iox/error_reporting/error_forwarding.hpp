@@ -19,6 +19,7 @@
 
 #include "iox/error_reporting/error_kind.hpp"
 #include "iox/error_reporting/source_location.hpp"
+#include "iox/log/rate_limiter.hpp"
 
 // to establish connection to the custom implementation
 #include "iox/error_reporting/custom/error_reporting.hpp"
@@ -76,6 +77,23 @@ forwardNonFatalError(Error&& error, Kind&& kind, const SourceLocation& location,
     report(location, std::forward<Kind>(kind), std::forward<Error>(error), stringifiedCondition);
 }
 
+/// @brief Forwards a non-fatal error whose log output is rate limited.
+/// @param error the error
+/// @param kind the kind of error (category)
+/// @param location the location of the error
+/// @param rateLimiter the rate limiter of the call site
+template <typename Error, typename Kind>
+inline void forwardNonFatalErrorRateLimited(Error&& error,
+                                            Kind&& kind,
+                                            const SourceLocation& location,
+                                            log::RateLimiter& rateLimiter)
+{
+    using K = typename std::remove_const<typename std::remove_reference<Kind>::type>::type;
+    static_assert(!IsFatal<K>::value, "Must forward a non-fatal error!");
+
+    reportRateLimited(location, std::forward<Kind>(kind), std::forward<Error>(error), rateLimiter);
+}
+
 /// @brief Forwards a fatal error and a message and does not return.
 /// @param error the error
 /// @param kind the kind of error (category)
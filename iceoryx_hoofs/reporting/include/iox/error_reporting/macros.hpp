@@ -43,6 +43,22 @@
 #define IOX_REPORT(error, kind)                                                                                        \
     iox::er::forwardNonFatalError(iox::er::toError(error), kind, IOX_CURRENT_SOURCE_LOCATION, "")
 
+/// @brief report error of some non-fatal kind on a hot path; the error handler is informed about each error but the
+/// error is logged at most once per interval together with the number of suppressed logs of this call site
+/// @param error error object (or code)
+/// @param kind kind of error, must be non-fatal
+/// @param interval_ms minimal time in milliseconds between two logs of the error; must be a constant expression
+#define IOX_REPORT_RATE_LIMITED(error, kind, interval_ms)                                                              \
+    iox::er::forwardNonFatalErrorRateLimited(                                                                          \
+        iox::er::toError(error),                                                                                       \
+        kind,                                                                                                          \
+        IOX_CURRENT_SOURCE_LOCATION,                                                                                   \
+        [](const char* function) -> iox::log::RateLimiter& {                                                           \
+            static iox::log::RateLimiter rateLimiter{                                                                  \
+                interval_ms, __FILE__, __LINE__, function, iox::log::LogLevel::Error};                                 \
+            return rateLimiter;                                                                                        \
+        }(static_cast<const char*>(__FUNCTION__)))
+
 /// @brief report fatal error
 /// @param error error object (or code)
 #define IOX_REPORT_FATAL(error)                                                                                        \
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+#define IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+
+#include "iceoryx_platform/semaphore.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/atomic.hpp"
+#include "iox/log/logger.hpp"
+
+#include <cstdint>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief A logger which moves the expensive parts of logging off the logging thread. The logging thread only takes
+/// the timestamp, formats the arguments of the message into its thread local buffer and copies the message into a
+/// lock-free ring buffer which is owned by this thread. A background thread converts the timestamp into the local
+/// time, creates the message header and writes the message to the console. When the ring buffer of a thread is full,
+/// the message is dropped and counted instead of blocking the thread; the background thread reports the number of
+/// dropped messages. The background thread sleeps on a semaphore while all ring buffers are empty and is woken up by
+/// the logging thread whose ring buffer becomes non-empty.
+/// @code
+/// int main()
+/// {
+///     static iox::log::AsyncLogger asyncLogger;
+///     iox::log::Logger::setActiveLogger(asyncLogger);
+///     iox::log::Logger::init();
+///
+///     IOX_LOG(Info, "Hello from the async logger");
+/// }
+/// @endcode
+/// @note Only one instance of the logger must exist at a time since all instances share the ring buffers
+class AsyncLogger : public Logger
+{
+  public:
+    /// @brief The maximum number of threads which can log at the same time; messages from additional threads are
+    /// dropped
+    static constexpr uint32_t MAX_NUMBER_OF_THREADS{16U};
+    /// @brief The number of messages which can be queued by a single thread
+    static constexpr uint32_t RING_BUFFER_CAPACITY{64U};
+
+    /// @brief Creates the logger and starts the background thread
+    AsyncLogger() noexcept;
+
+    /// @brief Writes all queued messages and stops the background thread
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    /// @brief The number of messages which were dropped since the ring buffer of the logging thread was full or no
+    /// ring buffer was available for the logging thread
+    /// @return the number of dropped messages since the creation of the logger
+    uint64_t getNumberOfDroppedMessages() const noexcept;
+
+  protected:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+    void createLogMessageHeader(const char* file, const int line, const char* function, LogLevel logLevel) noexcept
+        override;
+
+    void flush() noexcept override;
+
+    /// @brief Writes a formatted log message to the console; this is called from the background thread only
+    /// @param[in] message is the log message including the header and the line ending
+    /// @param[in] size is the size of the message
+    /// @note Derived classes which override this method must call 'stop' in their destructor
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    virtual void writeMessage(const char* message, const uint64_t size) noexcept;
+
+    /// @brief Writes all queued messages and stops the background thread; subsequent calls have no effect
+    void stop() noexcept;
+
+  private:
+    struct Message
+    {
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::Off};
+        uint32_t size{0U};
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char payload[MAX_LOG_MESSAGE_SIZE];
+    };
+
+    /// @brief single producer single consumer ring buffer which is owned by one logging thread at a time
+    struct RingBuffer
+    {
+        concurrent::Atomic<bool> isInUse{false};
+        concurrent::Atomic<bool> isOrphaned{false};
+        concurrent::Atomic<uint64_t> writeIndex{0U};
+        concurrent::Atomic<uint64_t> readIndex{0U};
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        Message messages[RING_BUFFER_CAPACITY];
+    };
+
+    struct ThreadLocalData
+    {
+        ThreadLocalData() noexcept = default;
+        ~ThreadLocalData();
+
+        ThreadLocalData(const ThreadLocalData&) = delete;
+        ThreadLocalData(ThreadLocalData&&) = delete;
+
+        ThreadLocalData& operator=(const ThreadLocalData&) = delete;
+        ThreadLocalData& operator=(ThreadLocalData&&) = delete;
+
+        RingBuffer* ringBuffer{nullptr};
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::Off};
+    };
+
+    static ThreadLocalData& getThreadLocalData() noexcept;
+
+    /// @brief the ring buffers are not owned by the logger to keep them valid for the thread local data of threads
+    /// which exit after the logger was destroyed
+    /// @return the pool of ring buffers
+    static RingBuffer* ringBuffers() noexcept;
+    static RingBuffer* acquireRingBuffer() noexcept;
+
+    void run() noexcept;
+    void wakeUpBackgroundThread() noexcept;
+    void waitForQueuedMessages() noexcept;
+    bool writeQueuedMessages() noexcept;
+    void writeQueuedMessage(const Message& message) noexcept;
+    void reportDroppedMessages() noexcept;
+
+  private:
+    concurrent::Atomic<uint64_t> m_numberOfDroppedMessages{0U};
+    uint64_t m_numberOfReportedDroppedMessages{0U};
+    concurrent::Atomic<bool> m_keepRunning{true};
+    iox_sem_t m_wakeUpSemaphore{};
+    std::thread m_backgroundThread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
@@ -0,0 +1,152 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_HPP
+#define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace log
+{
+/// @brief The layout of a binary log file is a 'BinaryLogFileHeader' followed by the records. Each record starts with
+/// a 'BinaryLogRecordHeader' and is aligned to 'BINARY_LOG_RECORD_ALIGNMENT'. The payload of a message record is a
+/// sequence of arguments, each starting with a 'BinaryLogArgumentType' tag:
+///   - String, Raw: uint32_t size followed by the bytes
+///   - RawNullptr: uint64_t size
+///   - Char, Bool: one byte
+///   - Dec, Hex, Oct, Bin: 'BinaryLogValueType' followed by the bytes of the value
+/// The payload of a file name record is the file name without null-termination. The values are stored in the native
+/// byte order, i.e. the file must be decoded on the same architecture it was written on.
+/// A writer stores a header with the record size and the 'Incomplete' type directly after it reserved the space for
+/// the record and completes the header after the payload was written. A record of a writer which was interrupted
+/// therefore is either still zero filled or has the 'Incomplete' type; both are skipped when the records are read.
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr char BINARY_LOG_MAGIC[8]{"IOXBLOG"};
+constexpr uint32_t BINARY_LOG_VERSION{1U};
+constexpr uint32_t BINARY_LOG_RECORD_ALIGNMENT{8U};
+constexpr uint32_t BINARY_LOG_INVALID_FILE_ID{0xFFFFFFFFU};
+
+enum class BinaryLogRecordType : uint8_t
+{
+    Incomplete = 0,
+    Message = 1,
+    FileName = 2,
+};
+
+enum class BinaryLogArgumentType : uint8_t
+{
+    String = 1,
+    Char,
+    Bool,
+    Dec,
+    Hex,
+    Oct,
+    Bin,
+    Raw,
+    RawNullptr,
+};
+
+enum class BinaryLogValueType : uint8_t
+{
+    Char = 1,
+    SignedChar,
+    UnsignedChar,
+    Short,
+    UnsignedShort,
+    Int,
+    UnsignedInt,
+    Long,
+    UnsignedLong,
+    LongLong,
+    UnsignedLongLong,
+    Float,
+    Double,
+    LongDouble,
+    Pointer,
+};
+
+/// @brief Maps the type of a logged value to its tag in the binary log format
+template <typename T>
+struct BinaryLogValueTypeOf;
+
+struct BinaryLogFileHeader
+{
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char magic[8];
+    uint32_t version;
+    uint32_t recordAlignment;
+    /// @brief the number of bytes available for records after the file header
+    uint64_t capacity;
+    /// @brief the end of the records relative to the end of the file header; can exceed the capacity when records were
+    /// dropped
+    concurrent::Atomic<uint64_t> writeOffset;
+    concurrent::Atomic<uint64_t> numberOfDroppedRecords;
+};
+
+struct BinaryLogRecordHeader
+{
+    /// @brief the size of the record including the header but without the alignment padding
+    uint32_t size;
+    BinaryLogRecordType type;
+    LogLevel logLevel;
+    uint16_t reserved;
+    uint32_t fileId;
+    uint32_t line;
+    int64_t seconds;
+    int64_t nanoseconds;
+};
+
+/// @brief The space a record occupies in the log file
+/// @param[in] recordSize is the size of the record including the header
+/// @return the record size rounded up to 'BINARY_LOG_RECORD_ALIGNMENT'
+constexpr uint64_t alignedBinaryLogRecordSize(const uint64_t recordSize) noexcept;
+
+/// @brief Calls the callable with the header, the payload and the payload size of each complete record; records which
+/// were not completely written, e.g. since the writing process was terminated, are skipped
+/// @param[in] records points to the first record, i.e. directly after the 'BinaryLogFileHeader'
+/// @param[in] recordsEnd is the end of the records relative to 'records'
+/// @param[in] callable is called for each complete record
+template <typename Callable>
+void forEachBinaryLogRecord(const char* records, const uint64_t recordsEnd, const Callable& callable) noexcept;
+
+/// @brief Converts the arguments of a binary log message record into the text the ConsoleLogger would create for the
+/// same arguments
+/// @param[in] arguments is the payload of the message record
+/// @param[in] size is the size of the payload
+/// @param[out] buffer is the buffer the null-terminated text is written to; the text is truncated if the buffer is too
+/// small
+/// @param[in] bufferSize is the size of the buffer including the null-termination
+/// @return the length of the text without the null-termination
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+uint32_t decodeBinaryLogArguments(const char* arguments,
+                                  const uint64_t size,
+                                  char* buffer,
+                                  const uint32_t bufferSize) noexcept;
+
+} // namespace log
+} // namespace iox
+
+#include "iox/detail/log/building_blocks/binary_log_format.inl"
+
+#endif // IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOG_FORMAT_HPP
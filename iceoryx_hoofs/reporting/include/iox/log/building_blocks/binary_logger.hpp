@@ -0,0 +1,204 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_HPP
+#define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_types.hpp"
+#include "iox/log/building_blocks/binary_log_format.hpp"
+#include "iox/log/building_blocks/logformat.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace log
+{
+/// @brief A logger implementation which writes the log messages as compact binary records to a memory mapped file.
+/// The arguments of a message are stored as raw bytes and are only converted to text when the file is decoded with
+/// the 'iox-log-decoder' tool. The logger is selected at compile time with the 'IOX_LOGGER_BACKEND' cmake option since
+/// the argument formatting of the 'LogStream' is not virtual.
+/// @note If no log file is opened, the messages are converted to text and written to the console
+class BinaryLogger
+{
+  public:
+    /// @brief The size of the log file which is created by 'initLogger'
+    static constexpr uint64_t LOG_FILE_SIZE{64ULL * 1024ULL * 1024ULL};
+    /// @brief The number of distinct source files which can be referenced by the records; the location of messages
+    /// from additional source files is not stored
+    static constexpr uint32_t MAX_NUMBER_OF_FILES{1024U};
+
+    /// @brief Obtain the current log level
+    /// @return the current log level
+    static LogLevel getLogLevel() noexcept;
+
+    /// @brief Sets a new log level
+    /// @param[in] logLevel to be used after the call
+    static void setLogLevel(const LogLevel logLevel) noexcept;
+
+    /// @brief The number of records which were dropped since the log file was full
+    /// @return the number of dropped records of the currently opened log file
+    uint64_t getNumberOfDroppedRecords() const noexcept;
+
+    virtual ~BinaryLogger();
+
+    BinaryLogger(const BinaryLogger&) = delete;
+    BinaryLogger(BinaryLogger&&) = delete;
+
+    BinaryLogger& operator=(const BinaryLogger&) = delete;
+    BinaryLogger& operator=(BinaryLogger&&) = delete;
+
+  protected:
+    /// @brief The maximum size of the arguments of a log message
+    static constexpr uint32_t MAX_LOG_MESSAGE_SIZE{1024};
+
+    BinaryLogger() noexcept = default;
+
+    /// @brief Opens the log file which is specified with the 'IOX_BINARY_LOG_FILE' environment variable
+    virtual void initLogger(const LogLevel) noexcept;
+
+    /// @brief Creates or truncates a log file and maps it into the address space; the records of the current log file
+    /// are kept when this fails. The current log file is unmapped once all threads which are writing to it are done;
+    /// messages which are flushed while the log file is replaced are written to the console
+    /// @param[in] path is the path to the log file
+    /// @param[in] fileSize is the size of the log file including the file header
+    /// @return true if the log file was opened, false otherwise
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    bool openLogFile(const char* path, const uint64_t fileSize) noexcept;
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+    virtual void
+    createLogMessageHeader(const char* file, const int line, const char* function, LogLevel logLevel) noexcept;
+
+    virtual void flush() noexcept;
+
+    /// @brief Converts the current log message to the text the ConsoleLogger would create
+    /// @return the text of the log message; the message header is only contained until 'assumeFlushed' is called
+    LogBuffer getLogBuffer() const noexcept;
+
+    void assumeFlushed() noexcept;
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    void logString(const char* message) noexcept;
+
+    void logChar(const char value) noexcept;
+
+    void logBool(const bool value) noexcept;
+
+    template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value, bool> = 0>
+    void logDec(const T value) noexcept;
+
+    template <typename T,
+              typename std::enable_if_t<(std::is_integral<T>::value && std::is_unsigned<T>::value)
+                                            || std::is_floating_point<T>::value || std::is_pointer<T>::value,
+                                        bool> = 0>
+    void logHex(const T value) noexcept;
+
+    template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool> = 0>
+    void logOct(const T value) noexcept;
+
+    template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool> = 0>
+    void logBin(const T value) noexcept;
+
+    void logRaw(const void* const data, const uint64_t size) noexcept;
+
+  private:
+    template <typename T>
+    static void logValue(const BinaryLogArgumentType argumentType, const T value) noexcept;
+
+    /// @brief Appends the argument tag and the data to the arguments of the current log message
+    /// @return false if the arguments would exceed MAX_LOG_MESSAGE_SIZE; nothing is appended in this case
+    static bool
+    appendArgument(const BinaryLogArgumentType argumentType, const void* data, const uint32_t size) noexcept;
+
+    /// @brief Appends the argument tag, the size and the data to the arguments of the current log message; the data is
+    /// truncated if the arguments would exceed MAX_LOG_MESSAGE_SIZE
+    static void
+    appendSizedArgument(const BinaryLogArgumentType argumentType, const void* data, const uint64_t size) noexcept;
+
+    /// @brief Reserves the space for a record in the log file and writes it
+    /// @return false if the record was dropped since the log file is full, true otherwise
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    static bool appendRecord(BinaryLogFileHeader& logFile,
+                             const BinaryLogRecordHeader& header,
+                             const char* payload,
+                             const uint32_t payloadSize) noexcept;
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    uint32_t fileIdOf(BinaryLogFileHeader& logFile, const char* file) noexcept;
+
+    void closeLogFile() noexcept;
+
+    /// @brief Announces a thread which accesses the log file; the log file is not unmapped until 'releaseLogFile' is
+    /// called
+    /// @return the log file or nullptr if no log file is opened; 'releaseLogFile' must be called in both cases
+    BinaryLogFileHeader* acquireLogFile() const noexcept;
+    void releaseLogFile() const noexcept;
+
+    /// @brief Removes the log file from the logger and waits until no thread accesses it anymore
+    /// @return the removed log file or nullptr if no log file was opened
+    BinaryLogFileHeader* detachLogFile() noexcept;
+
+    struct ThreadLocalData final
+    {
+        ThreadLocalData() noexcept = default;
+        ~ThreadLocalData() = default;
+
+        ThreadLocalData(const ThreadLocalData&) = delete;
+        ThreadLocalData(ThreadLocalData&&) = delete;
+
+        ThreadLocalData& operator=(const ThreadLocalData&) = delete;
+        ThreadLocalData& operator=(ThreadLocalData&&) = delete;
+
+        static constexpr uint32_t NULL_TERMINATED_TEXT_SIZE{MAX_LOG_MESSAGE_SIZE + 1};
+
+        BinaryLogRecordHeader header{};
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+        const char* file{nullptr};
+        bool hasHeader{false};
+        uint32_t argumentsSize{0U};
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as raw memory
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char arguments[MAX_LOG_MESSAGE_SIZE];
+        /// @brief the log message converted to text; only used by 'getLogBuffer' and the console fallback
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char text[NULL_TERMINATED_TEXT_SIZE];
+    };
+
+    static ThreadLocalData& getThreadLocalData() noexcept;
+
+  private:
+    // NOLINTJUSTIFICATION needed for the functionality and a private member of the class
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static concurrent::Atomic<LogLevel> s_activeLogLevel; // initialized in corresponding cpp file
+
+    concurrent::Atomic<BinaryLogFileHeader*> m_logFile{nullptr};
+    uint64_t m_logFileSize{0U};
+    mutable concurrent::Atomic<uint64_t> m_numberOfLogFileAccesses{0U};
+    /// @brief the '__FILE__' pointers of the source files which already have a file name record; the index is the id
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    concurrent::Atomic<const char*> m_fileNames[MAX_NUMBER_OF_FILES]{};
+};
+
+} // namespace log
+} // namespace iox
+
+#include "iox/detail/log/building_blocks/binary_logger.inl"
+
+#endif // IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_BINARY_LOGGER_HPP
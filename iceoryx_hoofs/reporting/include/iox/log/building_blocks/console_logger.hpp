@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_CONSOLE_LOGGER_HPP
 #define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_CONSOLE_LOGGER_HPP
 
+#include "iceoryx_platform/time.hpp"
 #include "iox/atomic.hpp"
 #include "iox/iceoryx_hoofs_types.hpp"
 #include "iox/log/building_blocks/logformat.hpp"
@@ -45,6 +46,18 @@ class ConsoleLogger
     /// @param[in] logLevel to be used after the call
     static void setLogLevel(const LogLevel logLevel) noexcept;
 
+    /// @brief Writes the header of a log message with the local time of the timestamp and the log level to a buffer
+    /// @param[in] timestamp is the point in time at which the log message was created
+    /// @param[in] logLevel is the log level of the log message
+    /// @param[out] buffer is the buffer the null-terminated header is written to
+    /// @param[in] bufferSize is the size of the buffer including the null-termination
+    /// @return the length of the header without the null-termination
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    static uint32_t formatLogMessageHeader(const timespec& timestamp,
+                                           const LogLevel logLevel,
+                                           char* buffer,
+                                           const uint32_t bufferSize) noexcept;
+
     virtual ~ConsoleLogger() = default;
 
     ConsoleLogger(const ConsoleLogger&) = delete;
@@ -54,6 +67,9 @@ class ConsoleLogger
     ConsoleLogger& operator=(ConsoleLogger&&) = delete;
 
   protected:
+    /// @brief The maximum size of a log message including its header but without the null-termination
+    static constexpr uint32_t MAX_LOG_MESSAGE_SIZE{1024};
+
     ConsoleLogger() noexcept = default;
 
     virtual void initLogger(const LogLevel) noexcept;
@@ -121,7 +137,7 @@ class ConsoleLogger
         ThreadLocalData& operator=(ThreadLocalData&&) = delete;
 
         /// @todo iox-#1755 this could be made a compile time option
-        static constexpr uint32_t BUFFER_SIZE{1024};
+        static constexpr uint32_t BUFFER_SIZE{MAX_LOG_MESSAGE_SIZE};
         static constexpr uint32_t NULL_TERMINATED_BUFFER_SIZE{BUFFER_SIZE + 1};
 
         // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
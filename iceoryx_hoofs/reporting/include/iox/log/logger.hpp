@@ -29,6 +29,7 @@
 #define IOX_HOOFS_REPORTING_LOG_LOGGER_HPP
 
 #include "iox/iceoryx_hoofs_deployment.hpp"
+#include "iox/log/building_blocks/binary_logger.hpp"
 #include "iox/log/building_blocks/console_logger.hpp"
 #include "iox/log/building_blocks/logger.hpp"
 
@@ -36,8 +37,8 @@ namespace iox
 {
 namespace log
 {
-using Logger = internal::Logger<ConsoleLogger>;
-using TestingLoggerBase = internal::Logger<ConsoleLogger>;
+using Logger = internal::Logger<build::LoggerBackend>;
+using TestingLoggerBase = internal::Logger<build::LoggerBackend>;
 
 /// @todo iox-#1755 make this a option a cmake argument and use via a compile define
 /// @brief If set to true, the IOX_LOG macro will ignore the the configured log level and forward all messages to the
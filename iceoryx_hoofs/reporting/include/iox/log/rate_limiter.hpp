@@ -0,0 +1,117 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_RATE_LIMITER_HPP
+#define IOX_HOOFS_REPORTING_LOG_RATE_LIMITER_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace log
+{
+/// @brief Coalesces frequent occurrences of an event, e.g. a log message or an error report on a hot path. The first
+/// occurrence within an interval is emitted, all further occurrences within the interval are only counted. The next
+/// emitted occurrence carries the number of occurrences which were suppressed in the meantime.
+/// When the rate limiter is created with a source location, the suppressed occurrences are also logged by
+/// 'flushSuppressedOccurrences' once the interval elapsed without a further occurrence.
+/// @note The rate limiter is lock-free and is usually a function local static object, see 'IOX_LOG_RATE_LIMITED' and
+/// 'IOX_REPORT_RATE_LIMITED'
+class RateLimiter
+{
+  public:
+    /// @brief Creates a rate limiter
+    /// @param[in] intervalInMilliseconds is the minimal time between two emitted occurrences
+    explicit constexpr RateLimiter(const uint64_t intervalInMilliseconds) noexcept
+        : m_intervalInNanoseconds(intervalInMilliseconds * NANOSECONDS_PER_MILLISECOND)
+    {
+    }
+
+    /// @brief Creates a rate limiter whose suppressed occurrences are logged by 'flushSuppressedOccurrences'
+    /// @param[in] intervalInMilliseconds is the minimal time between two emitted occurrences
+    /// @param[in] file is the source file of the call site
+    /// @param[in] line is the line of the call site
+    /// @param[in] function is the function of the call site
+    /// @param[in] logLevel is the log level of the message with the number of suppressed occurrences
+    /// @attention the rate limiter must live until the end of the program, i.e. it must be a static object
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    constexpr RateLimiter(const uint64_t intervalInMilliseconds,
+                          const char* file,
+                          const int line,
+                          const char* function,
+                          const LogLevel logLevel) noexcept
+        : m_intervalInNanoseconds(intervalInMilliseconds * NANOSECONDS_PER_MILLISECOND)
+        , m_file(file)
+        , m_line(line)
+        , m_function(function)
+        , m_logLevel(logLevel)
+    {
+    }
+
+    ~RateLimiter() = default;
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter(RateLimiter&&) = delete;
+
+    RateLimiter& operator=(const RateLimiter&) = delete;
+    RateLimiter& operator=(RateLimiter&&) = delete;
+
+    /// @brief Registers an occurrence and decides whether it shall be emitted
+    /// @param[out] numberOfSuppressedOccurrences is set to the number of occurrences which were suppressed since the
+    /// last emitted occurrence; it is only set when the occurrence shall be emitted
+    /// @return true if the occurrence shall be emitted, false if it was suppressed
+    bool tryEmit(uint64_t& numberOfSuppressedOccurrences) noexcept;
+
+    /// @brief Takes the suppressed occurrences once the interval elapsed; this counts as emitted occurrence, i.e. the
+    /// next occurrence is suppressed again until the following interval elapsed
+    /// @param[out] numberOfSuppressedOccurrences is set to the number of occurrences which were suppressed since the
+    /// last emitted occurrence; it is only set when true is returned
+    /// @return true if the interval elapsed and occurrences were suppressed, false otherwise
+    bool tryFlush(uint64_t& numberOfSuppressedOccurrences) noexcept;
+
+    /// @brief Logs the number of suppressed occurrences of all rate limiters with a source location whose interval
+    /// elapsed; this is called periodically, e.g. by the keep alive thread of the runtime, so that the suppressed
+    /// occurrences of a call site are reported even when the call site is not hit again
+    static void flushSuppressedOccurrences() noexcept;
+
+  private:
+    void registerForFlush() noexcept;
+
+    static constexpr uint64_t NANOSECONDS_PER_MILLISECOND{1000000U};
+
+    uint64_t m_intervalInNanoseconds{0U};
+    /// @brief the monotonic time in nanoseconds at which the next occurrence is emitted; 0 emits the next occurrence
+    concurrent::Atomic<uint64_t> m_nextEmitTime{0U};
+    concurrent::Atomic<uint64_t> m_numberOfSuppressedOccurrences{0U};
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    const char* m_file{nullptr};
+    int m_line{0};
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    const char* m_function{nullptr};
+    LogLevel m_logLevel{LogLevel::Off};
+    /// @brief the rate limiters with suppressed occurrences form a list which is only ever extended
+    concurrent::Atomic<bool> m_isRegisteredForFlush{false};
+    RateLimiter* m_nextRegisteredForFlush{nullptr};
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_RATE_LIMITER_HPP
@@ -19,6 +19,7 @@
 #define IOX_HOOFS_REPORTING_LOGGING_HPP
 
 #include "iox/log/logstream.hpp"
+#include "iox/log/rate_limiter.hpp"
 
 namespace iox
 {
@@ -36,6 +37,17 @@ inline bool isLogLevelActive(LogLevel logLevel) noexcept
     // AXIVION Next Construct AutosarC++19_03-M5.14.1 getLogLevel is a static method without side effects
     return ((logLevel) <= MINIMAL_LOG_LEVEL) && (IGNORE_ACTIVE_LOG_LEVEL || ((logLevel) <= log::Logger::getLogLevel()));
 }
+
+/// @brief Convenience function for the IOX_LOG_RATE_LIMITED_INTERNAL macro which appends the number of suppressed
+/// messages to the log message
+inline LogStream& logSuppressedOccurrences(LogStream& stream, const uint64_t numberOfSuppressedOccurrences) noexcept
+{
+    if (numberOfSuppressedOccurrences > 0U)
+    {
+        stream << " [" << numberOfSuppressedOccurrences << " similar messages suppressed]";
+    }
+    return stream;
+}
 } // namespace internal
 } // namespace log
 } // namespace iox
@@ -50,6 +62,23 @@ inline bool isLogLevelActive(LogLevel logLevel) noexcept
     {                                                                                                                  \
         iox::log::LogStream(file, line, function, level).self() << msg_stream;                                         \
     }                                                                                                                  \
+    [] {}() // the empty lambda forces a semicolon on the caller side
+
+/// @brief Only for internal usage
+#define IOX_LOG_RATE_LIMITED_INTERNAL(file, line, function, level, interval_ms, msg_stream)                            \
+    if (iox::log::internal::isLogLevelActive(level))                                                                   \
+    {                                                                                                                  \
+        static iox::log::RateLimiter iox_internal_rateLimiter{interval_ms, file, line, function, level};               \
+        uint64_t iox_internal_numberOfSuppressedOccurrences{0U};                                                       \
+        if (iox_internal_rateLimiter.tryEmit(iox_internal_numberOfSuppressedOccurrences))                              \
+        {                                                                                                              \
+            iox::log::LogStream(file, line, function, level).self()                                                    \
+                << msg_stream << [iox_internal_numberOfSuppressedOccurrences](auto& stream) -> auto& {                 \
+                return iox::log::internal::logSuppressedOccurrences(stream,                                            \
+                                                                    iox_internal_numberOfSuppressedOccurrences);       \
+            };                                                                                                         \
+        }                                                                                                              \
+    }                                                                                                                  \
     [] {}() // the empty lambda forces a semicolon on the caller side
             // NOLINTEND(bugprone-macro-parentheses)
 
@@ -69,6 +98,28 @@ inline bool isLogLevelActive(LogLevel logLevel) noexcept
     IOX_LOG_INTERNAL(__FILE__, __LINE__, static_cast<const char*>(__FUNCTION__), iox::log::LogLevel::level, msg_stream)
 // NOLINTEND(bugprone-lambda-function-name)
 
+/// @brief Macro for logging on hot paths; the first message within an interval is logged, further messages from the
+/// same call site within the interval are suppressed and their number is appended to the next logged message or
+/// logged by 'RateLimiter::flushSuppressedOccurrences' once the interval elapsed
+/// @param[in] level is the log level to be used for the log message
+/// @param[in] interval_ms is the minimal time in milliseconds between two log messages from this call site
+/// @param[in] msg_stream is the log message stream; multiple items can be logged by using the '<<' operator
+/// @code
+///     IOX_LOG_RATE_LIMITED(Error, 1000, "Out of chunks");
+/// @endcode
+/// @note the message stream is only evaluated if the message is logged
+// AXIVION Next Construct AutosarC++19_03-A16.0.1 needed for source code location, safely wrapped in macro
+// AXIVION Next Construct AutosarC++19_03-M16.0.6 brackets around macro parameter would lead to compile time failures in this case
+// NOLINTBEGIN(bugprone-lambda-function-name)
+#define IOX_LOG_RATE_LIMITED(level, interval_ms, msg_stream)                                                           \
+    IOX_LOG_RATE_LIMITED_INTERNAL(__FILE__,                                                                            \
+                                  __LINE__,                                                                            \
+                                  static_cast<const char*>(__FUNCTION__),                                              \
+                                  iox::log::LogLevel::level,                                                           \
+                                  interval_ms,                                                                         \
+                                  msg_stream)
+// NOLINTEND(bugprone-lambda-function-name)
+
 // NOLINTEND(cppcoreguidelines-macro-usage)
 
 #endif // IOX_HOOFS_REPORTING_LOGGING_HPP
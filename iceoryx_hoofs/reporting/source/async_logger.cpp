@@ -0,0 +1,305 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+#include "iceoryx_platform/unistd.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+/// @brief the background thread is woken up by the logging threads; the timeout only bounds the time until a dropped
+/// message without a ring buffer or a failed wake-up is noticed
+constexpr int64_t BACKGROUND_THREAD_WAKE_UP_TIMEOUT_NS{100000000};
+constexpr int64_t NANOSECONDS_PER_SECOND{1000000000};
+} // namespace
+
+AsyncLogger::ThreadLocalData::~ThreadLocalData()
+{
+    if (ringBuffer != nullptr)
+    {
+        // the background thread releases the ring buffer once all messages are written
+        ringBuffer->isOrphaned.store(true, std::memory_order_release);
+    }
+}
+
+AsyncLogger::AsyncLogger() noexcept
+{
+    // intentionally avoid using 'IOX_POSIX_CALL' here to keep the logger dependency free; without the semaphore the
+    // background thread falls back to polling with the wake-up timeout
+    if (iox_sem_init(&m_wakeUpSemaphore, 0, 0U) != 0)
+    {
+        // intentionally do nothing since there is no other place to report the error
+    }
+    m_backgroundThread = std::thread([this] { run(); });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+    if (iox_sem_destroy(&m_wakeUpSemaphore) != 0)
+    {
+        // intentionally do nothing since there is no other place to report the error
+    }
+}
+
+void AsyncLogger::stop() noexcept
+{
+    if (m_backgroundThread.joinable())
+    {
+        m_keepRunning.store(false, std::memory_order_relaxed);
+        wakeUpBackgroundThread();
+        m_backgroundThread.join();
+    }
+}
+
+void AsyncLogger::wakeUpBackgroundThread() noexcept
+{
+    if (iox_sem_post(&m_wakeUpSemaphore) != 0)
+    {
+        // intentionally do nothing; the background thread wakes up after the timeout
+    }
+}
+
+void AsyncLogger::waitForQueuedMessages() noexcept
+{
+    timespec timeout{0, 0};
+    if (iox_clock_gettime(CLOCK_REALTIME, &timeout) != 0)
+    {
+        timeout = {0, 0};
+    }
+    const auto timeoutInNanoseconds = static_cast<int64_t>(timeout.tv_nsec) + BACKGROUND_THREAD_WAKE_UP_TIMEOUT_NS;
+    timeout.tv_sec += static_cast<decltype(timeout.tv_sec)>(timeoutInNanoseconds / NANOSECONDS_PER_SECOND);
+    timeout.tv_nsec = static_cast<decltype(timeout.tv_nsec)>(timeoutInNanoseconds % NANOSECONDS_PER_SECOND);
+
+    if (iox_sem_timedwait(&m_wakeUpSemaphore, &timeout) != 0)
+    {
+        // intentionally do nothing; a timeout, an interruption or an error just lead to an additional pass over the
+        // ring buffers
+    }
+}
+
+AsyncLogger::ThreadLocalData& AsyncLogger::getThreadLocalData() noexcept
+{
+    thread_local static ThreadLocalData data;
+    return data;
+}
+
+AsyncLogger::RingBuffer* AsyncLogger::ringBuffers() noexcept
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    static RingBuffer ringBuffers[MAX_NUMBER_OF_THREADS];
+    return &ringBuffers[0];
+}
+
+AsyncLogger::RingBuffer* AsyncLogger::acquireRingBuffer() noexcept
+{
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is always in the range of the pool
+        auto& ringBuffer = ringBuffers()[i];
+        bool isInUse{false};
+        if (ringBuffer.isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire))
+        {
+            return &ringBuffer;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t AsyncLogger::getNumberOfDroppedMessages() const noexcept
+{
+    return m_numberOfDroppedMessages.load(std::memory_order_relaxed);
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+void AsyncLogger::createLogMessageHeader(const char*, const int, const char*, LogLevel logLevel) noexcept
+{
+    // only the timestamp is taken here; the conversion to the local time and the formatting of the header is done by
+    // the background thread
+    auto& data = getThreadLocalData();
+    // intentionally avoid using 'IOX_POSIX_CALL' here to keep the logger dependency free
+    if (iox_clock_gettime(CLOCK_REALTIME, &data.timestamp) != 0)
+    {
+        data.timestamp = {0, 0};
+    }
+    data.logLevel = logLevel;
+    assumeFlushed();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    auto& data = getThreadLocalData();
+    if (data.ringBuffer == nullptr)
+    {
+        data.ringBuffer = acquireRingBuffer();
+    }
+
+    const auto logBuffer = getLogBuffer();
+    auto* ringBuffer = data.ringBuffer;
+    if (ringBuffer == nullptr)
+    {
+        m_numberOfDroppedMessages.fetch_add(1U, std::memory_order_relaxed);
+        wakeUpBackgroundThread();
+        assumeFlushed();
+        return;
+    }
+
+    const auto writeIndex = ringBuffer->writeIndex.load(std::memory_order_relaxed);
+    const auto readIndex = ringBuffer->readIndex.load(std::memory_order_acquire);
+    if (writeIndex - readIndex >= RING_BUFFER_CAPACITY)
+    {
+        m_numberOfDroppedMessages.fetch_add(1U, std::memory_order_relaxed);
+        assumeFlushed();
+        return;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is always in the range of the ring buffer
+    auto& message = ringBuffer->messages[writeIndex % RING_BUFFER_CAPACITY];
+    message.timestamp = data.timestamp;
+    message.logLevel = data.logLevel;
+    message.size = static_cast<uint32_t>(logBuffer.writeIndex);
+    std::memcpy(&message.payload[0], logBuffer.buffer, logBuffer.writeIndex);
+    // the store of the write index and the load of the read index are sequentially consistent and pair with the store
+    // of the read index and the load of the write index in the background thread; either the background thread sees
+    // the new message before it goes to sleep or this thread sees that the ring buffer was empty and wakes it up
+    ringBuffer->writeIndex.store(writeIndex + 1U, std::memory_order_seq_cst);
+    if (ringBuffer->readIndex.load(std::memory_order_seq_cst) == writeIndex)
+    {
+        wakeUpBackgroundThread();
+    }
+
+    assumeFlushed();
+}
+
+void AsyncLogger::run() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        const bool hasWrittenMessages = writeQueuedMessages();
+        reportDroppedMessages();
+        if (!hasWrittenMessages)
+        {
+            waitForQueuedMessages();
+        }
+    }
+
+    // write all messages which were queued before the logger was stopped
+    while (writeQueuedMessages())
+    {
+    }
+    reportDroppedMessages();
+}
+
+bool AsyncLogger::writeQueuedMessages() noexcept
+{
+    bool hasWrittenMessages{false};
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is always in the range of the pool
+        auto& ringBuffer = ringBuffers()[i];
+        if (!ringBuffer.isInUse.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        // the orphaned flag must be read before the write index to not miss the last messages of an exited thread
+        const bool isOrphaned = ringBuffer.isOrphaned.load(std::memory_order_acquire);
+        // see 'flush' for the pairing of the sequentially consistent operations on the indices
+        const auto writeIndex = ringBuffer.writeIndex.load(std::memory_order_seq_cst);
+        auto readIndex = ringBuffer.readIndex.load(std::memory_order_relaxed);
+        for (; readIndex < writeIndex; ++readIndex)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is always in the range
+            writeQueuedMessage(ringBuffer.messages[readIndex % RING_BUFFER_CAPACITY]);
+            ringBuffer.readIndex.store(readIndex + 1U, std::memory_order_seq_cst);
+            hasWrittenMessages = true;
+        }
+
+        if (isOrphaned)
+        {
+            ringBuffer.isOrphaned.store(false, std::memory_order_relaxed);
+            ringBuffer.isInUse.store(false, std::memory_order_release);
+        }
+    }
+    return hasWrittenMessages;
+}
+
+void AsyncLogger::writeQueuedMessage(const Message& message) noexcept
+{
+    constexpr uint32_t LINE_ENDING_SIZE{1};
+    constexpr uint32_t NULL_TERMINATION_SIZE{1};
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char buffer[MAX_LOG_MESSAGE_SIZE + LINE_ENDING_SIZE + NULL_TERMINATION_SIZE];
+
+    auto size =
+        ConsoleLogger::formatLogMessageHeader(message.timestamp, message.logLevel, &buffer[0], MAX_LOG_MESSAGE_SIZE);
+    const auto payloadSize = std::min(message.size, MAX_LOG_MESSAGE_SIZE - size);
+    std::memcpy(&buffer[size], &message.payload[0], payloadSize);
+    size += payloadSize;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the size is at most MAX_LOG_MESSAGE_SIZE
+    buffer[size] = '\n';
+
+    writeMessage(&buffer[0], size + LINE_ENDING_SIZE);
+}
+
+void AsyncLogger::reportDroppedMessages() noexcept
+{
+    const auto numberOfDroppedMessages = m_numberOfDroppedMessages.load(std::memory_order_relaxed);
+    if (numberOfDroppedMessages == m_numberOfReportedDroppedMessages)
+    {
+        return;
+    }
+
+    Message message;
+    if (iox_clock_gettime(CLOCK_REALTIME, &message.timestamp) != 0)
+    {
+        message.timestamp = {0, 0};
+    }
+    message.logLevel = LogLevel::Warn;
+    // NOLINTJUSTIFICATION snprintf required to populate char array
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    const auto retVal = snprintf(&message.payload[0],
+                                 MAX_LOG_MESSAGE_SIZE,
+                                 "%llu log messages were dropped since the logger could not keep up",
+                                 static_cast<unsigned long long>(numberOfDroppedMessages
+                                                                 - m_numberOfReportedDroppedMessages));
+    message.size = (retVal < 0) ? 0U : std::min(static_cast<uint32_t>(retVal), MAX_LOG_MESSAGE_SIZE - 1U);
+    m_numberOfReportedDroppedMessages = numberOfDroppedMessages;
+
+    writeQueuedMessage(message);
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : This is the default implementation for the output. The design
+// requires this to be non-static to not restrict custom implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+void AsyncLogger::writeMessage(const char* message, const uint64_t size) noexcept
+{
+    if (iox_write(STDOUT_FILENO, message, size) < 0)
+    {
+        // intentionally do nothing since there is no other place to report the error
+    }
+}
+
+} // namespace log
+} // namespace iox
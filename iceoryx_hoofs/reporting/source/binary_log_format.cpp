@@ -0,0 +1,411 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/log/building_blocks/binary_log_format.hpp"
+#include "iox/log/building_blocks/logformat.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+class ArgumentReader
+{
+  public:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as raw memory
+    ArgumentReader(const char* data, const uint64_t size) noexcept
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    bool isEmpty() const noexcept
+    {
+        return m_offset >= m_size;
+    }
+
+    bool read(void* destination, const uint64_t size) noexcept
+    {
+        if (size > m_size - m_offset)
+        {
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked above
+        std::memcpy(destination, m_data + m_offset, size);
+        m_offset += size;
+        return true;
+    }
+
+    /// @brief Skips the bytes and returns a pointer to them or a nullptr if not enough bytes are left
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as raw memory
+    const char* take(const uint64_t size) noexcept
+    {
+        if (size > m_size - m_offset)
+        {
+            return nullptr;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked above
+        const char* bytes = m_data + m_offset;
+        m_offset += size;
+        return bytes;
+    }
+
+  private:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as raw memory
+    const char* m_data{nullptr};
+    uint64_t m_size{0U};
+    uint64_t m_offset{0U};
+};
+
+class TextWriter
+{
+  public:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    TextWriter(char* buffer, const uint32_t bufferSize) noexcept
+        : m_buffer(buffer)
+        , m_capacity(bufferSize - 1U)
+    {
+        m_buffer[0] = 0;
+    }
+
+    uint32_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    void append(const char* text, const uint64_t length) noexcept
+    {
+        const auto lengthToCopy = static_cast<uint32_t>(std::min<uint64_t>(length, m_capacity - m_size));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked above
+        std::memcpy(m_buffer + m_size, text, lengthToCopy);
+        m_size += lengthToCopy;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) m_size is at most m_capacity
+        m_buffer[m_size] = 0;
+    }
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    void append(const char* text) noexcept
+    {
+        append(text, strlen(text));
+    }
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but format string literal
+    template <typename T>
+    void appendFormatted(const char* format, const T value) noexcept
+    {
+        // NOLINTJUSTIFICATION snprintf is required to get the same output as the ConsoleLogger
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto retVal = snprintf(m_buffer + m_size, m_capacity - m_size + 1U, format, value);
+        // NOLINTEND(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (retVal > 0)
+        {
+            m_size = std::min(m_size + static_cast<uint32_t>(retVal), m_capacity);
+        }
+    }
+
+  private:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    char* m_buffer{nullptr};
+    uint32_t m_capacity{0U};
+    uint32_t m_size{0U};
+};
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but format string literal
+template <typename T>
+bool appendFormatted(ArgumentReader& reader, TextWriter& writer, const char* format) noexcept
+{
+    T value;
+    if (!reader.read(&value, sizeof(T)))
+    {
+        return false;
+    }
+    writer.appendFormatted(format, value);
+    return true;
+}
+
+template <typename T>
+bool appendBinary(ArgumentReader& reader, TextWriter& writer) noexcept
+{
+    T value;
+    if (!reader.read(&value, sizeof(T)))
+    {
+        return false;
+    }
+
+    constexpr uint32_t NUMBER_OF_BITS{std::numeric_limits<T>::digits};
+    constexpr T ONE{1};
+    T mask{ONE << (NUMBER_OF_BITS - 1)};
+    for (uint32_t i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        writer.append(((value & mask) != 0) ? "1" : "0", 1U);
+        mask = static_cast<T>(mask >> 1);
+    }
+    return true;
+}
+
+// AXIVION DISABLE STYLE AutosarC++19_03-A3.9.1 : Basic numeric types are used in order to get the same format string
+// the ConsoleLogger uses
+bool appendDec(ArgumentReader& reader, TextWriter& writer, const BinaryLogValueType valueType) noexcept
+{
+    switch (valueType)
+    {
+    case BinaryLogValueType::Char:
+        return appendFormatted<char>(reader, writer, LOG_FORMAT_DEC<char>);
+    case BinaryLogValueType::SignedChar:
+        return appendFormatted<signed char>(reader, writer, LOG_FORMAT_DEC<signed char>);
+    case BinaryLogValueType::UnsignedChar:
+        return appendFormatted<unsigned char>(reader, writer, LOG_FORMAT_DEC<unsigned char>);
+    case BinaryLogValueType::Short:
+        return appendFormatted<short>(reader, writer, LOG_FORMAT_DEC<short>);
+    case BinaryLogValueType::UnsignedShort:
+        return appendFormatted<unsigned short>(reader, writer, LOG_FORMAT_DEC<unsigned short>);
+    case BinaryLogValueType::Int:
+        return appendFormatted<int>(reader, writer, LOG_FORMAT_DEC<int>);
+    case BinaryLogValueType::UnsignedInt:
+        return appendFormatted<unsigned int>(reader, writer, LOG_FORMAT_DEC<unsigned int>);
+    case BinaryLogValueType::Long:
+        return appendFormatted<long>(reader, writer, LOG_FORMAT_DEC<long>);
+    case BinaryLogValueType::UnsignedLong:
+        return appendFormatted<unsigned long>(reader, writer, LOG_FORMAT_DEC<unsigned long>);
+    case BinaryLogValueType::LongLong:
+        return appendFormatted<long long>(reader, writer, LOG_FORMAT_DEC<long long>);
+    case BinaryLogValueType::UnsignedLongLong:
+        return appendFormatted<unsigned long long>(reader, writer, LOG_FORMAT_DEC<unsigned long long>);
+    case BinaryLogValueType::Float:
+        return appendFormatted<float>(reader, writer, LOG_FORMAT_DEC<float>);
+    case BinaryLogValueType::Double:
+        return appendFormatted<double>(reader, writer, LOG_FORMAT_DEC<double>);
+    case BinaryLogValueType::LongDouble:
+        return appendFormatted<long double>(reader, writer, LOG_FORMAT_DEC<long double>);
+    default:
+        return false;
+    }
+}
+
+bool appendHex(ArgumentReader& reader, TextWriter& writer, const BinaryLogValueType valueType) noexcept
+{
+    switch (valueType)
+    {
+    case BinaryLogValueType::UnsignedChar:
+        return appendFormatted<unsigned char>(reader, writer, LOG_FORMAT_HEX<unsigned char>);
+    case BinaryLogValueType::UnsignedShort:
+        return appendFormatted<unsigned short>(reader, writer, LOG_FORMAT_HEX<unsigned short>);
+    case BinaryLogValueType::UnsignedInt:
+        return appendFormatted<unsigned int>(reader, writer, LOG_FORMAT_HEX<unsigned int>);
+    case BinaryLogValueType::UnsignedLong:
+        return appendFormatted<unsigned long>(reader, writer, LOG_FORMAT_HEX<unsigned long>);
+    case BinaryLogValueType::UnsignedLongLong:
+        return appendFormatted<unsigned long long>(reader, writer, LOG_FORMAT_HEX<unsigned long long>);
+    case BinaryLogValueType::Float:
+        return appendFormatted<float>(reader, writer, LOG_FORMAT_HEX<float>);
+    case BinaryLogValueType::Double:
+        return appendFormatted<double>(reader, writer, LOG_FORMAT_HEX<double>);
+    case BinaryLogValueType::LongDouble:
+        return appendFormatted<long double>(reader, writer, LOG_FORMAT_HEX<long double>);
+    case BinaryLogValueType::Pointer:
+        return appendFormatted<const void*>(reader, writer, LOG_FORMAT_HEX<const void*>);
+    default:
+        return false;
+    }
+}
+
+bool appendOct(ArgumentReader& reader, TextWriter& writer, const BinaryLogValueType valueType) noexcept
+{
+    switch (valueType)
+    {
+    case BinaryLogValueType::UnsignedChar:
+        return appendFormatted<unsigned char>(reader, writer, LOG_FORMAT_OCT<unsigned char>);
+    case BinaryLogValueType::UnsignedShort:
+        return appendFormatted<unsigned short>(reader, writer, LOG_FORMAT_OCT<unsigned short>);
+    case BinaryLogValueType::UnsignedInt:
+        return appendFormatted<unsigned int>(reader, writer, LOG_FORMAT_OCT<unsigned int>);
+    case BinaryLogValueType::UnsignedLong:
+        return appendFormatted<unsigned long>(reader, writer, LOG_FORMAT_OCT<unsigned long>);
+    case BinaryLogValueType::UnsignedLongLong:
+        return appendFormatted<unsigned long long>(reader, writer, LOG_FORMAT_OCT<unsigned long long>);
+    default:
+        return false;
+    }
+}
+
+bool appendBin(ArgumentReader& reader, TextWriter& writer, const BinaryLogValueType valueType) noexcept
+{
+    switch (valueType)
+    {
+    case BinaryLogValueType::UnsignedChar:
+        return appendBinary<unsigned char>(reader, writer);
+    case BinaryLogValueType::UnsignedShort:
+        return appendBinary<unsigned short>(reader, writer);
+    case BinaryLogValueType::UnsignedInt:
+        return appendBinary<unsigned int>(reader, writer);
+    case BinaryLogValueType::UnsignedLong:
+        return appendBinary<unsigned long>(reader, writer);
+    case BinaryLogValueType::UnsignedLongLong:
+        return appendBinary<unsigned long long>(reader, writer);
+    default:
+        return false;
+    }
+}
+// AXIVION ENABLE STYLE AutosarC++19_03-A3.9.1
+
+bool appendRaw(ArgumentReader& reader, TextWriter& writer) noexcept
+{
+    uint32_t size{0U};
+    if (!reader.read(&size, sizeof(size)))
+    {
+        return false;
+    }
+    const auto* bytes = reader.take(size);
+    if (bytes == nullptr)
+    {
+        return false;
+    }
+
+    writer.append("0x[");
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        if (i > 0)
+        {
+            writer.append(" ", 1U);
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked by the reader
+        writer.appendFormatted("%02hhx", static_cast<uint8_t>(bytes[i]));
+    }
+    writer.append("]", 1U);
+    return true;
+}
+
+bool appendArgument(ArgumentReader& reader, TextWriter& writer) noexcept
+{
+    BinaryLogArgumentType argumentType{BinaryLogArgumentType::String};
+    if (!reader.read(&argumentType, sizeof(argumentType)))
+    {
+        return false;
+    }
+
+    switch (argumentType)
+    {
+    case BinaryLogArgumentType::String:
+    {
+        uint32_t length{0U};
+        if (!reader.read(&length, sizeof(length)))
+        {
+            return false;
+        }
+        const auto* text = reader.take(length);
+        if (text == nullptr)
+        {
+            return false;
+        }
+        writer.append(text, length);
+        return true;
+    }
+    case BinaryLogArgumentType::Char:
+    {
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+        char value{0};
+        if (!reader.read(&value, sizeof(value)))
+        {
+            return false;
+        }
+        writer.append(&value, 1U);
+        return true;
+    }
+    case BinaryLogArgumentType::Bool:
+    {
+        uint8_t value{0U};
+        if (!reader.read(&value, sizeof(value)))
+        {
+            return false;
+        }
+        writer.append((value != 0U) ? "true" : "false");
+        return true;
+    }
+    case BinaryLogArgumentType::Raw:
+        return appendRaw(reader, writer);
+    case BinaryLogArgumentType::RawNullptr:
+    {
+        uint64_t size{0U};
+        if (!reader.read(&size, sizeof(size)))
+        {
+            return false;
+        }
+        writer.append("0x[nullptr, ");
+        writer.appendFormatted(LOG_FORMAT_DEC<uint64_t>, size);
+        writer.append("]", 1U);
+        return true;
+    }
+    default:
+        break;
+    }
+
+    BinaryLogValueType valueType{BinaryLogValueType::Char};
+    if (!reader.read(&valueType, sizeof(valueType)))
+    {
+        return false;
+    }
+
+    switch (argumentType)
+    {
+    case BinaryLogArgumentType::Dec:
+        return appendDec(reader, writer, valueType);
+    case BinaryLogArgumentType::Hex:
+        return appendHex(reader, writer, valueType);
+    case BinaryLogArgumentType::Oct:
+        return appendOct(reader, writer, valueType);
+    case BinaryLogArgumentType::Bin:
+        return appendBin(reader, writer, valueType);
+    default:
+        return false;
+    }
+}
+} // namespace
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+uint32_t decodeBinaryLogArguments(const char* arguments,
+                                  const uint64_t size,
+                                  char* buffer,
+                                  const uint32_t bufferSize) noexcept
+{
+    if (bufferSize == 0U)
+    {
+        return 0U;
+    }
+
+    ArgumentReader reader{arguments, size};
+    TextWriter writer{buffer, bufferSize};
+    while (!reader.isEmpty())
+    {
+        if (!appendArgument(reader, writer))
+        {
+            // the record is corrupted; the remaining arguments cannot be decoded
+            break;
+        }
+    }
+
+    return writer.size();
+}
+
+} // namespace log
+} // namespace iox
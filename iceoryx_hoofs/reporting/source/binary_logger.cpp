@@ -0,0 +1,460 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/log/building_blocks/binary_logger.hpp"
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/log/building_blocks/console_logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+/// @brief its address marks a file id whose file name record is currently written by another thread
+constexpr char FILE_NAME_RECORD_IN_PROGRESS{'\0'};
+} // namespace
+
+// NOLINTJUSTIFICATION See at declaration in header
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+concurrent::Atomic<LogLevel> BinaryLogger::s_activeLogLevel{LogLevel::Info};
+
+BinaryLogger::ThreadLocalData& BinaryLogger::getThreadLocalData() noexcept
+{
+    thread_local static ThreadLocalData data;
+    return data;
+}
+
+LogLevel BinaryLogger::getLogLevel() noexcept
+{
+    return s_activeLogLevel.load(std::memory_order_relaxed);
+}
+
+void BinaryLogger::setLogLevel(const LogLevel logLevel) noexcept
+{
+    s_activeLogLevel.store(logLevel, std::memory_order_relaxed);
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    closeLogFile();
+}
+
+uint64_t BinaryLogger::getNumberOfDroppedRecords() const noexcept
+{
+    const auto* logFile = acquireLogFile();
+    const auto numberOfDroppedRecords =
+        (logFile == nullptr) ? 0U : logFile->numberOfDroppedRecords.load(std::memory_order_relaxed);
+    releaseLogFile();
+    return numberOfDroppedRecords;
+}
+
+void BinaryLogger::initLogger(const LogLevel) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-M18.0.3 : Use of getenv is allowed in MISRA amendment#6312
+    // JUSTIFICATION getenv is required to configure the log file without changing the application
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    const auto* logFilePath = std::getenv("IOX_BINARY_LOG_FILE");
+    if (logFilePath == nullptr)
+    {
+        createLogMessageHeader(__FILE__, __LINE__, __FUNCTION__, LogLevel::Warn);
+        logString("The environment variable 'IOX_BINARY_LOG_FILE' is not set! The log messages are written to the "
+                  "console.");
+        flush();
+    }
+    else if (!openLogFile(logFilePath, LOG_FILE_SIZE))
+    {
+        createLogMessageHeader(__FILE__, __LINE__, __FUNCTION__, LogLevel::Error);
+        logString("Could not open the binary log file '");
+        logString(logFilePath);
+        logString("'! The log messages are written to the console.");
+        flush();
+    }
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+bool BinaryLogger::openLogFile(const char* path, const uint64_t fileSize) noexcept
+{
+    if (fileSize <= sizeof(BinaryLogFileHeader))
+    {
+        return false;
+    }
+
+    // the current log file is detached before the new one is created since truncating the same file would remove the
+    // memory below the threads which still write to it
+    auto* previousLogFile = detachLogFile();
+    const auto restorePreviousLogFile = [&] { m_logFile.store(previousLogFile, std::memory_order_release); };
+
+    // intentionally avoid using 'IOX_POSIX_CALL' and the posix wrapper here to keep the logger dependency free
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) the flags are defined by the platform
+    const auto fileDescriptor = iox_open(path, O_CREAT | O_RDWR | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fileDescriptor < 0)
+    {
+        restorePreviousLogFile();
+        return false;
+    }
+
+    if (iox_ftruncate(fileDescriptor, static_cast<iox_off_t>(fileSize)) != 0)
+    {
+        iox_close(fileDescriptor);
+        restorePreviousLogFile();
+        return false;
+    }
+
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) the flags are defined by the platform
+    auto* memory = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    // the mapping stays valid after the file descriptor is closed
+    iox_close(fileDescriptor);
+    // NOLINTJUSTIFICATION MAP_FAILED is defined by the platform
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+    if (memory == MAP_FAILED)
+    {
+        restorePreviousLogFile();
+        return false;
+    }
+
+    if (previousLogFile != nullptr)
+    {
+        munmap(previousLogFile, m_logFileSize);
+    }
+    for (auto& fileName : m_fileNames)
+    {
+        fileName.store(nullptr, std::memory_order_relaxed);
+    }
+
+    auto* logFile = new (memory) BinaryLogFileHeader;
+    std::memcpy(&logFile->magic[0], &BINARY_LOG_MAGIC[0], sizeof(BINARY_LOG_MAGIC));
+    logFile->version = BINARY_LOG_VERSION;
+    logFile->recordAlignment = BINARY_LOG_RECORD_ALIGNMENT;
+    logFile->capacity = fileSize - sizeof(BinaryLogFileHeader);
+    logFile->writeOffset.store(0U, std::memory_order_relaxed);
+    logFile->numberOfDroppedRecords.store(0U, std::memory_order_relaxed);
+
+    m_logFileSize = fileSize;
+    m_logFile.store(logFile, std::memory_order_release);
+    return true;
+}
+
+void BinaryLogger::closeLogFile() noexcept
+{
+    auto* logFile = detachLogFile();
+    if (logFile != nullptr)
+    {
+        munmap(logFile, m_logFileSize);
+        m_logFileSize = 0U;
+    }
+}
+
+BinaryLogFileHeader* BinaryLogger::acquireLogFile() const noexcept
+{
+    // the increment and the load are sequentially consistent and pair with the exchange and the load in
+    // 'detachLogFile'; either this thread sees the detached log file or 'detachLogFile' waits for this thread
+    m_numberOfLogFileAccesses.fetch_add(1U, std::memory_order_seq_cst);
+    return m_logFile.load(std::memory_order_seq_cst);
+}
+
+void BinaryLogger::releaseLogFile() const noexcept
+{
+    m_numberOfLogFileAccesses.fetch_sub(1U, std::memory_order_release);
+}
+
+BinaryLogFileHeader* BinaryLogger::detachLogFile() noexcept
+{
+    auto* logFile = m_logFile.exchange(nullptr, std::memory_order_seq_cst);
+    if (logFile != nullptr)
+    {
+        // the accesses only last for writing a single record; threads which acquire the log file from now on see the
+        // nullptr and write to the console
+        while (m_numberOfLogFileAccesses.load(std::memory_order_seq_cst) != 0U)
+        {
+            std::this_thread::yield();
+        }
+    }
+    return logFile;
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+void BinaryLogger::createLogMessageHeader(const char* file,
+                                          const int line,
+                                          const char* function,
+                                          LogLevel logLevel) noexcept
+{
+    timespec timestamp{0, 0};
+    // intentionally avoid using 'IOX_POSIX_CALL' here to keep the logger dependency free
+    if (iox_clock_gettime(CLOCK_REALTIME, &timestamp) != 0)
+    {
+        timestamp = {0, 0};
+        // intentionally do nothing since a timestamp from 01.01.1970 already indicates  an issue with the clock
+    }
+
+    // the function is not stored to keep the records small; the file and line are sufficient to locate the message
+    static_cast<void>(function);
+
+    auto& data = getThreadLocalData();
+    data.header.size = 0U;
+    data.header.type = BinaryLogRecordType::Message;
+    data.header.logLevel = logLevel;
+    data.header.reserved = 0U;
+    data.header.fileId = BINARY_LOG_INVALID_FILE_ID;
+    data.header.line = static_cast<uint32_t>(line);
+    data.header.seconds = static_cast<int64_t>(timestamp.tv_sec);
+    data.header.nanoseconds = static_cast<int64_t>(timestamp.tv_nsec);
+    data.file = file;
+    data.hasHeader = true;
+    data.argumentsSize = 0U;
+}
+
+void BinaryLogger::flush() noexcept
+{
+    auto* logFile = acquireLogFile();
+    if (logFile == nullptr)
+    {
+        releaseLogFile();
+        const auto logBuffer = getLogBuffer();
+        auto& data = getThreadLocalData();
+        // NOLINTJUSTIFICATION it is ensured that the index cannot be out of bounds
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        data.text[logBuffer.writeIndex] = '\n'; // overwrite null-termination with line ending
+        constexpr uint32_t LINE_ENDING_SIZE{1};
+
+        if (iox_write(STDOUT_FILENO, &data.text[0], logBuffer.writeIndex + LINE_ENDING_SIZE) < 0)
+        {
+            /// @todo iox-#1755 printing to the console failed; call the error handler after the error handler
+            /// refactoring was merged
+        }
+    }
+    else
+    {
+        auto& data = getThreadLocalData();
+        data.header.fileId = fileIdOf(*logFile, data.file);
+        appendRecord(*logFile, data.header, &data.arguments[0], data.argumentsSize);
+        releaseLogFile();
+    }
+    assumeFlushed();
+}
+
+bool BinaryLogger::appendRecord(BinaryLogFileHeader& logFile,
+                                const BinaryLogRecordHeader& header,
+                                const char* payload,
+                                const uint32_t payloadSize) noexcept
+{
+    const auto recordSize = static_cast<uint32_t>(sizeof(BinaryLogRecordHeader)) + payloadSize;
+    const uint64_t alignedRecordSize = alignedBinaryLogRecordSize(recordSize);
+
+    // the space for the record is reserved by atomically moving the write offset; no lock is required to write the
+    // record since the reserved space is owned exclusively by this thread
+    const auto offset = logFile.writeOffset.fetch_add(alignedRecordSize, std::memory_order_relaxed);
+    if (offset + alignedRecordSize > logFile.capacity)
+    {
+        logFile.numberOfDroppedRecords.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    // NOLINTJUSTIFICATION the records are located directly after the file header in the mapped memory
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* record = reinterpret_cast<char*>(&logFile) + sizeof(BinaryLogFileHeader) + offset;
+
+    // the size is written right away so that the following records can be read even when this thread is terminated
+    // before the record is complete; the type stays 'Incomplete' until the payload is written
+    BinaryLogRecordHeader recordHeader{};
+    recordHeader.size = recordSize;
+    recordHeader.type = BinaryLogRecordType::Incomplete;
+    std::memcpy(record, &recordHeader, sizeof(BinaryLogRecordHeader));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the space is reserved above
+    std::memcpy(record + sizeof(BinaryLogRecordHeader), payload, payloadSize);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    recordHeader = header;
+    recordHeader.size = recordSize;
+    std::memcpy(record, &recordHeader, sizeof(BinaryLogRecordHeader));
+    return true;
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+uint32_t BinaryLogger::fileIdOf(BinaryLogFileHeader& logFile, const char* file) noexcept
+{
+    if (file == nullptr)
+    {
+        return BINARY_LOG_INVALID_FILE_ID;
+    }
+
+    // '__FILE__' is a string literal; its address is used as key to avoid comparing the file names
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) only the address is required
+    const auto hash = static_cast<uint32_t>((reinterpret_cast<uintptr_t>(file) >> 3U) % MAX_NUMBER_OF_FILES);
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_FILES; ++i)
+    {
+        const auto fileId = (hash + i) % MAX_NUMBER_OF_FILES;
+        auto& fileName = m_fileNames[fileId];
+        auto* registeredFile = fileName.load(std::memory_order_acquire);
+        if (registeredFile == nullptr
+            && fileName.compare_exchange_strong(registeredFile,
+                                                &FILE_NAME_RECORD_IN_PROGRESS,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
+        {
+            // the file is only registered once its file name record is written; since the decoder reads the file
+            // names before the messages, other threads can refer to the id right away
+            BinaryLogRecordHeader header{};
+            header.type = BinaryLogRecordType::FileName;
+            header.logLevel = LogLevel::Off;
+            header.fileId = fileId;
+            const auto fileNameSize = static_cast<uint32_t>(std::min<uint64_t>(strlen(file), MAX_LOG_MESSAGE_SIZE));
+            if (!appendRecord(logFile, header, file, fileNameSize))
+            {
+                // the log file is full; the id is released so that no message refers to an id without file name
+                fileName.store(nullptr, std::memory_order_release);
+                return BINARY_LOG_INVALID_FILE_ID;
+            }
+            fileName.store(file, std::memory_order_release);
+            return fileId;
+        }
+        if (registeredFile == file)
+        {
+            return fileId;
+        }
+        if (registeredFile == &FILE_NAME_RECORD_IN_PROGRESS)
+        {
+            // it is unknown which file is registered with this id; the location of this message is not stored
+            return BINARY_LOG_INVALID_FILE_ID;
+        }
+    }
+
+    return BINARY_LOG_INVALID_FILE_ID;
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+LogBuffer BinaryLogger::getLogBuffer() const noexcept
+{
+    auto& data = getThreadLocalData();
+    uint32_t size{0U};
+    if (data.hasHeader)
+    {
+        timespec timestamp{0, 0};
+        timestamp.tv_sec = static_cast<decltype(timestamp.tv_sec)>(data.header.seconds);
+        timestamp.tv_nsec = static_cast<decltype(timestamp.tv_nsec)>(data.header.nanoseconds);
+        size = ConsoleLogger::formatLogMessageHeader(
+            timestamp, data.header.logLevel, &data.text[0], ThreadLocalData::NULL_TERMINATED_TEXT_SIZE);
+    }
+    // NOLINTJUSTIFICATION the size of the header is less than the size of the buffer
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    size += decodeBinaryLogArguments(&data.arguments[0],
+                                     data.argumentsSize,
+                                     &data.text[size],
+                                     ThreadLocalData::NULL_TERMINATED_TEXT_SIZE - size);
+    return LogBuffer{&data.text[0], size};
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+void BinaryLogger::assumeFlushed() noexcept
+{
+    auto& data = getThreadLocalData();
+    data.hasHeader = false;
+    data.argumentsSize = 0U;
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+void BinaryLogger::logString(const char* message) noexcept
+{
+    appendSizedArgument(BinaryLogArgumentType::String, message, strlen(message));
+}
+
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : The design requires this to be non-static to not restrict custom
+// implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+void BinaryLogger::logRaw(const void* const data, const uint64_t size) noexcept
+{
+    if (data == nullptr)
+    {
+        appendArgument(BinaryLogArgumentType::RawNullptr, &size, sizeof(size));
+    }
+    else
+    {
+        appendSizedArgument(BinaryLogArgumentType::Raw, data, size);
+    }
+}
+
+bool BinaryLogger::appendArgument(const BinaryLogArgumentType argumentType,
+                                  const void* data,
+                                  const uint32_t size) noexcept
+{
+    constexpr uint32_t ARGUMENT_TYPE_SIZE{sizeof(BinaryLogArgumentType)};
+    auto& threadLocalData = getThreadLocalData();
+    if (ARGUMENT_TYPE_SIZE + size > MAX_LOG_MESSAGE_SIZE - threadLocalData.argumentsSize)
+    {
+        /// @todo iox-#1755 currently we don't support log messages larger than the log buffer and everything larger
+        /// than the log buffer will be truncated
+        return false;
+    }
+
+    // NOLINTJUSTIFICATION it is ensured that the index cannot be out of bounds
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    threadLocalData.arguments[threadLocalData.argumentsSize] = static_cast<char>(argumentType);
+    std::memcpy(&threadLocalData.arguments[threadLocalData.argumentsSize + ARGUMENT_TYPE_SIZE], data, size);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    threadLocalData.argumentsSize += ARGUMENT_TYPE_SIZE + size;
+    return true;
+}
+
+void BinaryLogger::appendSizedArgument(const BinaryLogArgumentType argumentType,
+                                       const void* data,
+                                       const uint64_t size) noexcept
+{
+    constexpr uint32_t ARGUMENT_HEADER_SIZE{sizeof(BinaryLogArgumentType) + sizeof(uint32_t)};
+    auto& threadLocalData = getThreadLocalData();
+    const auto remainingSize = MAX_LOG_MESSAGE_SIZE - threadLocalData.argumentsSize;
+    if (remainingSize <= ARGUMENT_HEADER_SIZE)
+    {
+        /// @todo iox-#1755 currently we don't support log messages larger than the log buffer and everything larger
+        /// than the log buffer will be truncated
+        return;
+    }
+
+    const auto sizeToLog = static_cast<uint32_t>(std::min<uint64_t>(size, remainingSize - ARGUMENT_HEADER_SIZE));
+    // NOLINTJUSTIFICATION it is ensured that the index cannot be out of bounds
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    threadLocalData.arguments[threadLocalData.argumentsSize] = static_cast<char>(argumentType);
+    std::memcpy(&threadLocalData.arguments[threadLocalData.argumentsSize + sizeof(BinaryLogArgumentType)],
+                &sizeToLog,
+                sizeof(sizeToLog));
+    std::memcpy(&threadLocalData.arguments[threadLocalData.argumentsSize + ARGUMENT_HEADER_SIZE], data, sizeToLog);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    threadLocalData.argumentsSize += ARGUMENT_HEADER_SIZE + sizeToLog;
+}
+
+} // namespace log
+} // namespace iox
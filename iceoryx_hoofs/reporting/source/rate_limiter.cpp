@@ -0,0 +1,119 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/rate_limiter.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+// NOLINTJUSTIFICATION the list of rate limiters is shared by all call sites
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+concurrent::Atomic<RateLimiter*> registeredRateLimiters{nullptr};
+
+uint64_t monotonicTimeInNanoseconds() noexcept
+{
+    constexpr uint64_t NANOSECONDS_PER_SECOND{1000000000U};
+    timespec timestamp{0, 0};
+    // intentionally avoid using 'IOX_POSIX_CALL' here to keep the logger dependency free
+    if (iox_clock_gettime(CLOCK_MONOTONIC, &timestamp) != 0)
+    {
+        return 0U;
+    }
+    return static_cast<uint64_t>(timestamp.tv_sec) * NANOSECONDS_PER_SECOND
+           + static_cast<uint64_t>(timestamp.tv_nsec);
+}
+} // namespace
+
+bool RateLimiter::tryEmit(uint64_t& numberOfSuppressedOccurrences) noexcept
+{
+    const auto now = monotonicTimeInNanoseconds();
+    auto nextEmitTime = m_nextEmitTime.load(std::memory_order_relaxed);
+
+    // only one of the concurrently emitting threads wins the interval; the others are counted as suppressed
+    if (now < nextEmitTime
+        || !m_nextEmitTime.compare_exchange_strong(
+            nextEmitTime, now + m_intervalInNanoseconds, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+        m_numberOfSuppressedOccurrences.fetch_add(1U, std::memory_order_relaxed);
+        registerForFlush();
+        return false;
+    }
+
+    numberOfSuppressedOccurrences = m_numberOfSuppressedOccurrences.exchange(0U, std::memory_order_relaxed);
+    return true;
+}
+
+bool RateLimiter::tryFlush(uint64_t& numberOfSuppressedOccurrences) noexcept
+{
+    if (m_numberOfSuppressedOccurrences.load(std::memory_order_relaxed) == 0U)
+    {
+        return false;
+    }
+
+    // competes with 'tryEmit' for the interval; the suppressed occurrences are either taken here or by the next
+    // emitted occurrence
+    const auto now = monotonicTimeInNanoseconds();
+    auto nextEmitTime = m_nextEmitTime.load(std::memory_order_relaxed);
+    if (now < nextEmitTime
+        || !m_nextEmitTime.compare_exchange_strong(
+            nextEmitTime, now + m_intervalInNanoseconds, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    numberOfSuppressedOccurrences = m_numberOfSuppressedOccurrences.exchange(0U, std::memory_order_relaxed);
+    return numberOfSuppressedOccurrences > 0U;
+}
+
+void RateLimiter::registerForFlush() noexcept
+{
+    if (m_file == nullptr || m_isRegisteredForFlush.exchange(true, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    auto* head = registeredRateLimiters.load(std::memory_order_relaxed);
+    do
+    {
+        m_nextRegisteredForFlush = head;
+    } while (!registeredRateLimiters.compare_exchange_weak(
+        head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void RateLimiter::flushSuppressedOccurrences() noexcept
+{
+    for (auto* rateLimiter = registeredRateLimiters.load(std::memory_order_acquire); rateLimiter != nullptr;
+         rateLimiter = rateLimiter->m_nextRegisteredForFlush)
+    {
+        uint64_t numberOfSuppressedOccurrences{0U};
+        if (rateLimiter->tryFlush(numberOfSuppressedOccurrences))
+        {
+            IOX_LOG_INTERNAL(rateLimiter->m_file,
+                             rateLimiter->m_line,
+                             rateLimiter->m_function,
+                             rateLimiter->m_logLevel,
+                             "[" << numberOfSuppressedOccurrences << " similar messages suppressed]");
+        }
+    }
+}
+
+} // namespace log
+} // namespace iox
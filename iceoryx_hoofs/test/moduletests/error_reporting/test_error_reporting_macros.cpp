@@ -93,6 +93,24 @@ TEST_F(ErrorReportingMacroApi_test, reportFatal)
     IOX_TESTING_EXPECT_ERROR(MyCodeA::OutOfBounds);
 }
 
+TEST_F(ErrorReportingMacroApi_test, reportRateLimitedInformsHandlerAboutEachError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3d8a6c2-91e4-4b57-8c0f-6a2e5d71b9e8");
+    constexpr uint64_t INTERVAL_MS{60U * 60U * 1000U};
+    auto f = []() { IOX_REPORT_RATE_LIMITED(MyCodeA::OutOfBounds, RUNTIME_ERROR, INTERVAL_MS); };
+
+    runInTestThread(f);
+
+    IOX_TESTING_EXPECT_NO_PANIC();
+    IOX_TESTING_EXPECT_ERROR(MyCodeA::OutOfBounds);
+
+    // the log of the second report is suppressed but the error must still reach the handler
+    iox::testing::ErrorHandler::instance().reset();
+    runInTestThread(f);
+
+    IOX_TESTING_EXPECT_ERROR(MyCodeA::OutOfBounds);
+}
+
 TEST_F(ErrorReportingMacroApi_test, reportConditionalError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d95fe843-5e1b-422f-bd15-a791b639b43e");
@@ -215,6 +215,117 @@ TEST_F(MpmcLoFFLi_test, PushWhenFull)
     EXPECT_THAT(this->m_loffli.push(indexPush), Eq(false));
 }
 
+TEST_F(MpmcLoFFLi_test, PopNReturnsAllIndicesWhenCountExceedsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3c9d71-5e2b-4a86-b1d4-8c7e6a2f9b30");
+    std::vector<uint32_t> indices(CAPACITY + 2U, 0U);
+
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), static_cast<uint32_t>(indices.size())), Eq(CAPACITY));
+    indices.resize(CAPACITY);
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), CAPACITY), Eq(0U));
+
+    std::sort(indices.begin(), indices.end());
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+}
+
+TEST_F(MpmcLoFFLi_test, PopNWithCountZeroPopsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2e81c6d-4f07-4b93-9d5a-6e1b3c8f0d42");
+    uint32_t index{0};
+
+    EXPECT_THAT(this->m_loffli.popN(&index, 0U), Eq(0U));
+    EXPECT_THAT(this->m_loffli.popN(&index, 1U), Eq(1U));
+}
+
+TEST_F(MpmcLoFFLi_test, PopNPublishesTheNumberOfOwnedIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf390496-a803-4f0b-a4f5-2c67793cfa64");
+    constexpr uint32_t COUNT{3U};
+    std::vector<uint32_t> indices(COUNT, 0U);
+    uint32_t numberOfOwnedIndices{0U};
+
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), COUNT, &numberOfOwnedIndices), Eq(COUNT));
+    EXPECT_THAT(numberOfOwnedIndices, Eq(COUNT));
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), numberOfOwnedIndices), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNOfPoppedIndicesMakesThemAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b4d0e92-7c13-4f58-a0e6-2d9f1b7c5a83");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), CAPACITY), Eq(CAPACITY));
+
+    std::reverse(indices.begin(), indices.end());
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), CAPACITY), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+
+    EXPECT_THAT(useListPoped, Eq(indices));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNWithCountZeroSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5f7a3b0-2e68-4c19-8b3d-71a0c6e4f925");
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pushN(&index, 0U), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNWithIndexWhichWasNotPoppedPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e9b6c14-8a27-4d05-9f61-b2c7e0d4a358");
+    std::vector<uint32_t> indices(2U, 0U);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), 2U), Eq(2U));
+
+    std::vector<uint32_t> indicesToPush{indices[0], indices[1], CAPACITY - 1U};
+    EXPECT_THAT(this->m_loffli.pushN(indicesToPush.data(), 3U), Eq(false));
+
+    // the popped indices can still be pushed
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), 2U), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNWithDuplicatedIndexPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c1a5f37-d046-4e92-b7a8-4f3e9c2d6b01");
+    std::vector<uint32_t> indices(2U, 0U);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), 2U), Eq(2U));
+
+    std::vector<uint32_t> indicesToPush{indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushN(indicesToPush.data(), 3U), Eq(false));
+
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), 2U), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNOutOfBoundIndexPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f06d2b84-91c3-47e5-a8b2-5d7c1e3f9a64");
+    uint32_t index{0};
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    std::vector<uint32_t> indicesToPush{index, CAPACITY + 42U};
+    EXPECT_THAT(this->m_loffli.pushN(indicesToPush.data(), 2U), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(index), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushNToUninitializedLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57e2c9a0-3b6d-4f18-9e4c-a1d8b7f02c36");
+    MpmcLoFFLi loFFLi;
+    uint32_t index{0};
+    EXPECT_THAT(loFFLi.pushN(&index, 1U), Eq(false));
+    EXPECT_THAT(loFFLi.popN(&index, 1U), Eq(0U));
+}
+
 TEST_F(MpmcLoFFLi_test, PushToUninitializedLoFFLi)
 {
     ::testing::Test::RecordProperty("TEST_ID", "34f5b48a-a30a-4dd1-81d6-7c963c005f1b");
@@ -29,6 +29,8 @@ using namespace iox;
 constexpr uint64_t SHARED_MEMORY_SIZE = 4096UL * 32UL;
 constexpr uint64_t NUMBER_OF_MEMORY_PARTITIONS = 2U;
 uint8_t memoryPatternValue = 1U;
+constexpr segment_id_underlying_t RAW_POINTER_BEHAVIOUR_ID{
+    PointerRepository<segment_id_underlying_t, UntypedRelativePointer::ptr_t>::RAW_POINTER_BEHAVIOUR_ID};
 
 template <typename T>
 class RelativePointer_test : public Test
@@ -485,6 +487,65 @@ TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
     EXPECT_FALSE(rp2);
 }
 
+TYPED_TEST(RelativePointer_test, SearchIdFindsSegmentsRegisteredInArbitraryAddressOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c0d5e4a-2b8f-4d67-9a31-5e6f8b2c4d10");
+    constexpr uint64_t NUMBER_OF_SEGMENTS{16U};
+    constexpr uint64_t SEGMENT_SIZE{NUMBER_OF_MEMORY_PARTITIONS * SHARED_MEMORY_SIZE / NUMBER_OF_SEGMENTS};
+    auto* memoryStart = this->partitionPtr(0U);
+
+    // register the segments in descending address order with ascending ids
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        auto* segmentStart = memoryStart + (NUMBER_OF_SEGMENTS - 1U - i) * SEGMENT_SIZE;
+        ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{i + 1U}, segmentStart, SEGMENT_SIZE));
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        const segment_id_underlying_t expectedId{NUMBER_OF_SEGMENTS - i};
+        auto* segmentStart = memoryStart + i * SEGMENT_SIZE;
+        EXPECT_EQ(UntypedRelativePointer::searchId(segmentStart), expectedId);
+        EXPECT_EQ(UntypedRelativePointer::searchId(segmentStart + SEGMENT_SIZE / 2U), expectedId);
+        EXPECT_EQ(UntypedRelativePointer::searchId(segmentStart + SEGMENT_SIZE - 1U), expectedId);
+    }
+
+    auto* behindLastSegment = memoryStart + NUMBER_OF_SEGMENTS * SEGMENT_SIZE;
+    EXPECT_EQ(UntypedRelativePointer::searchId(behindLastSegment),
+              RAW_POINTER_BEHAVIOUR_ID);
+    EXPECT_EQ(UntypedRelativePointer::searchId(memoryStart - 1U),
+              RAW_POINTER_BEHAVIOUR_ID);
+}
+
+TYPED_TEST(RelativePointer_test, SearchIdDoesNotFindUnregisteredSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3a9b6f1-0d42-4c8e-8b75-19c2d7f4a6e3");
+    auto* ptr0 = this->partitionPtr(0U);
+    auto* ptr1 = this->partitionPtr(1U);
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{1U}, ptr0, SHARED_MEMORY_SIZE));
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{2U}, ptr1, SHARED_MEMORY_SIZE));
+
+    ASSERT_TRUE(UntypedRelativePointer::unregisterPtr(segment_id_t{1U}));
+
+    EXPECT_EQ(UntypedRelativePointer::searchId(ptr0 + SHARED_MEMORY_SIZE / 2U),
+              RAW_POINTER_BEHAVIOUR_ID);
+    EXPECT_EQ(UntypedRelativePointer::searchId(ptr1 + SHARED_MEMORY_SIZE / 2U), 2U);
+}
+
+TYPED_TEST(RelativePointer_test, SearchIdReturnsSmallestIdForOverlappingSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b8e2f7c-61a4-4d09-b3e8-a04c9d6e1f52");
+    auto* ptr0 = this->partitionPtr(0U);
+    constexpr uint64_t INNER_SEGMENT_OFFSET{SHARED_MEMORY_SIZE / 4U};
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(
+        segment_id_t{3U}, ptr0 + INNER_SEGMENT_OFFSET, SHARED_MEMORY_SIZE / 2U));
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{7U}, ptr0, SHARED_MEMORY_SIZE));
+
+    EXPECT_EQ(UntypedRelativePointer::searchId(ptr0), 7U);
+    EXPECT_EQ(UntypedRelativePointer::searchId(ptr0 + INNER_SEGMENT_OFFSET), 3U);
+    EXPECT_EQ(UntypedRelativePointer::searchId(ptr0 + SHARED_MEMORY_SIZE - 1U), 7U);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
 
 } // namespace
@@ -15,6 +15,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_platform/mman.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/memory.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
@@ -163,7 +165,241 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, PageSizeIsRegularPageSizeWithoutHugePages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2481671f-cbab-4b04-a6dd-5731405b977b");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmPageSize")
+                   .memorySizeInBytes(100)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .create()
+                   .expect("failed to create sut");
+
+    EXPECT_THAT(sut.getPageSize(), Eq(iox::detail::pageSize()));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithHugePagesReportsHugePageSizeOnlyWhenMemoryIsBackedByHugePages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7dcdc81c-c126-45a1-bd33-2505e473367f");
+    const uint64_t MEMORY_SIZE = 4U * 1024U * 1024U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmHugePageSize")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .useHugePages(true)
+                   .prefaultMemory(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    const bool isBackedByHugePages = iox_shm_is_backed_by_huge_pages(sut.getBaseAddress(), MEMORY_SIZE) == 1;
+    EXPECT_THAT(sut.getPageSize(),
+                Eq(isBackedByHugePages ? static_cast<uint64_t>(iox_huge_page_size()) : iox::detail::pageSize()));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithHugePagesAndPrefaultingProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd94d3c7-02af-430f-ab93-d1f0f0ea2eab");
+    const uint64_t MEMORY_SIZE = 4U * 1024U * 1024U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .useHugePages(true)
+                   .prefaultMemory(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    // huge pages are only a hint, the page size is either the regular or the huge page size
+    EXPECT_THAT(sut.getPageSize(), Ge(iox::detail::pageSize()));
+
+    const auto* data_ptr = static_cast<const uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; i += iox::detail::pageSize())
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        EXPECT_THAT(data_ptr[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithMultipleInitializationThreadsProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d6c0b8e-63a5-4e1f-9f0b-5c8f3e7a2d41");
+    // an odd number of pages which is not a multiple of the number of threads
+    const uint64_t MEMORY_SIZE = 13U * iox::detail::pageSize() + 17U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmParallelInit")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .prefaultMemory(true)
+                   .initializationThreads(4U)
+                   .create()
+                   .expect("failed to create sut");
+
+    const auto* data_ptr = static_cast<const uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, OpenWithPrefaultingOnAllCoresKeepsTheContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a4c2f37-2c9b-4d52-8e39-0b1f6a9d7e25");
+    const uint64_t MEMORY_SIZE = 8U * 1024U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmParallelPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint64_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = i * 7 + 3;
+    }
+
+    auto sut2 = PosixSharedMemoryObjectBuilder()
+                    .name("shmParallelPrefault")
+                    .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                    .accessMode(iox::AccessMode::ReadOnly)
+                    .openMode(iox::OpenMode::OpenExisting)
+                    .prefaultMemory(true)
+                    .initializationThreads(0U)
+                    .create()
+                    .expect("failed to create sut");
+
+    const auto* data_ptr2 = static_cast<const uint64_t*>(sut2.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr2[i], Eq(i * 7 + 3));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, NumaNodeIsNotSetWithoutBinding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3f6a0c4-3b1e-4a70-b5d9-2c7e8a1f4b92");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNoNumaNode")
+                   .memorySizeInBytes(100)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .create()
+                   .expect("failed to create sut");
+
+    EXPECT_FALSE(sut.getNumaNode().has_value());
+}
+
+TEST_F(SharedMemoryObject_Test, BindingToNumaNodeZeroProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d2b8e61-0f4c-4c39-9a7e-8b3d6f1c2e70");
+    const uint64_t MEMORY_SIZE = 4U * iox::detail::pageSize();
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaNodeZero")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .numaNode(0U)
+                   .create()
+                   .expect("failed to create sut");
+
+    // the binding is only applied when the platform supports it
+    if (sut.getNumaNode().has_value())
+    {
+        EXPECT_THAT(sut.getNumaNode().value(), Eq(0U));
+    }
+
+    const auto* data_ptr = static_cast<const uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; i += iox::detail::pageSize())
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        EXPECT_THAT(data_ptr[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, BindingToNonExistingNumaNodeFallsBackToUnboundMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1c7e94b-6d28-4f35-b0e2-7f9d3c5a8b16");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmInvalidNumaNode")
+                   .memorySizeInBytes(100)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .numaNode(std::numeric_limits<uint32_t>::max())
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_FALSE(sut->getNumaNode().has_value());
+}
+
+TEST_F(SharedMemoryObject_Test, OpenWithPrefaultingKeepsTheContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82963efe-2805-4ff5-9750-76398940c492");
+    const uint64_t MEMORY_SIZE = 1024;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint64_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = i * 3 + 1;
+    }
+
+    auto sut2 = PosixSharedMemoryObjectBuilder()
+                    .name("shmPrefault")
+                    .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                    .accessMode(iox::AccessMode::ReadWrite)
+                    .openMode(iox::OpenMode::OpenExisting)
+                    .prefaultMemory(true)
+                    .create()
+                    .expect("failed to create sut");
+
+    auto* data_ptr2 = static_cast<uint64_t*>(sut2.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        EXPECT_THAT(data_ptr2[i], Eq(i * 3 + 1));
+    }
+}
+
 #if !defined(_WIN32) && !defined(__APPLE__)
+TEST_F(SharedMemoryObject_Test, CreateWithLockedMemoryWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f33fa3a-c195-49b7-89df-07b876467bd4");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(iox::detail::pageSize())
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .lockMemory(true)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+}
+
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a9859b5e-555b-4cff-b418-74168a9fd85a");
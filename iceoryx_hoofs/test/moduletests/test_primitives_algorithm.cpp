@@ -226,4 +226,23 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST_F(algorithm_test, IndexOfLowestSetBitOfOneIsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19cc2d7f-d087-4cbf-bd82-9fca939e4cdf");
+    EXPECT_THAT(indexOfLowestSetBit(1U), Eq(0U));
+}
+
+TEST_F(algorithm_test, IndexOfLowestSetBitIgnoresHigherSetBits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9cd560c0-1cbb-463f-977a-738a53846851");
+    EXPECT_THAT(indexOfLowestSetBit(0b101000U), Eq(3U));
+}
+
+TEST_F(algorithm_test, IndexOfLowestSetBitOfMostSignificantBitIsSixtyThree)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60c612ec-4305-411e-88ca-587d4de017f6");
+    constexpr uint64_t MOST_SIGNIFICANT_BIT{1ULL << 63U};
+    EXPECT_THAT(indexOfLowestSetBit(MOST_SIGNIFICANT_BIT), Eq(63U));
+}
 } // namespace
@@ -0,0 +1,149 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+#include "iox/log/logstream.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::log;
+
+class AsyncLoggerSUT : public AsyncLogger
+{
+  public:
+    ~AsyncLoggerSUT() override
+    {
+        stop();
+    }
+
+    AsyncLoggerSUT() = default;
+    AsyncLoggerSUT(const AsyncLoggerSUT&) = delete;
+    AsyncLoggerSUT(AsyncLoggerSUT&&) = delete;
+    AsyncLoggerSUT& operator=(const AsyncLoggerSUT&) = delete;
+    AsyncLoggerSUT& operator=(AsyncLoggerSUT&&) = delete;
+
+    using AsyncLogger::stop;
+
+    void log(const std::string& message, const LogLevel logLevel = LogLevel::Info)
+    {
+        LogStream(*this, "file", 42, "function", logLevel) << message;
+    }
+
+    std::vector<std::string> writtenMessages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_writtenMessages;
+    }
+
+    std::atomic<bool> isOutputBlocked{false};
+
+  protected:
+    void writeMessage(const char* message, const uint64_t size) noexcept override
+    {
+        while (isOutputBlocked)
+        {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_writtenMessages.emplace_back(message, size);
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::string> m_writtenMessages;
+};
+
+TEST(AsyncLogger_test, QueuedMessagesAreWrittenWithHeaderInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f6b0d1e-92a7-4c58-b0e4-7d21c9a8f356");
+    AsyncLoggerSUT sut;
+
+    sut.log("first", LogLevel::Info);
+    sut.log("second", LogLevel::Warn);
+    sut.log("third", LogLevel::Error);
+    sut.stop();
+
+    const auto messages = sut.writtenMessages();
+    ASSERT_THAT(messages.size(), Eq(3U));
+    EXPECT_THAT(messages[0], HasSubstr(logLevelDisplayText(LogLevel::Info)));
+    EXPECT_THAT(messages[0], EndsWith(": first\n"));
+    EXPECT_THAT(messages[1], HasSubstr(logLevelDisplayText(LogLevel::Warn)));
+    EXPECT_THAT(messages[1], EndsWith(": second\n"));
+    EXPECT_THAT(messages[2], HasSubstr(logLevelDisplayText(LogLevel::Error)));
+    EXPECT_THAT(messages[2], EndsWith(": third\n"));
+    EXPECT_THAT(sut.getNumberOfDroppedMessages(), Eq(0U));
+}
+
+TEST(AsyncLogger_test, MessagesFromMultipleThreadsAreWritten)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8d4c2e7-15f9-4b3a-8e60-c94b17d5f2a0");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t NUMBER_OF_MESSAGES_PER_THREAD{AsyncLogger::RING_BUFFER_CAPACITY / 2U};
+    AsyncLoggerSUT sut;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&sut, i] {
+            for (uint32_t j = 0U; j < NUMBER_OF_MESSAGES_PER_THREAD; ++j)
+            {
+                sut.log("thread " + std::to_string(i) + " message " + std::to_string(j));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    sut.stop();
+
+    EXPECT_THAT(sut.writtenMessages().size(), Eq(NUMBER_OF_THREADS * NUMBER_OF_MESSAGES_PER_THREAD));
+    EXPECT_THAT(sut.getNumberOfDroppedMessages(), Eq(0U));
+}
+
+TEST(AsyncLogger_test, MessagesAreDroppedAndReportedWhenRingBufferIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1e7f3a9-6c24-4f80-9b5d-2a8e0c6b4f17");
+    constexpr uint32_t NUMBER_OF_DROPPED_MESSAGES{10U};
+    AsyncLoggerSUT sut;
+
+    // the background thread is blocked while writing the first message, which keeps it in the ring buffer
+    sut.isOutputBlocked = true;
+    for (uint32_t i = 0U; i < AsyncLogger::RING_BUFFER_CAPACITY + NUMBER_OF_DROPPED_MESSAGES; ++i)
+    {
+        sut.log("message " + std::to_string(i));
+    }
+    EXPECT_THAT(sut.getNumberOfDroppedMessages(), Eq(NUMBER_OF_DROPPED_MESSAGES));
+
+    sut.isOutputBlocked = false;
+    sut.stop();
+
+    const auto messages = sut.writtenMessages();
+    ASSERT_THAT(messages.size(), Eq(AsyncLogger::RING_BUFFER_CAPACITY + 1U));
+    EXPECT_THAT(messages,
+                Contains(HasSubstr(std::to_string(NUMBER_OF_DROPPED_MESSAGES) + " log messages were dropped")));
+}
+
+} // namespace
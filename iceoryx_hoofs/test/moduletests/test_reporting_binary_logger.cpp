@@ -0,0 +1,398 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/building_blocks/binary_logger.hpp"
+#include "iox/log/building_blocks/console_logger.hpp"
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::log;
+
+class BinaryLoggerSUT : public BinaryLogger
+{
+  public:
+    using BinaryLogger::assumeFlushed;
+    using BinaryLogger::createLogMessageHeader;
+    using BinaryLogger::flush;
+    using BinaryLogger::getLogBuffer;
+    using BinaryLogger::logBin;
+    using BinaryLogger::logBool;
+    using BinaryLogger::logChar;
+    using BinaryLogger::logDec;
+    using BinaryLogger::logHex;
+    using BinaryLogger::logOct;
+    using BinaryLogger::logRaw;
+    using BinaryLogger::logString;
+    using BinaryLogger::openLogFile;
+};
+
+class ConsoleLoggerSUT : public ConsoleLogger
+{
+  public:
+    using ConsoleLogger::assumeFlushed;
+    using ConsoleLogger::createLogMessageHeader;
+    using ConsoleLogger::getLogBuffer;
+    using ConsoleLogger::logBin;
+    using ConsoleLogger::logBool;
+    using ConsoleLogger::logChar;
+    using ConsoleLogger::logDec;
+    using ConsoleLogger::logHex;
+    using ConsoleLogger::logOct;
+    using ConsoleLogger::logRaw;
+    using ConsoleLogger::logString;
+};
+
+struct Record
+{
+    BinaryLogRecordHeader header;
+    std::string payload;
+};
+
+class BinaryLogger_test : public Test
+{
+  public:
+    void TearDown() override
+    {
+        std::remove(m_logFilePath.c_str());
+    }
+
+    std::vector<Record> readRecords(uint64_t& numberOfDroppedRecords) const
+    {
+        std::ifstream logFileStream(m_logFilePath, std::ios::binary);
+        const std::vector<char> logFile{std::istreambuf_iterator<char>(logFileStream),
+                                        std::istreambuf_iterator<char>()};
+        std::vector<Record> records;
+        if (logFile.size() < sizeof(BinaryLogFileHeader))
+        {
+            return records;
+        }
+
+        const auto& fileHeader = *reinterpret_cast<const BinaryLogFileHeader*>(logFile.data());
+        EXPECT_THAT(std::string(&fileHeader.magic[0]), StrEq(&BINARY_LOG_MAGIC[0]));
+        EXPECT_THAT(fileHeader.version, Eq(BINARY_LOG_VERSION));
+        numberOfDroppedRecords = fileHeader.numberOfDroppedRecords.load();
+
+        const auto recordsEnd = std::min(fileHeader.writeOffset.load(), fileHeader.capacity);
+        forEachBinaryLogRecord(&logFile[sizeof(BinaryLogFileHeader)],
+                               recordsEnd,
+                               [&](const BinaryLogRecordHeader& header, const char* payload, const uint64_t size) {
+                                   records.push_back({header, std::string(payload, size)});
+                               });
+        return records;
+    }
+
+    static std::string decode(const std::string& arguments)
+    {
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char buffer[4096];
+        const auto size = decodeBinaryLogArguments(arguments.data(), arguments.size(), &buffer[0], sizeof(buffer));
+        return std::string(&buffer[0], size);
+    }
+
+    std::string m_logFilePath{std::string(iox::platform::IOX_TEMP_DIR) + "iox_binary_logger_test.blog"};
+};
+
+// the address is logged as well and must therefore be the same for all loggers
+constexpr uint8_t RAW_DATA[]{0x01, 0xab, 0xff};
+
+template <typename SUT>
+void logAllArgumentTypes(SUT& sut)
+{
+    sut.logString("the answer is ");
+    sut.logDec(42);
+    sut.logChar(' ');
+    sut.logDec(std::numeric_limits<int64_t>::min());
+    sut.logChar(' ');
+    sut.logDec(std::numeric_limits<uint64_t>::max());
+    sut.logChar(' ');
+    sut.logDec(static_cast<signed char>(-13));
+    sut.logChar(' ');
+    sut.logDec(3.14159F);
+    sut.logChar(' ');
+    sut.logDec(-2.718281828);
+    sut.logChar(' ');
+    sut.logDec(1.5L);
+    sut.logChar(' ');
+    sut.logBool(true);
+    sut.logBool(false);
+    sut.logChar(' ');
+    sut.logHex(static_cast<uint16_t>(0xbeefU));
+    sut.logChar(' ');
+    sut.logHex(0.25);
+    sut.logChar(' ');
+    sut.logHex(static_cast<const void*>(&RAW_DATA[0]));
+    sut.logChar(' ');
+    sut.logOct(static_cast<uint32_t>(0777U));
+    sut.logChar(' ');
+    sut.logBin(static_cast<uint8_t>(0xa5U));
+    sut.logChar(' ');
+    sut.logRaw(&RAW_DATA[0], sizeof(RAW_DATA));
+    sut.logRaw(nullptr, 7U);
+}
+
+TEST_F(BinaryLogger_test, ArgumentsAreDecodedToTheTextOfTheConsoleLogger)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c0e9a73-2f84-4d1b-a6e8-93b7d0f4c215");
+    BinaryLoggerSUT binarySut;
+    ConsoleLoggerSUT consoleSut;
+
+    // the header contains the current time and is therefore removed from the log buffers
+    binarySut.createLogMessageHeader("file", 42, "function", LogLevel::Info);
+    binarySut.assumeFlushed();
+    consoleSut.createLogMessageHeader("file", 42, "function", LogLevel::Info);
+    consoleSut.assumeFlushed();
+
+    logAllArgumentTypes(binarySut);
+    logAllArgumentTypes(consoleSut);
+
+    const auto binaryLogBuffer = binarySut.getLogBuffer();
+    const auto consoleLogBuffer = consoleSut.getLogBuffer();
+    EXPECT_THAT(std::string(binaryLogBuffer.buffer, binaryLogBuffer.writeIndex),
+                StrEq(std::string(consoleLogBuffer.buffer, consoleLogBuffer.writeIndex)));
+    binarySut.assumeFlushed();
+    consoleSut.assumeFlushed();
+}
+
+TEST_F(BinaryLogger_test, LogBufferContainsTheMessageHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b3f7e91-c5a2-4d68-9e17-4a8d2c6b5f03");
+    BinaryLoggerSUT sut;
+
+    sut.createLogMessageHeader("file", 42, "function", LogLevel::Error);
+    sut.logString("hypnotoad");
+
+    const auto logBuffer = sut.getLogBuffer();
+    const std::string message{logBuffer.buffer, logBuffer.writeIndex};
+    EXPECT_THAT(message, HasSubstr(logLevelDisplayText(LogLevel::Error)));
+    EXPECT_THAT(message, EndsWith(": hypnotoad"));
+    sut.assumeFlushed();
+}
+
+TEST_F(BinaryLogger_test, TooLongMessagesAreTruncated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a93d1f60-7b2e-4c85-8e14-2f6c0d9b7a38");
+    BinaryLoggerSUT sut;
+    const std::string longString(5000U, 'x');
+
+    sut.createLogMessageHeader("file", 42, "function", LogLevel::Info);
+    sut.assumeFlushed();
+    sut.logString(longString.c_str());
+    sut.logDec(42);
+
+    const auto logBuffer = sut.getLogBuffer();
+    EXPECT_THAT(logBuffer.writeIndex, Gt(0U));
+    EXPECT_THAT(logBuffer.writeIndex, Lt(longString.size()));
+    EXPECT_THAT(std::string(logBuffer.buffer, logBuffer.writeIndex), Each(Eq('x')));
+    sut.assumeFlushed();
+}
+
+TEST_F(BinaryLogger_test, MessagesAreWrittenAsRecordsToTheLogFile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4b7c2d9-03f6-4a81-9d5e-7c1a8f2b6e40");
+    constexpr int FIRST_LINE{13};
+    constexpr int SECOND_LINE{73};
+    {
+        BinaryLoggerSUT sut;
+        ASSERT_TRUE(sut.openLogFile(m_logFilePath.c_str(), 4096U));
+
+        sut.createLogMessageHeader(__FILE__, FIRST_LINE, "function", LogLevel::Warn);
+        sut.logString("hypnotoad has ");
+        sut.logDec(3U);
+        sut.logString(" eyes");
+        sut.flush();
+
+        sut.createLogMessageHeader(__FILE__, SECOND_LINE, "function", LogLevel::Debug);
+        sut.logBool(true);
+        sut.flush();
+
+        EXPECT_THAT(sut.getNumberOfDroppedRecords(), Eq(0U));
+    }
+
+    uint64_t numberOfDroppedRecords{0U};
+    const auto records = readRecords(numberOfDroppedRecords);
+    EXPECT_THAT(numberOfDroppedRecords, Eq(0U));
+    ASSERT_THAT(records.size(), Eq(3U));
+
+    EXPECT_THAT(records[0].header.type, Eq(BinaryLogRecordType::FileName));
+    EXPECT_THAT(records[0].payload, StrEq(__FILE__));
+    const auto fileId = records[0].header.fileId;
+
+    EXPECT_THAT(records[1].header.type, Eq(BinaryLogRecordType::Message));
+    EXPECT_THAT(records[1].header.logLevel, Eq(LogLevel::Warn));
+    EXPECT_THAT(records[1].header.fileId, Eq(fileId));
+    EXPECT_THAT(records[1].header.line, Eq(static_cast<uint32_t>(FIRST_LINE)));
+    EXPECT_THAT(decode(records[1].payload), StrEq("hypnotoad has 3 eyes"));
+
+    EXPECT_THAT(records[2].header.type, Eq(BinaryLogRecordType::Message));
+    EXPECT_THAT(records[2].header.logLevel, Eq(LogLevel::Debug));
+    EXPECT_THAT(records[2].header.fileId, Eq(fileId));
+    EXPECT_THAT(records[2].header.line, Eq(static_cast<uint32_t>(SECOND_LINE)));
+    EXPECT_THAT(decode(records[2].payload), StrEq("true"));
+}
+
+TEST_F(BinaryLogger_test, RecordsAreDroppedWhenTheLogFileIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f28a4c1-96d3-4e0b-b5a7-1e3c9d6f8024");
+    constexpr uint64_t NUMBER_OF_MESSAGES{100U};
+    uint64_t numberOfDroppedRecords{0U};
+    {
+        BinaryLoggerSUT sut;
+        ASSERT_TRUE(sut.openLogFile(m_logFilePath.c_str(), sizeof(BinaryLogFileHeader) + 1024U));
+
+        for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+        {
+            sut.createLogMessageHeader(__FILE__, __LINE__, "function", LogLevel::Info);
+            sut.logString("message ");
+            sut.logDec(i);
+            sut.flush();
+        }
+
+        numberOfDroppedRecords = sut.getNumberOfDroppedRecords();
+    }
+
+    EXPECT_THAT(numberOfDroppedRecords, Gt(0U));
+
+    uint64_t numberOfDroppedRecordsInFile{0U};
+    const auto records = readRecords(numberOfDroppedRecordsInFile);
+    EXPECT_THAT(numberOfDroppedRecordsInFile, Eq(numberOfDroppedRecords));
+    constexpr uint64_t NUMBER_OF_FILE_NAME_RECORDS{1U};
+    ASSERT_THAT(records.size() + numberOfDroppedRecords, Eq(NUMBER_OF_MESSAGES + NUMBER_OF_FILE_NAME_RECORDS));
+    for (uint64_t i = NUMBER_OF_FILE_NAME_RECORDS; i < records.size(); ++i)
+    {
+        EXPECT_THAT(decode(records[i].payload),
+                    StrEq("message " + std::to_string(i - NUMBER_OF_FILE_NAME_RECORDS)));
+    }
+}
+
+TEST_F(BinaryLogger_test, ReopeningTheLogFileWhileOtherThreadsWriteToItIsSafe)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c47c3c30-09bb-4b90-a452-c1089c5eb6a7");
+    constexpr uint32_t NUMBER_OF_WRITERS{2U};
+    constexpr uint32_t NUMBER_OF_REOPENS{10U};
+    constexpr uint64_t LOG_FILE_SIZE{sizeof(BinaryLogFileHeader) + 4096U};
+    BinaryLoggerSUT sut;
+    ASSERT_TRUE(sut.openLogFile(m_logFilePath.c_str(), LOG_FILE_SIZE));
+
+    std::atomic<bool> keepWriting{true};
+    std::vector<std::thread> writers;
+    for (uint32_t i = 0U; i < NUMBER_OF_WRITERS; ++i)
+    {
+        writers.emplace_back([&] {
+            while (keepWriting)
+            {
+                sut.createLogMessageHeader(__FILE__, __LINE__, "function", LogLevel::Info);
+                sut.logString("hypnotoad");
+                sut.flush();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+    }
+
+    // the log file is truncated and unmapped while the writers may still write to it
+    for (uint32_t i = 0U; i < NUMBER_OF_REOPENS; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        EXPECT_TRUE(sut.openLogFile(m_logFilePath.c_str(), LOG_FILE_SIZE));
+    }
+
+    keepWriting = false;
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    uint64_t numberOfDroppedRecords{0U};
+    const auto records = readRecords(numberOfDroppedRecords);
+    for (const auto& record : records)
+    {
+        if (record.header.type == BinaryLogRecordType::Message)
+        {
+            EXPECT_THAT(decode(record.payload), StrEq("hypnotoad"));
+        }
+    }
+}
+
+TEST_F(BinaryLogger_test, RecordsOfInterruptedWritersAreSkipped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3dc61f82-cefa-41fa-a5ba-a52c56c114fd");
+    const std::string firstPayload{"first"};
+    const std::string secondPayload{"second"};
+    constexpr uint64_t INTERRUPTED_PAYLOAD_SIZE{11U};
+    const auto completeRecordSize = [](const std::string& payload) {
+        return static_cast<uint32_t>(sizeof(BinaryLogRecordHeader) + payload.size());
+    };
+    const auto interruptedRecordSize = static_cast<uint32_t>(sizeof(BinaryLogRecordHeader) + INTERRUPTED_PAYLOAD_SIZE);
+
+    // a complete record, the zero filled space of a writer which was interrupted before it wrote the header, the
+    // space of a writer which was interrupted after it wrote the size and another complete record
+    const uint64_t firstOffset{0U};
+    const uint64_t withoutHeaderOffset{firstOffset + alignedBinaryLogRecordSize(completeRecordSize(firstPayload))};
+    const uint64_t incompleteOffset{withoutHeaderOffset + alignedBinaryLogRecordSize(interruptedRecordSize)};
+    const uint64_t secondOffset{incompleteOffset + alignedBinaryLogRecordSize(interruptedRecordSize)};
+    const uint64_t recordsEnd{secondOffset + alignedBinaryLogRecordSize(completeRecordSize(secondPayload))};
+    std::vector<char> logRecords(recordsEnd, 0);
+
+    BinaryLogRecordHeader header{};
+    header.type = BinaryLogRecordType::Message;
+    header.size = completeRecordSize(firstPayload);
+    std::memcpy(&logRecords[firstOffset], &header, sizeof(header));
+    std::memcpy(&logRecords[firstOffset + sizeof(header)], firstPayload.data(), firstPayload.size());
+
+    BinaryLogRecordHeader incompleteHeader{};
+    incompleteHeader.type = BinaryLogRecordType::Incomplete;
+    incompleteHeader.size = interruptedRecordSize;
+    std::memcpy(&logRecords[incompleteOffset], &incompleteHeader, sizeof(incompleteHeader));
+
+    header.size = completeRecordSize(secondPayload);
+    std::memcpy(&logRecords[secondOffset], &header, sizeof(header));
+    std::memcpy(&logRecords[secondOffset + sizeof(header)], secondPayload.data(), secondPayload.size());
+
+    std::vector<std::string> payloads;
+    forEachBinaryLogRecord(
+        logRecords.data(), recordsEnd, [&](const BinaryLogRecordHeader&, const char* payload, const uint64_t size) {
+            payloads.emplace_back(payload, size);
+        });
+
+    ASSERT_THAT(payloads.size(), Eq(2U));
+    EXPECT_THAT(payloads[0], StrEq(firstPayload));
+    EXPECT_THAT(payloads[1], StrEq(secondPayload));
+}
+
+TEST_F(BinaryLogger_test, OpeningTheLogFileFailsForInvalidPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c61e5b08-4d97-4f2a-a3c0-8b5f7e2d1a96");
+    BinaryLoggerSUT sut;
+
+    EXPECT_FALSE(sut.openLogFile("/iceoryx/does/not/exist/log.blog", 4096U));
+    EXPECT_THAT(sut.getNumberOfDroppedRecords(), Eq(0U));
+}
+
+} // namespace
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/rate_limiter.hpp"
+#include "iox/logging.hpp"
+
+#include "iceoryx_hoofs/testing/testing_logger.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::log;
+
+constexpr uint64_t LONG_INTERVAL_MS{60U * 60U * 1000U};
+constexpr uint64_t SHORT_INTERVAL_MS{50U};
+
+TEST(RateLimiter_test, FirstOccurrenceIsEmitted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b2e8f14-3c7a-4d95-a0e1-58f4b9c2d763");
+    RateLimiter sut{LONG_INTERVAL_MS};
+
+    uint64_t numberOfSuppressedOccurrences{42U};
+    EXPECT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    EXPECT_THAT(numberOfSuppressedOccurrences, Eq(0U));
+}
+
+TEST(RateLimiter_test, OccurrencesWithinIntervalAreSuppressed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4a91c57-8d26-4f3b-b7c0-2f65d8a13e94");
+    RateLimiter sut{LONG_INTERVAL_MS};
+
+    uint64_t numberOfSuppressedOccurrences{0U};
+    ASSERT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    for (uint32_t i = 0U; i < 10U; ++i)
+    {
+        EXPECT_FALSE(sut.tryEmit(numberOfSuppressedOccurrences));
+    }
+}
+
+TEST(RateLimiter_test, OccurrenceAfterIntervalIsEmittedWithNumberOfSuppressedOccurrences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f8c3d6a-5b47-4e29-9a0d-c37e2b84f615");
+    constexpr uint64_t NUMBER_OF_SUPPRESSED_OCCURRENCES{5U};
+    RateLimiter sut{SHORT_INTERVAL_MS};
+
+    uint64_t numberOfSuppressedOccurrences{0U};
+    ASSERT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    for (uint64_t i = 0U; i < NUMBER_OF_SUPPRESSED_OCCURRENCES; ++i)
+    {
+        EXPECT_FALSE(sut.tryEmit(numberOfSuppressedOccurrences));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * SHORT_INTERVAL_MS));
+
+    EXPECT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    EXPECT_THAT(numberOfSuppressedOccurrences, Eq(NUMBER_OF_SUPPRESSED_OCCURRENCES));
+}
+
+TEST(RateLimiter_test, SuppressedOccurrencesAreFlushedAfterInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5e7320b-bbba-40e3-ac11-20e3881a8283");
+    constexpr uint64_t NUMBER_OF_SUPPRESSED_OCCURRENCES{3U};
+    RateLimiter sut{SHORT_INTERVAL_MS};
+
+    uint64_t numberOfSuppressedOccurrences{0U};
+    ASSERT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    for (uint64_t i = 0U; i < NUMBER_OF_SUPPRESSED_OCCURRENCES; ++i)
+    {
+        EXPECT_FALSE(sut.tryEmit(numberOfSuppressedOccurrences));
+    }
+    EXPECT_FALSE(sut.tryFlush(numberOfSuppressedOccurrences));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * SHORT_INTERVAL_MS));
+
+    ASSERT_TRUE(sut.tryFlush(numberOfSuppressedOccurrences));
+    EXPECT_THAT(numberOfSuppressedOccurrences, Eq(NUMBER_OF_SUPPRESSED_OCCURRENCES));
+    // the flush starts a new interval
+    EXPECT_FALSE(sut.tryEmit(numberOfSuppressedOccurrences));
+}
+
+TEST(RateLimiter_test, FlushWithoutSuppressedOccurrencesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88c813af-1956-478a-9624-24dd69ba1d2f");
+    RateLimiter sut{SHORT_INTERVAL_MS};
+
+    uint64_t numberOfSuppressedOccurrences{0U};
+    ASSERT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * SHORT_INTERVAL_MS));
+
+    EXPECT_FALSE(sut.tryFlush(numberOfSuppressedOccurrences));
+    EXPECT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+}
+
+TEST(RateLimiter_test, ZeroIntervalEmitsEveryOccurrence)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a07d5e92-64b1-4c8f-8e3a-9b12f6c04d58");
+    RateLimiter sut{0U};
+
+    for (uint32_t i = 0U; i < 10U; ++i)
+    {
+        uint64_t numberOfSuppressedOccurrences{42U};
+        EXPECT_TRUE(sut.tryEmit(numberOfSuppressedOccurrences));
+        EXPECT_THAT(numberOfSuppressedOccurrences, Eq(0U));
+    }
+}
+
+TEST(LoggingRateLimited_test, OnlyFirstMessageWithinIntervalIsLogged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5b3a8e1-0f29-4d76-b41e-7e8d92a6f0c3");
+    dynamic_cast<iox::testing::TestingLogger&>(Logger::get()).clearLogBuffer();
+
+    for (uint32_t i = 0U; i < 10U; ++i)
+    {
+        IOX_LOG_RATE_LIMITED(Error, LONG_INTERVAL_MS, "hypnotoad #" << i);
+    }
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(LogLevel::Error, [](const auto& logMessages) {
+        ASSERT_THAT(logMessages.size(), Eq(1U));
+        EXPECT_THAT(logMessages[0], HasSubstr("hypnotoad #0"));
+        EXPECT_THAT(logMessages[0], Not(HasSubstr("suppressed")));
+    });
+}
+
+TEST(LoggingRateLimited_test, NumberOfSuppressedMessagesIsAppendedToNextMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e6f1b4d-27c3-4a90-95d8-3b0c7a1e5f26");
+    dynamic_cast<iox::testing::TestingLogger&>(Logger::get()).clearLogBuffer();
+
+    // a single call site is required to share the rate limiter
+    auto logRateLimited = [](const uint32_t i) { IOX_LOG_RATE_LIMITED(Error, SHORT_INTERVAL_MS, "brain slug #" << i); };
+
+    logRateLimited(0U);
+    logRateLimited(1U);
+    logRateLimited(2U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * SHORT_INTERVAL_MS));
+    logRateLimited(3U);
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(LogLevel::Error, [](const auto& logMessages) {
+        ASSERT_THAT(logMessages.size(), Eq(2U));
+        EXPECT_THAT(logMessages[0], HasSubstr("brain slug #0"));
+        EXPECT_THAT(logMessages[1], HasSubstr("brain slug #3"));
+        EXPECT_THAT(logMessages[1], HasSubstr("[2 similar messages suppressed]"));
+    });
+}
+
+TEST(LoggingRateLimited_test, SuppressedMessagesAreLoggedWhenTheIntervalElapsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a05307e4-719c-4f54-8604-a69f889b4b72");
+
+    // a single call site is required to share the rate limiter
+    auto logRateLimited = [](const uint32_t i) { IOX_LOG_RATE_LIMITED(Error, SHORT_INTERVAL_MS, "nibbler #" << i); };
+
+    for (uint32_t i = 0U; i < 5U; ++i)
+    {
+        logRateLimited(i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * SHORT_INTERVAL_MS));
+    dynamic_cast<iox::testing::TestingLogger&>(Logger::get()).clearLogBuffer();
+
+    RateLimiter::flushSuppressedOccurrences();
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(LogLevel::Error, [](const auto& logMessages) {
+        EXPECT_THAT(logMessages, Contains(HasSubstr("[4 similar messages suppressed]")));
+    });
+}
+
+} // namespace
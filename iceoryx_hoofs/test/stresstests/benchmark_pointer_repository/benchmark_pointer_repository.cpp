@@ -0,0 +1,116 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/logging.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+constexpr uint64_t SEGMENT_SIZE{4096U};
+constexpr uint64_t MAX_NUMBER_OF_SEGMENTS{100U};
+
+struct FreeDeleter
+{
+    void operator()(void* ptr) const noexcept
+    {
+        free(ptr);
+    }
+};
+
+/// @brief memory which is split into segments that are registered at the pointer repository of the relative pointer
+/// like the shared memory segments an application maps
+template <uint64_t NumberOfSegments>
+class RegisteredSegments
+{
+  public:
+    static RegisteredSegments& instance() noexcept
+    {
+        static RegisteredSegments segments;
+        return segments;
+    }
+
+    /// @brief returns a pointer into one of the segments; every call returns a pointer into the next segment
+    void* nextPointer() noexcept
+    {
+        m_segmentIndex = (m_segmentIndex + 1U) % NumberOfSegments;
+        return static_cast<uint8_t*>(m_memory.get()) + (m_segmentIndex * SEGMENT_SIZE) + (SEGMENT_SIZE / 2U);
+    }
+
+  private:
+    RegisteredSegments() noexcept
+    {
+        static_assert(NumberOfSegments <= MAX_NUMBER_OF_SEGMENTS, "Too many segments requested");
+
+        iox::UntypedRelativePointer::unregisterAll();
+        m_memory.reset(malloc(NumberOfSegments * SEGMENT_SIZE));
+        // register the segments in an order which differs from their address order
+        for (uint64_t i = 0U; i < NumberOfSegments; ++i)
+        {
+            const uint64_t segmentIndex{(i * 7U + 3U) % NumberOfSegments};
+            if (!iox::UntypedRelativePointer::registerPtrWithId(
+                    iox::segment_id_t{i + 1U},
+                    static_cast<uint8_t*>(m_memory.get()) + (segmentIndex * SEGMENT_SIZE),
+                    SEGMENT_SIZE))
+            {
+                std::abort();
+            }
+        }
+    }
+
+    std::unique_ptr<void, FreeDeleter> m_memory;
+    uint64_t m_segmentIndex{0U};
+};
+
+/// @brief converts a raw pointer into a relative pointer like it is done for every chunk which is delivered to a
+/// subscriber queue
+template <uint64_t NumberOfSegments>
+uint64_t searchSegmentId()
+{
+    auto& sut = RegisteredSegments<NumberOfSegments>::instance();
+    return iox::UntypedRelativePointer::searchId(sut.nextPointer());
+}
+
+template <uint64_t NumberOfSegments>
+void performBenchmarks(const iox::units::Duration& timeout)
+{
+    RegisteredSegments<NumberOfSegments>::instance();
+    std::cout << "number of registered segments: " << NumberOfSegments << std::endl;
+    BENCHMARK(searchSegmentId<NumberOfSegments>, timeout);
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    performBenchmarks<1U>(timeout);
+    performBenchmarks<2U>(timeout);
+    performBenchmarks<5U>(timeout);
+    performBenchmarks<10U>(timeout);
+    performBenchmarks<20U>(timeout);
+    performBenchmarks<50U>(timeout);
+    performBenchmarks<MAX_NUMBER_OF_SEGMENTS>(timeout);
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/test.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/mpmc_loffli.hpp"
+
+using namespace ::testing;
+
+#include "iceoryx_hoofs/testing/barrier.hpp"
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using iox::concurrent::MpmcLoFFLi;
+
+Barrier g_barrier;
+
+constexpr uint32_t CAPACITY{1024U};
+constexpr uint32_t MAX_BATCH_SIZE{16U};
+
+class MpmcLoFFLiStressTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_loffli.init(&m_loffliMemory[0], CAPACITY);
+        for (auto& owner : m_owner)
+        {
+            owner.store(false);
+        }
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for MpmcLoFFLi::init
+    MpmcLoFFLi::Index_t m_loffliMemory[MpmcLoFFLi::requiredIndexMemorySize(CAPACITY)]{0};
+    MpmcLoFFLi m_loffli;
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) one ownership flag per index
+    iox::concurrent::Atomic<bool> m_owner[CAPACITY];
+};
+
+/// @brief acquires the ownership of the popped indices; an index which is already owned by another thread means
+/// that the free-list handed out the same index twice
+bool takeOwnership(iox::concurrent::Atomic<bool>* owner, const std::vector<uint32_t>& indices, const uint32_t count)
+{
+    bool success = true;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by the capacity
+        if (indices[i] >= CAPACITY || owner[indices[i]].exchange(true))
+        {
+            success = false;
+        }
+    }
+    return success;
+}
+
+void releaseOwnership(iox::concurrent::Atomic<bool>* owner, const std::vector<uint32_t>& indices, const uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by the capacity
+        owner[indices[i]].store(false);
+    }
+}
+
+/// @brief alternates randomly between the single and the batched pop and push operations and only pushes what was
+/// previously popped by the same thread
+void work(MpmcLoFFLi& loffli,
+          iox::concurrent::Atomic<bool>* owner,
+          iox::concurrent::Atomic<bool>& run,
+          uint32_t seed,
+          bool& testResult)
+{
+    std::default_random_engine randomEngine(seed);
+    std::uniform_int_distribution<uint32_t> batchSizeDistribution(1U, MAX_BATCH_SIZE);
+    std::bernoulli_distribution useBatchDistribution(0.5);
+
+    std::vector<uint32_t> indices(MAX_BATCH_SIZE, 0U);
+    bool success = true;
+
+    g_barrier.notify();
+
+    while (run)
+    {
+        uint32_t numberOfIndices{0U};
+        if (useBatchDistribution(randomEngine))
+        {
+            numberOfIndices = loffli.popN(indices.data(), batchSizeDistribution(randomEngine));
+        }
+        else if (loffli.pop(indices[0]))
+        {
+            numberOfIndices = 1U;
+        }
+
+        success = takeOwnership(owner, indices, numberOfIndices) && success;
+        releaseOwnership(owner, indices, numberOfIndices);
+
+        if (useBatchDistribution(randomEngine))
+        {
+            success = loffli.pushN(indices.data(), numberOfIndices) && success;
+        }
+        else
+        {
+            for (uint32_t i = 0U; i < numberOfIndices; ++i)
+            {
+                success = loffli.push(indices[i]) && success;
+            }
+        }
+    }
+
+    testResult = success;
+}
+
+///@brief Tests concurrent operation of multiple threads which pop and push single indices and batches of indices.
+/// Each popped index must be owned by exactly one thread and after the test all indices must be available exactly
+/// once in the free-list.
+TEST_F(MpmcLoFFLiStressTest, TimedMultiThreadedPopNAndPushN)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e4d2a9-1c63-4f05-8e9a-3d6f0b2c8a71");
+    std::chrono::seconds runtime(5);
+    constexpr uint32_t NUMBER_OF_THREADS{16U};
+
+    g_barrier.reset(NUMBER_OF_THREADS);
+
+    iox::concurrent::Atomic<bool> run{true};
+    std::vector<std::thread> threads;
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) std::vector<bool> is not addressable
+    bool testResults[NUMBER_OF_THREADS]{};
+
+    std::random_device randomDevice;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back(work,
+                             std::ref(m_loffli),
+                             &m_owner[0],
+                             std::ref(run),
+                             randomDevice(),
+                             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) i < NUMBER_OF_THREADS
+                             std::ref(testResults[i]));
+    }
+
+    g_barrier.wait();
+    std::this_thread::sleep_for(runtime);
+
+    run = false;
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto testResult : testResults)
+    {
+        EXPECT_TRUE(testResult);
+    }
+
+    // check whether all indices are there, but there is no specific ordering we can expect
+    std::vector<uint32_t> count(CAPACITY, 0U);
+    std::vector<uint32_t> indices(MAX_BATCH_SIZE, 0U);
+    uint32_t numberOfIndices = m_loffli.popN(indices.data(), MAX_BATCH_SIZE);
+    while (numberOfIndices > 0U)
+    {
+        for (uint32_t i = 0U; i < numberOfIndices; ++i)
+        {
+            ASSERT_THAT(indices[i], Lt(CAPACITY));
+            count[indices[i]]++;
+        }
+        numberOfIndices = m_loffli.popN(indices.data(), MAX_BATCH_SIZE);
+    }
+
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        // missing or duplicate indices indicate an error
+        EXPECT_THAT(count[i], Eq(1U));
+    }
+}
+} // namespace
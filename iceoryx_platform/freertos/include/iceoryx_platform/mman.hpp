@@ -19,6 +19,7 @@
 #ifndef IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
 
+#include <cstdint>
 #include <sys/types.h>
 
 #define MAP_SHARED 0x01
@@ -36,4 +37,10 @@ int iox_shm_close(int fd);
 void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset);
 int munmap(void* addr, size_t length);
 
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+size_t iox_huge_page_size(void);
+int iox_shm_is_backed_by_huge_pages(const void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_shm_bind_to_numa_node(void* addr, size_t length, uint32_t node);
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
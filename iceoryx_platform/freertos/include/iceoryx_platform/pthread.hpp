@@ -22,6 +22,8 @@
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/types.hpp"
 
+#include <cerrno>
+#include <cstdint>
 #include <sched.h>
 
 #include "FreeRTOS.h"
@@ -148,4 +150,16 @@ inline iox_pthread_t iox_pthread_self()
     return {};
 }
 
+inline int iox_pthread_setaffinity(iox_pthread_t, uint32_t)
+{
+    // Not supported on FreeRTOS
+    return ENOSYS;
+}
+
+inline int iox_pthread_getaffinity(iox_pthread_t, uint32_t*, uint32_t, uint32_t*)
+{
+    // Not supported on FreeRTOS
+    return ENOSYS;
+}
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
@@ -86,3 +86,31 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+size_t iox_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_is_backed_by_huge_pages(const void*, size_t)
+{
+    return 0;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_shm_bind_to_numa_node(void*, size_t, uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -44,11 +44,15 @@ int iox_ftruncate(int fd, off_t length)
     return iter->ftruncate(length) ? 0 : -1;
 }
 
-long iox_sysconf(int)
+long iox_sysconf(int name)
 {
-    // This is only ever used to find the page size. Lets just return 4 kB as usual, even though there is no paging on
-    // FreeRTOS
-    return 4096;
+    if (name == IOX_SC_PAGESIZE)
+    {
+        // Lets just return 4 kB as usual, even though there is no paging on FreeRTOS
+        return 4096;
+    }
+    // there is no proc filesystem on FreeRTOS, hence the clock ticks for the process statistics are not needed
+    return 0;
 }
 
 int iox_fchown(int, iox_uid_t, iox_gid_t)
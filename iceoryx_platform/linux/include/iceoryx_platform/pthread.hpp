@@ -17,7 +17,10 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
+#include <sched.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
 #define IOX_PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
@@ -131,4 +134,40 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+inline int iox_pthread_setaffinity(iox_pthread_t thread, uint32_t cpu)
+{
+    if (cpu >= CPU_SETSIZE)
+    {
+        return EINVAL;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+}
+
+inline int iox_pthread_getaffinity(iox_pthread_t thread, uint32_t* cpus, uint32_t capacity, uint32_t* numberOfCpus)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    const int result = pthread_getaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+    if (result != 0)
+    {
+        return result;
+    }
+
+    uint32_t count{0U};
+    for (uint32_t cpu = 0U; cpu < CPU_SETSIZE && count < capacity; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &cpuSet))
+        {
+            cpus[count] = cpu;
+            ++count;
+        }
+    }
+    *numberOfCpus = count;
+    return 0;
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
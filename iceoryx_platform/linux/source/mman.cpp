@@ -16,6 +16,11 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +39,152 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_shm_advise_huge_pages(void* addr, size_t length)
+{
+#ifdef MADV_HUGEPAGE
+    // the advice is accepted even if the kernel never uses huge pages for shared memory, therefore the
+    // configuration is checked explicitly to report whether huge pages will actually be used
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/shmem_enabled", "r");
+    if (file == nullptr)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char shmemEnabled[128]{};
+    const bool isRead = fgets(&shmemEnabled[0], sizeof(shmemEnabled), file) != nullptr;
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    fclose(file);
+    if (!isRead || strstr(&shmemEnabled[0], "[never]") != nullptr || strstr(&shmemEnabled[0], "[deny]") != nullptr)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    return madvise(addr, length, MADV_HUGEPAGE);
+#else
+    (void)addr;
+    (void)length;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+size_t iox_huge_page_size(void)
+{
+    // NOLINTJUSTIFICATION the kernel reports the size of a transparent huge page only via sysfs
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (file == nullptr)
+    {
+        return 0U;
+    }
+
+    unsigned long long hugePageSize{0U};
+    // NOLINTJUSTIFICATION fscanf is the simplest way to read a single number from sysfs
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cert-err34-c)
+    if (fscanf(file, "%llu", &hugePageSize) != 1)
+    {
+        hugePageSize = 0U;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    fclose(file);
+
+    return static_cast<size_t>(hugePageSize);
+}
+
+int iox_shm_is_backed_by_huge_pages(const void* addr, size_t length)
+{
+    (void)length;
+    // the madvise is only a hint, therefore the mapping is looked up in smaps to check whether the touched memory is
+    // actually backed by huge pages
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    FILE* file = fopen("/proc/self/smaps", "r");
+    if (file == nullptr)
+    {
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the address is compared with the mapping ranges
+    const auto address = reinterpret_cast<uintptr_t>(addr);
+    bool isInMapping{false};
+    unsigned long long hugePageBackedSize{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char line[512]{};
+    while (fgets(&line[0], sizeof(line), file) != nullptr)
+    {
+        unsigned long long begin{0U};
+        unsigned long long end{0U};
+        // NOLINTJUSTIFICATION sscanf is the simplest way to parse the address range of a mapping
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cert-err34-c)
+        if (sscanf(&line[0], "%llx-%llx ", &begin, &end) == 2)
+        {
+            if (isInMapping)
+            {
+                break;
+            }
+            isInMapping = begin <= address && address < end;
+            continue;
+        }
+
+        if (!isInMapping)
+        {
+            continue;
+        }
+
+        // tmpfs reports the huge pages of a mapping as 'ShmemPmdMapped' or, with newer kernels, as 'FilePmdMapped'
+        unsigned long long size{0U};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cert-err34-c)
+        if (sscanf(&line[0], "ShmemPmdMapped: %llu kB", &size) == 1)
+        {
+            hugePageBackedSize += size;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cert-err34-c)
+        else if (sscanf(&line[0], "FilePmdMapped: %llu kB", &size) == 1)
+        {
+            hugePageBackedSize += size;
+        }
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    fclose(file);
+
+    return (hugePageBackedSize > 0U) ? 1 : 0;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_shm_bind_to_numa_node(void* addr, size_t length, uint32_t node)
+{
+#ifdef SYS_mbind
+    // the mask supports the same number of nodes as the default kernel configuration
+    constexpr uint32_t MAX_NUMBER_OF_NUMA_NODES{1024U};
+    constexpr uint32_t BITS_PER_MASK_ENTRY{sizeof(unsigned long) * 8U};
+    if (node >= MAX_NUMBER_OF_NUMA_NODES)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    unsigned long nodeMask[MAX_NUMBER_OF_NUMA_NODES / BITS_PER_MASK_ENTRY]{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is checked above
+    nodeMask[node / BITS_PER_MASK_ENTRY] = 1UL << (node % BITS_PER_MASK_ENTRY);
+
+    // the syscall is used directly to avoid a dependency to libnuma
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    return static_cast<int>(syscall(
+        SYS_mbind, addr, length, MPOL_BIND, &nodeMask[0], MAX_NUMBER_OF_NUMA_NODES + 1U, MPOL_MF_MOVE | MPOL_MF_STRICT));
+#else
+    (void)addr;
+    (void)length;
+    (void)node;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
@@ -115,4 +116,8 @@ int iox_pthread_join(iox_pthread_t thread, void** retval);
 
 iox_pthread_t iox_pthread_self();
 
+int iox_pthread_setaffinity(iox_pthread_t thread, uint32_t cpu);
+
+int iox_pthread_getaffinity(iox_pthread_t thread, uint32_t* cpus, uint32_t capacity, uint32_t* numberOfCpus);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
@@ -23,6 +23,7 @@
 
 #define IOX_SEEK_SET SEEK_SET
 #define IOX_SC_PAGESIZE _SC_PAGESIZE
+#define IOX_SC_CLK_TCK _SC_CLK_TCK
 
 using iox_off_t = off_t;
 
@@ -17,6 +17,7 @@
 
 #include "iceoryx_platform/pthread.hpp"
 
+#include <cerrno>
 #include <map>
 #include <mutex>
 #include <string>
@@ -71,6 +72,18 @@ iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+int iox_pthread_setaffinity(iox_pthread_t, uint32_t)
+{
+    // macOS supports only affinity tags as hint for the scheduler but no pinning to a CPU
+    return ENOSYS;
+}
+
+int iox_pthread_getaffinity(iox_pthread_t, uint32_t*, uint32_t, uint32_t*)
+{
+    // macOS supports only affinity tags as hint for the scheduler but no pinning to a CPU
+    return ENOSYS;
+}
+
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int)
 {
     return 0;
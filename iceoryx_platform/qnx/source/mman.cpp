@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
 #include <unistd.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode)
@@ -32,3 +33,30 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+size_t iox_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_is_backed_by_huge_pages(const void*, size_t)
+{
+    return 0;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_shm_bind_to_numa_node(void*, size_t, uint32_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
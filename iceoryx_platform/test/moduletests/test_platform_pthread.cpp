@@ -0,0 +1,73 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/pthread.hpp"
+
+#include "test.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+TEST(PTHREAD_test, SetAffinityToNonExistingCpuFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ea79ad0-33f5-4a9c-aa45-efb15fe5983c");
+
+    int result{0};
+    std::thread t([&] { result = iox_pthread_setaffinity(iox_pthread_self(), std::numeric_limits<uint32_t>::max()); });
+    t.join();
+
+    EXPECT_THAT(result, AnyOf(Eq(EINVAL), Eq(ENOSYS)));
+}
+
+TEST(PTHREAD_test, PinnedThreadIsOnlyAllowedToRunOnThePinnedCpu)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "890b984d-b58b-4cad-a9a3-c52cceda9a75");
+
+    constexpr uint32_t CAPACITY{1024U};
+    std::vector<uint32_t> allowedCpus(CAPACITY);
+    uint32_t numberOfAllowedCpus{0U};
+    uint32_t pinnedCpu{0U};
+    int getResult{0};
+    int setResult{0};
+    std::thread t([&] {
+        getResult = iox_pthread_getaffinity(iox_pthread_self(), allowedCpus.data(), CAPACITY, &numberOfAllowedCpus);
+        if (getResult != 0 || numberOfAllowedCpus == 0U)
+        {
+            return;
+        }
+        pinnedCpu = allowedCpus[numberOfAllowedCpus - 1U];
+        setResult = iox_pthread_setaffinity(iox_pthread_self(), pinnedCpu);
+        getResult = iox_pthread_getaffinity(iox_pthread_self(), allowedCpus.data(), CAPACITY, &numberOfAllowedCpus);
+    });
+    t.join();
+
+    if (getResult == ENOSYS)
+    {
+        GTEST_SKIP() << "The thread affinity is not supported on this platform";
+    }
+    ASSERT_THAT(getResult, Eq(0));
+    ASSERT_THAT(setResult, Eq(0));
+    ASSERT_THAT(numberOfAllowedCpus, Eq(1U));
+    EXPECT_THAT(allowedCpus[0], Eq(pinnedCpu));
+}
+} // namespace
@@ -17,10 +17,17 @@
 #ifndef IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
 
+#include <cstdint>
 #include <sys/mman.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+size_t iox_huge_page_size(void);
+int iox_shm_is_backed_by_huge_pages(const void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_shm_bind_to_numa_node(void* addr, size_t length, uint32_t node);
+
 #endif // IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_UNIX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_UNIX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
@@ -131,4 +133,16 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+inline int iox_pthread_setaffinity(iox_pthread_t, uint32_t)
+{
+    // Not supported on this platform
+    return ENOSYS;
+}
+
+inline int iox_pthread_getaffinity(iox_pthread_t, uint32_t*, uint32_t, uint32_t*)
+{
+    // Not supported on this platform
+    return ENOSYS;
+}
+
 #endif // IOX_HOOFS_UNIX_PLATFORM_PTHREAD_HPP
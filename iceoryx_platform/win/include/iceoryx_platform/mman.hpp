@@ -22,6 +22,7 @@
 #include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
 
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <sys/stat.h>
@@ -51,4 +52,11 @@ int iox_shm_close(int fd);
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
+
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+size_t iox_huge_page_size(void);
+int iox_shm_is_backed_by_huge_pages(const void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_shm_bind_to_numa_node(void* addr, size_t length, uint32_t node);
+
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
@@ -21,6 +21,7 @@
 #include "iceoryx_platform/win32_errorHandling.hpp"
 #include "iceoryx_platform/windows.hpp"
 
+#include <cstdint>
 #include <thread>
 #include <type_traits>
 
@@ -75,5 +76,7 @@ int iox_pthread_getname_np(iox_pthread_t thread, char* name, size_t len);
 int iox_pthread_create(iox_pthread_t* thread, const iox_pthread_attr_t* attr, void* (*start_routine)(void*), void* arg);
 int iox_pthread_join(iox_pthread_t thread, void** retval);
 iox_pthread_t iox_pthread_self();
+int iox_pthread_setaffinity(iox_pthread_t thread, uint32_t cpu);
+int iox_pthread_getaffinity(iox_pthread_t thread, uint32_t* cpus, uint32_t capacity, uint32_t* numberOfCpus);
 
 #endif // IOX_HOOFS_WIN_PLATFORM_PTHREAD_HPP
@@ -27,6 +27,7 @@
 
 #define IOX_SEEK_SET SEEK_SET
 #define IOX_SC_PAGESIZE 1
+#define IOX_SC_CLK_TCK 2
 #ifndef STDOUT_FILENO
 #define STDOUT_FILENO 1
 #endif
@@ -26,6 +26,8 @@
 #include <sstream>
 #include <string>
 
+#include <cerrno>
+
 static std::map<int, std::string> handle2segment;
 static std::set<std::string> openedSharedMemorySegments;
 static std::mutex openedSharedMemorySegmentsMutex;
@@ -266,3 +268,31 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+size_t iox_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_is_backed_by_huge_pages(const void*, size_t)
+{
+    return 0;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_shm_bind_to_numa_node(void*, size_t, uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -20,6 +20,7 @@
 #include "iceoryx_platform/win32_errorHandling.hpp"
 #include "iceoryx_platform/windows.hpp"
 
+#include <cerrno>
 #include <cwchar>
 #include <sstream>
 #include <vector>
@@ -110,6 +111,42 @@ iox_pthread_t iox_pthread_self()
     return GetCurrentThread();
 }
 
+int iox_pthread_setaffinity(iox_pthread_t thread, uint32_t cpu)
+{
+    constexpr uint32_t NUMBER_OF_CPUS_IN_MASK{sizeof(DWORD_PTR) * 8U};
+    if (cpu >= NUMBER_OF_CPUS_IN_MASK)
+    {
+        return EINVAL;
+    }
+
+    return Win32Call(SetThreadAffinityMask, thread, static_cast<DWORD_PTR>(1U) << cpu).error;
+}
+
+int iox_pthread_getaffinity(iox_pthread_t, uint32_t* cpus, uint32_t capacity, uint32_t* numberOfCpus)
+{
+    // Windows cannot query the affinity of a thread, hence the affinity of the process is used
+    DWORD_PTR processMask{0U};
+    DWORD_PTR systemMask{0U};
+    auto result = Win32Call(GetProcessAffinityMask, GetCurrentProcess(), &processMask, &systemMask).error;
+    if (result != 0)
+    {
+        return result;
+    }
+
+    constexpr uint32_t NUMBER_OF_CPUS_IN_MASK{sizeof(DWORD_PTR) * 8U};
+    uint32_t count{0U};
+    for (uint32_t cpu = 0U; cpu < NUMBER_OF_CPUS_IN_MASK && count < capacity; ++cpu)
+    {
+        if ((processMask & (static_cast<DWORD_PTR>(1U) << cpu)) != 0U)
+        {
+            cpus[count] = cpu;
+            ++count;
+        }
+    }
+    *numberOfCpus = count;
+    return 0;
+}
+
 int iox_pthread_mutexattr_destroy(iox_pthread_mutexattr_t* attr)
 {
     return 0;
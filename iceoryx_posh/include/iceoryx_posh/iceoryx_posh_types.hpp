@@ -70,11 +70,14 @@ constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+// Latency measurement of the connections to publishers with 'PublisherOptions::measureLatency'
+constexpr uint32_t MAX_LATENCY_HISTOGRAMS = 128U;
+constexpr uint32_t MAX_LATENCY_HISTOGRAMS_PER_SUBSCRIBER = 4U;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
-// 1x publisherPort process introspection
+// 2x publisherPort process introspection
 // 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
@@ -111,6 +114,7 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKERS_PER_LISTENER = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -289,7 +293,16 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
+/// @brief Maximum time the discovery loop of RouDi waits; changed ports wake up the loop immediately, the interval is
+/// only needed for the process monitoring
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief Default interval of the introspection topics; an interval of 0 disables the periodic publishing
+constexpr units::Duration INTROSPECTION_DEFAULT_INTERVAL = 1_s;
+/// @brief Every n-th sample of the port throughput introspection contains all ports, also the unchanged ones
+constexpr uint64_t INTROSPECTION_THROUGHPUT_KEYFRAME_INTERVAL{10U};
+/// @brief Default number of processes whose CPU, memory and context switch statistics are sampled per interval of the
+/// process introspection; 0 disables the sampling
+constexpr uint32_t PROCESS_STATISTICS_DEFAULT_SAMPLES_PER_INTERVAL{16U};
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
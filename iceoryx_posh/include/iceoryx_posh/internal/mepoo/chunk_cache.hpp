@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/relative_pointer.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+
+/// @brief A cache of free chunks in front of the free lists of the mempools of a MemoryManager. The chunks are
+/// acquired in batches from the shared, lock-free free lists, which reduces the contention on them when many
+/// publishers loan chunks from the same mempools concurrently.
+/// The cache is intended to be a member of the port data in the shared memory, therefore RouDi is able to return the
+/// cached chunks to the mempools with 'drain' when the owning process terminates.
+/// @note The ChunkCache is not thread-safe and must only be used by the owner of the port
+class ChunkCache
+{
+  public:
+    /// @brief the maximum number of chunks which can be cached per mempool
+    static constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{8U};
+    /// @brief the chunk management pool is cached after the mempools of the MemoryManager
+    static constexpr uint32_t CHUNK_MANAGEMENT_POOL_INDEX{MAX_NUMBER_OF_MEMPOOLS};
+
+    /// @brief Creates a ChunkCache
+    /// @param[in] batchSize is the number of chunks which are acquired at once from a mempool; 0 disables the cache
+    /// and values larger than MAX_CHUNKS_PER_MEMPOOL are clamped to MAX_CHUNKS_PER_MEMPOOL
+    explicit ChunkCache(const uint32_t batchSize = 0U) noexcept;
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache(ChunkCache&&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+    ChunkCache& operator=(ChunkCache&&) = delete;
+    ~ChunkCache() noexcept = default;
+
+    /// @brief Checks whether the cache is used
+    /// @return true if the batch size is larger than zero, otherwise false
+    bool isEnabled() const noexcept;
+
+    /// @brief Acquires a chunk from the cache of the mempool and refills the cache with a batch of chunks from the
+    /// mempool if the cache is empty; if the cache is disabled, the chunk is acquired directly from the mempool
+    /// @param[in] memPool from which the chunk shall be acquired
+    /// @param[in] memPoolIndex is the index of the mempool in the MemoryManager or CHUNK_MANAGEMENT_POOL_INDEX
+    /// @return a pointer to the chunk or nullptr if the mempool has no free chunks left
+    void* getChunk(MemPool& memPool, const uint32_t memPoolIndex) noexcept;
+
+    /// @brief Returns the number of chunks which are currently cached for a mempool
+    /// @param[in] memPoolIndex is the index of the mempool in the MemoryManager or CHUNK_MANAGEMENT_POOL_INDEX
+    /// @return the number of cached chunks
+    uint32_t getNumberOfCachedChunks(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief Returns all cached chunks to their mempools
+    void drain() noexcept;
+
+  private:
+    struct Magazine
+    {
+        RelativePointer<MemPool> m_memPool;
+        uint32_t m_numberOfChunks{0U};
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) plain index storage in shared memory
+        uint32_t m_chunkIndices[MAX_CHUNKS_PER_MEMPOOL]{};
+    };
+
+    uint32_t m_batchSize{0U};
+    vector<Magazine, MAX_NUMBER_OF_MEMPOOLS + 1U> m_magazines;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CACHE_HPP
@@ -45,6 +45,11 @@ struct ChunkManagement
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief steady clock time in nanoseconds when the chunk was sent by a publisher which measures the latency; 0
+    /// if the chunk was not stamped. It is stored here instead of the ChunkHeader to keep the layout of the
+    /// ChunkHeader stable
+    uint64_t m_sendTimestamp{0U};
 };
 } // namespace mepoo
 } // namespace iox
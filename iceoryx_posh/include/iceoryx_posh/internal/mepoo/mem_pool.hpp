@@ -37,12 +37,15 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint64_t chunkSize) noexcept;
+                const uint64_t chunkSize,
+                const uint64_t spillAllocations = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    /// @brief number of chunks acquired from this mempool because a smaller, best fitting mempool was exhausted
+    uint64_t m_spillAllocations{0};
 };
 
 class MemPool
@@ -68,8 +71,32 @@ class MemPool
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Records that a chunk was acquired from this mempool on behalf of a smaller, exhausted mempool
+    void countSpillAllocation() noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Acquires multiple chunks at once; the chunks are accounted as used until they are released with
+    /// 'freeChunk' or returned with 'freeChunkIndices'
+    /// @param[out] indices is the storage for the indices of the acquired chunks, must have space for 'count' elements
+    /// @param[in] count is the maximum number of chunks to acquire
+    /// @param[out] numberOfOwnedIndices if not nullptr, it is updated after each acquired chunk; this keeps the chunks
+    /// trackable when the process terminates while they are acquired
+    /// @return the number of acquired chunks which can be less than 'count' if the mempool is running out of chunks
+    uint32_t getChunkIndices(uint32_t* const indices,
+                             const uint32_t count,
+                             uint32_t* const numberOfOwnedIndices = nullptr) noexcept;
+
+    /// @brief Returns chunks which were acquired with 'getChunkIndices' and not yet converted to a chunk
+    /// @param[in] indices of the chunks to return
+    /// @param[in] count is the number of indices
+    void freeChunkIndices(const uint32_t* const indices, const uint32_t count) noexcept;
+
+    /// @brief Converts the index of a chunk acquired with 'getChunkIndices' to the pointer of the chunk
+    /// @param[in] index of the chunk
+    /// @return the pointer to the chunk
+    void* getChunkFromIndex(const uint32_t index) const noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -98,6 +125,7 @@ class MemPool
 
     concurrent::Atomic<uint32_t> m_usedChunks{0U};
     concurrent::Atomic<uint32_t> m_minFree{0U};
+    concurrent::Atomic<uint64_t> m_spillAllocations{0U};
 
     freeList_t m_freeIndices;
 };
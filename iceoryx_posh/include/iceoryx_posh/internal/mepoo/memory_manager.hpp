@@ -18,9 +18,11 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -42,8 +44,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint64_t, 1, std::numeric_limits<uint64_t>::max() - sizeof(ChunkHeader)>;
@@ -67,11 +67,19 @@ class MemoryManager
                                 BumpAllocator& managementAllocator,
                                 BumpAllocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the mempools; depending on the configured AllocationPolicy the chunk is either
+    /// acquired from the best fitting mempool only or, when this one is exhausted, also from larger mempools
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools like 'getChunk' but acquires the chunk and its chunk management via
+    /// the provided ChunkCache
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkCache which is used to acquire the chunk
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -83,19 +91,35 @@ class MemoryManager
   private:
     static uint64_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    expected<SharedChunk, Error> getChunkImpl(const ChunkSettings& chunkSettings,
+                                              ChunkCache* const chunkCache) noexcept;
+    static void* acquireChunk(MemPool& memPool, const uint32_t memPoolIndex, ChunkCache* const chunkCache) noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassIndex() noexcept;
+
+    /// @brief Returns the size class of a chunk size, i.e. the position of its most significant bit
+    /// @param[in] chunkSize must not be zero
+    /// @return the size class which covers chunk sizes in the range [2^sizeClass, 2^(sizeClass+1))
+    static uint32_t sizeClassOf(const uint64_t chunkSize) noexcept;
 
   private:
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{64U};
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    AllocationPolicy m_allocationPolicy{AllocationPolicy::BEST_FIT};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+    /// @brief index of the first mempool with a chunk size of at least 2^sizeClass; this is the starting point for
+    /// the search of a fitting mempool and only mempools within the same size class need to be skipped from there
+    vector<uint32_t, NUMBER_OF_SIZE_CLASSES> m_firstMemPoolOfSizeClass;
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/posix_acl.hpp"
 #include "iox/filesystem.hpp"
@@ -41,7 +42,8 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const SegmentMemoryOptions& memoryOptions = SegmentMemoryOptions()) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,16 +54,36 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief Returns the size of the pages the segment is mapped with
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief Returns the NUMA node the segment is assigned to by the configuration
+    optional<uint32_t> getNumaNode() const noexcept;
+
+    /// @brief Returns true if the memory of the segment is actually bound to the assigned NUMA node
+    bool isBoundToNumaNode() const noexcept;
+
+    /// @brief Returns the name of the shared memory of the segment without the iceoryx resource prefix
+    const ShmName_t& getSharedMemoryName() const noexcept;
+
   protected:
+    static ShmName_t createSharedMemoryName(const PosixGroup& writerGroup,
+                                            const SegmentMemoryOptions& memoryOptions) noexcept;
+
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const SegmentMemoryOptions& memoryOptions) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
     PosixGroup m_writerGroup;
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
+    uint64_t m_pageSize{0};
+    optional<uint32_t> m_numaNode;
+    bool m_isBoundToNumaNode{false};
+    ShmName_t m_sharedMemoryName;
     iox::mepoo::MemoryInfo m_memoryInfo;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
@@ -28,6 +28,8 @@
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
@@ -42,11 +44,14 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const SegmentMemoryOptions& memoryOptions) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
+    , m_numaNode(memoryOptions.numaNode)
+    , m_sharedMemoryName(createSharedMemoryName(writerGroup, memoryOptions))
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup, memoryOptions))
 {
     using namespace detail;
     PosixAcl acl;
@@ -69,33 +74,58 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline ShmName_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryName(
+    const PosixGroup& writerGroup, const SegmentMemoryOptions& memoryOptions) noexcept
+{
+    ShmName_t shmName;
+    shmName.append(TruncateToCapacity, writerGroup.getName());
+    // every NUMA node specific segment of a writer group needs its own shared memory
+    memoryOptions.numaNode.and_then([&shmName](const auto& numaNode) {
+        shmName.append(TruncateToCapacity, "_numa");
+        const auto numaNodeString = convert::toString(numaNode);
+        shmName.append(TruncateToCapacity,
+                       ShmName_t(TruncateToCapacity, numaNodeString.c_str(), numaNodeString.size()));
+    });
+    return shmName;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const DomainId domainId, const PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const DomainId domainId,
+    const PosixGroup& writerGroup,
+    const SegmentMemoryOptions& memoryOptions) noexcept
 {
+    const auto creationStart = std::chrono::steady_clock::now();
     return std::move(
         typename SharedMemoryObjectType::Builder()
-            .name([&domainId, &writerGroup] {
+            .name([this, &domainId] {
                 using ShmName_t = detail::PosixSharedMemory::Name_t;
                 ShmName_t shmName = iceoryxResourcePrefix(domainId, ResourceType::USER_DEFINED);
-                if (shmName.size() + writerGroup.getName().size() > ShmName_t::capacity())
+                if (shmName.size() + m_sharedMemoryName.size() > ShmName_t::capacity())
                 {
                     IOX_LOG(Fatal,
                             "The payload segment with the name '"
-                                << writerGroup.getName().size()
+                                << m_sharedMemoryName
                                 << "' would exceed the maximum allowed size when used with the '" << shmName
                                 << "' prefix!");
                     IOX_PANIC("");
                 }
-                shmName.append(TruncateToCapacity, writerGroup.getName());
+                shmName.append(TruncateToCapacity, m_sharedMemoryName);
                 return shmName;
             }())
             .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .useHugePages(memoryOptions.useHugePages)
+            .lockMemory(memoryOptions.lockMemory)
+            .prefaultMemory(memoryOptions.prefaultMemory)
+            .initializationThreads(memoryOptions.initializationThreads)
+            .numaNode(memoryOptions.numaNode)
             .create()
-            .and_then([this](auto& sharedMemoryObject) {
+            .and_then([this, creationStart, &writerGroup](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
                     sharedMemoryObject.getBaseAddress(),
                     sharedMemoryObject.get_size().expect("Failed to get SHM size"));
@@ -105,11 +135,20 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
                 }
                 this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
                 this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+                this->m_pageSize = sharedMemoryObject.getPageSize();
+                this->m_isBoundToNumaNode = sharedMemoryObject.getNumaNode().has_value();
 
                 IOX_LOG(Debug,
-                        "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
-                                                                 << " with size " << m_segmentSize << " to id "
-                                                                 << m_segmentId);
+                        "Roudi registered payload data segment "
+                            << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size " << m_segmentSize
+                            << " and page size " << m_pageSize << " to id " << m_segmentId);
+
+                const auto creationDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - creationStart);
+                IOX_LOG(Info,
+                        "Roudi created the payload data segment of the writer group '"
+                            << writerGroup.getName() << "' with size " << m_segmentSize << " in "
+                            << static_cast<uint64_t>(creationDuration.count()) << " ms");
             })
             .or_else([](auto&) { IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
@@ -145,6 +184,30 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline optional<uint32_t> MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumaNode() const noexcept
+{
+    return m_numaNode;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::isBoundToNumaNode() const noexcept
+{
+    return m_isBoundToNumaNode;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const ShmName_t& MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName() const noexcept
+{
+    return m_sharedMemoryName;
+}
+
 } // namespace mepoo
 } // namespace iox
 
@@ -86,7 +86,10 @@ class SegmentManager
     using SegmentMappingContainer = vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
-    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
+    /// @brief Returns the writable segment of the user; if a NUMA node is provided and the writer group of the user
+    /// has a segment on this node, this segment is returned
+    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user,
+                                                                       const optional<uint32_t> numaNode = nullopt) noexcept;
 
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
@@ -23,6 +23,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace mepoo
@@ -41,7 +43,26 @@ inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& segmentC
                                  << m_segmentContainer.capacity());
         IOX_PANIC("Too many segments");
     }
-    for (const auto& segmentEntry : segmentConfig.m_sharedMemorySegments)
+
+    // a writer group has one default segment without NUMA node and at most one additional segment per NUMA node
+    const auto& segments = segmentConfig.m_sharedMemorySegments;
+    for (auto segment = segments.begin(); segment != segments.end(); ++segment)
+    {
+        const bool hasDuplicate = std::any_of(segments.begin(), segment, [&](const SegmentConfig::SegmentEntry& entry) {
+            return entry.m_writerGroup == segment->m_writerGroup
+                   && entry.m_memoryOptions.numaNode == segment->m_memoryOptions.numaNode;
+        });
+        if (hasDuplicate)
+        {
+            IOX_LOG(Fatal,
+                    "The writer group '" << segment->m_writerGroup
+                                         << "' has more than one segment on the same NUMA node or without NUMA node");
+            IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_WITH_DUPLICATE_WRITER_GROUP_AND_NUMA_NODE);
+            return;
+        }
+    }
+
+    for (const auto& segmentEntry : segments)
     {
         createSegment(segmentEntry, domainId);
     }
@@ -58,7 +79,8 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_memoryOptions);
 }
 
 template <typename SegmentType>
@@ -69,7 +91,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
     auto groupContainer = user.getGroups();
 
     SegmentManager::SegmentMappingContainer mappingContainer;
-    bool foundInWriterGroup = false;
+    optional<PosixGroup> writerGroupOfUser;
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
@@ -79,18 +101,16 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
             if (segment.getWriterGroup() == groupID)
             {
                 // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
-                {
-                    mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
-                    foundInWriterGroup = true;
-                }
-                else
+                // process; besides the default segment, only the NUMA node specific segments of this writer group are
+                // writable
+                if (writerGroupOfUser.has_value() && !(writerGroupOfUser.value() == segment.getWriterGroup()))
                 {
                     IOX_REPORT_FATAL(PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
                     return SegmentManager::SegmentMappingContainer();
                 }
+                mappingContainer.emplace_back(
+                    segment.getSharedMemoryName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                writerGroupOfUser.emplace(segment.getWriterGroup());
             }
         }
     }
@@ -106,7 +126,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                    }) == mappingContainer.end())
             {
                 mappingContainer.emplace_back(
-                    segment.getWriterGroup().getName(), segment.getSegmentSize(), false, segment.getSegmentId());
+                    segment.getSharedMemoryName(), segment.getSegmentSize(), false, segment.getSegmentId());
             }
         }
     }
@@ -116,22 +136,38 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
 
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
-SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept
+SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const PosixUser& user,
+                                                                        const optional<uint32_t> numaNode) noexcept
 {
     auto groupContainer = user.getGroups();
 
     SegmentUserInformation segmentInfo{nullopt_t(), 0u};
 
-    // with the groups we can search for the writable segment of this user
+    // with the groups we can search for the writable segment of this user; a segment on the requested NUMA node is
+    // preferred, otherwise the default segment without NUMA node is used
     for (const auto& groupID : groupContainer)
     {
         for (auto& segment : m_segmentContainer)
         {
             if (segment.getWriterGroup() == groupID)
             {
-                segmentInfo.m_memoryManager = segment.getMemoryManager();
-                segmentInfo.m_segmentID = segment.getSegmentId();
-                return segmentInfo;
+                if (numaNode.has_value() && segment.getNumaNode() == numaNode)
+                {
+                    segmentInfo.m_memoryManager = segment.getMemoryManager();
+                    segmentInfo.m_segmentID = segment.getSegmentId();
+                    return segmentInfo;
+                }
+
+                // a writer group which consists only of NUMA node specific segments falls back to its first one
+                if (!segment.getNumaNode().has_value() || !segmentInfo.m_memoryManager.has_value())
+                {
+                    segmentInfo.m_memoryManager = segment.getMemoryManager();
+                    segmentInfo.m_segmentID = segment.getSegmentId();
+                }
+                if (!segment.getNumaNode().has_value() && !numaNode.has_value())
+                {
+                    return segmentInfo;
+                }
             }
         }
     }
@@ -29,6 +29,10 @@ namespace mepoo
 template <typename>
 class SharedPointer;
 
+/// @brief The current time of the steady clock, which is the same for all processes, in nanoseconds as it is used
+/// for the send timestamp of a SharedChunk
+uint64_t steadyClockTimestamp() noexcept;
+
 /// @brief WARNING: SharedChunk is not thread safe! Don't share SharedChunk objects between threads! Use for each thread
 /// a separate copy
 class SharedChunk
@@ -47,6 +51,14 @@ class SharedChunk
     ChunkHeader* getChunkHeader() const noexcept;
     void* getUserPayload() const noexcept;
 
+    /// @brief Stamps the chunk with the time it was sent; does nothing for an empty SharedChunk
+    /// @param[in] timestamp steady clock time in nanoseconds
+    void setSendTimestamp(const uint64_t timestamp) noexcept;
+
+    /// @brief The time the chunk was sent
+    /// @return the steady clock time in nanoseconds or 0 if the chunk was not stamped or the SharedChunk is empty
+    uint64_t getSendTimestamp() const noexcept;
+
     ChunkManagement* release() noexcept;
 
     bool operator==(const SharedChunk& rhs) const noexcept;
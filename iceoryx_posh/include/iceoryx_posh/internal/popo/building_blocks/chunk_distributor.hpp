@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iox/detail/adaptive_wait.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
 
@@ -61,6 +62,11 @@ enum class ChunkDistributorError
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
+/// The sender does not take the lock anymore. The delivery works on a snapshot of the stored queues (see
+/// ChunkDistributorData::m_queueSnapshots) and the history is updated in place after a handshake with the
+/// modifications (see ChunkDistributorData::m_historyEpoch). Therefore sending chunks is not blocked by adding and
+/// removing queues and a terminated or stalled sender cannot block these operations. The lock only serializes the
+/// modifications.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -125,7 +131,7 @@ class ChunkDistributor
     /// @param[in] chunk to add to the chunk history
     void addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief Get the current size of the chunk history
+    /// @brief Get the current size of the chunk history; like the delivery, it must only be called by the sender
     /// @return chunk history size
     uint64_t getHistorySize() noexcept;
 
@@ -146,6 +152,48 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    using QueueContainer_t = typename MemberType_t::QueueContainer_t;
+
+    /// @brief Starts a delivery on the active queue snapshot; must be followed by 'endDelivery'
+    /// @return the active queue snapshot which must not be accessed after 'endDelivery'
+    const QueueContainer_t& beginDelivery() const noexcept;
+    void endDelivery() const noexcept;
+
+    /// @brief Updates and activates the inactive queue snapshot after 'm_queues' was modified and waits until no
+    /// delivery accesses the previous snapshot anymore; must be called while holding the lock
+    void publishQueueSnapshot() noexcept;
+
+    /// @brief Starts an update of the history by the sender; waits while a modification accesses the history
+    void beginHistoryUpdate() noexcept;
+    void endHistoryUpdate() noexcept;
+
+    /// @brief Starts an access of the history by a modification; must be called while holding the lock and must be
+    /// followed by 'endHistoryAccess'
+    /// @return false if the sender is stalled while updating the history and the history must not be accessed
+    bool beginHistoryAccess() noexcept;
+    void endHistoryAccess() noexcept;
+
+    /// @brief Waits until the sender changed the epoch, i.e. it does not access the data of the observed epoch anymore
+    /// @return true if the epoch changed or the sender was terminated, false if the sender is stalled
+    bool waitForSender(const concurrent::Atomic<uint64_t>& epoch, const uint64_t observedEpoch) const noexcept;
+
+    void storeSenderProcessId() const noexcept;
+    static uint32_t currentProcessId() noexcept;
+    static bool isProcessAlive(const uint32_t processId) noexcept;
+
+    /// @brief Waits until the consumer frees space in a full queue with QueueFullPolicy::BLOCK_PRODUCER or
+    /// 'BLOCKED_DELIVERY_WAIT_TIMEOUT' has passed and then retries the push; must be called during a delivery
+    /// @return true if the chunk was pushed, otherwise false
+    bool waitForSpaceAndPushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Takes a post which was handed over by a producer that left before the post of its consumer arrived
+    /// @return true if a handed over post was taken, otherwise false
+    static bool tryTakeHandedOverPost(ChunkQueueData_t* const queueData) noexcept;
+
+    static optional<uint32_t> findQueueIndex(const QueueContainer_t& queues,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -19,7 +19,10 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_INL
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/posix_call.hpp"
 
 namespace iox
 {
@@ -63,26 +66,43 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
     {
         if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            // the history is delivered before the queue is published to the sender; this way a chunk which the
+            // sender delivers to the new queue is neither part of the delivered history nor delivered before it
+            const bool isHistoryAccessible = beginHistoryAccess();
+            if (isHistoryAccessible)
+            {
+                const auto currChunkHistorySize = getMembers()->m_history.size();
 
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+                if (requestedHistory > getMembers()->m_historyCapacity)
+                {
+                    IOX_LOG(Warn,
+                            "Chunk history request exceeds history capacity! Request is "
+                                << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
+                }
 
-            if (requestedHistory > getMembers()->m_historyCapacity)
+                // if the current history is large enough we send the requested number of chunks, else we send the
+                // total history
+                const auto startIndex =
+                    (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
+                for (auto i = startIndex; i < currChunkHistorySize; ++i)
+                {
+                    const auto historyIndex = (getMembers()->m_oldestHistoryIndex + i) % currChunkHistorySize;
+                    pushToQueue(queueToAdd, getMembers()->m_history[historyIndex].cloneToSharedChunk());
+                }
+            }
+            else
             {
-                IOX_LOG(Warn,
-                        "Chunk history request exceeds history capacity! Request is "
-                            << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
+                IOX_LOG(Warn, "The chunk history is not delivered to the added queue since the sender is stalled!");
             }
 
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
+            // pushing will be fine
+            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            publishQueueSnapshot();
+
+            if (isHistoryAccessible)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                endHistoryAccess();
             }
 
             return ok();
@@ -113,6 +133,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
+        publishQueueSnapshot();
 
         return ok();
     }
@@ -128,28 +149,210 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
     getMembers()->m_queues.clear();
+    publishQueueSnapshot();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // only the delivering thread may use the delivery epoch, hence the number of queues is read without a snapshot
+    return getMembers()->m_numberOfStoredQueues.load(std::memory_order_relaxed) > 0U;
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::beginDelivery() const noexcept
+{
+    storeSenderProcessId();
+
+    // sequentially consistent ordering of the epoch increment and the load of the active snapshot pairs with
+    // 'publishQueueSnapshot'; either this delivery reads the new snapshot or the modification waits for this delivery
+    getMembers()->m_deliveryEpoch.fetch_add(1U, std::memory_order_seq_cst);
+    const auto activeSnapshot = getMembers()->m_activeQueueSnapshot.load(std::memory_order_seq_cst);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the active snapshot is always 0 or 1
+    return getMembers()->m_queueSnapshots[activeSnapshot];
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::endDelivery() const noexcept
+{
+    const auto deliveryEpoch = getMembers()->m_deliveryEpoch.fetch_add(1U, std::memory_order_release);
+    if (deliveryEpoch == getMembers()->m_abandonedDeliveryEpoch.load(std::memory_order_relaxed))
+    {
+        IOX_LOG(Error,
+                "The delivery was marked as stalled and not waited for by a modification of the chunk queues! It might "
+                "have accessed removed queues.");
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishQueueSnapshot() noexcept
+{
+    // the inactive snapshot is not accessed by any delivery since the previous call waited for the deliveries on it
+    const auto inactiveSnapshot = (getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed) + 1U)
+                                  % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the inactive snapshot is always 0 or 1
+    getMembers()->m_queueSnapshots[inactiveSnapshot] = getMembers()->m_queues;
+    getMembers()->m_activeQueueSnapshot.store(inactiveSnapshot, std::memory_order_seq_cst);
+    getMembers()->m_numberOfStoredQueues.store(getMembers()->m_queues.size(), std::memory_order_relaxed);
+
+    const auto deliveryEpoch = getMembers()->m_deliveryEpoch.load(std::memory_order_seq_cst);
+    constexpr uint64_t DELIVERY_IN_PROGRESS_MASK{1U};
+    if ((deliveryEpoch & DELIVERY_IN_PROGRESS_MASK) == 0U
+        || deliveryEpoch == getMembers()->m_abandonedDeliveryEpoch.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    waitForSender(getMembers()->m_deliveryEpoch, deliveryEpoch);
+    if (getMembers()->m_deliveryEpoch.load(std::memory_order_acquire) == deliveryEpoch)
+    {
+        getMembers()->m_abandonedDeliveryEpoch.store(deliveryEpoch, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::beginHistoryUpdate() noexcept
+{
+    storeSenderProcessId();
+
+    // sequentially consistent ordering of the epoch increment and the load of the flag pairs with
+    // 'beginHistoryAccess'; either the modification sees the update in progress or the sender sees the modification
+    iox::detail::adaptive_wait adaptiveWait;
+    while (true)
+    {
+        getMembers()->m_historyEpoch.fetch_add(1U, std::memory_order_seq_cst);
+        if (!getMembers()->m_isHistoryAccessedByModification.load(std::memory_order_seq_cst))
+        {
+            return;
+        }
+
+        getMembers()->m_historyEpoch.fetch_add(1U, std::memory_order_release);
+        adaptiveWait.wait_loop(
+            [&] { return getMembers()->m_isHistoryAccessedByModification.load(std::memory_order_acquire); });
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::endHistoryUpdate() noexcept
+{
+    getMembers()->m_historyEpoch.fetch_add(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::beginHistoryAccess() noexcept
+{
+    getMembers()->m_isHistoryAccessedByModification.store(true, std::memory_order_seq_cst);
+
+    const auto historyEpoch = getMembers()->m_historyEpoch.load(std::memory_order_seq_cst);
+    constexpr uint64_t UPDATE_IN_PROGRESS_MASK{1U};
+    // the history of a terminated sender can be accessed since an interrupted update leaves it consistent
+    if ((historyEpoch & UPDATE_IN_PROGRESS_MASK) == 0U || waitForSender(getMembers()->m_historyEpoch, historyEpoch))
+    {
+        return true;
+    }
+
+    endHistoryAccess();
+    return false;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::endHistoryAccess() noexcept
+{
+    getMembers()->m_isHistoryAccessedByModification.store(false, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::waitForSender(const concurrent::Atomic<uint64_t>& epoch,
+                                                                      const uint64_t observedEpoch) const noexcept
+{
+    // a slow sender might still access the data, hence the wait only ends early when the sending process is
+    // terminated or when it did not make progress within the stalled sender timeout
+    deadline_timer gracePeriodTimer(MemberType_t::DELIVERY_GRACE_PERIOD_TIMEOUT);
+    deadline_timer stalledSenderTimer(MemberType_t::STALLED_SENDER_TIMEOUT);
+    bool isGracePeriodExceeded{false};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (epoch.load(std::memory_order_acquire) == observedEpoch)
+    {
+        if (gracePeriodTimer.hasExpired())
+        {
+            const auto senderProcessId = getMembers()->m_deliveringProcessId.load(std::memory_order_relaxed);
+            if (!isProcessAlive(senderProcessId))
+            {
+                IOX_LOG(Warn,
+                        "The process with id " << senderProcessId
+                                               << " was terminated while delivering to the chunk queues!");
+                return true;
+            }
+            if (stalledSenderTimer.hasExpired())
+            {
+                IOX_LOG(Error,
+                        "The process with id " << senderProcessId
+                                               << " is stalled while delivering to the chunk queues! The modification "
+                                                  "of the queues does not wait for it anymore.");
+                return false;
+            }
+            if (!isGracePeriodExceeded)
+            {
+                isGracePeriodExceeded = true;
+                IOX_LOG(Warn,
+                        "A delivery to the chunk queues did not finish within the grace period! The modification of "
+                        "the queues waits until the delivery of process "
+                            << senderProcessId << " is finished.");
+            }
+            gracePeriodTimer.reset();
+        }
+        adaptiveWait.wait();
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::storeSenderProcessId() const noexcept
+{
+    // the process id is published with the epoch increment; it is only written when the sending process changes
+    const auto processId = currentProcessId();
+    if (getMembers()->m_deliveringProcessId.load(std::memory_order_relaxed) != processId)
+    {
+        getMembers()->m_deliveringProcessId.store(processId, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::currentProcessId() noexcept
+{
+    // not cached since a forked child has a different process id
+    return static_cast<uint32_t>(getpid());
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isProcessAlive(const uint32_t processId) noexcept
+{
+    if (processId == currentProcessId())
+    {
+        return true;
+    }
 
-    return !getMembers()->m_queues.empty();
+    // signal 0 only checks for the existence of the process; EPERM means the process exists but belongs to another
+    // user
+    auto result = IOX_POSIX_CALL(kill)(static_cast<pid_t>(processId), 0)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ESRCH, EPERM)
+                      .evaluate();
+    return !result.has_error() || result.error().errnum != ESRCH;
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
-    QueueContainer fullQueuesAwaitingDelivery;
+    QueueContainer_t fullQueuesAwaitingDelivery;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto& queues = beginDelivery();
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : queues)
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
@@ -170,55 +373,54 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 }
             }
         }
+
+        endDelivery();
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // sleep until the consumers free space in the full queues
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
+        // only deliver to the full queues which are still stored
+        // reason: it is possible that since the last iteration some subscriber have already unsubscribed
+        //          and without this check we would deliver to dead queues
+        const auto& queues = beginDelivery();
+        QueueContainer_t remainingQueues;
+        for (auto& queue : queues)
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](QueueContainerValue& a, QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
-
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+            const auto isAwaitingDelivery = std::find(fullQueuesAwaitingDelivery.begin(),
+                                                      fullQueuesAwaitingDelivery.end(),
+                                                      static_cast<ChunkQueueData_t*>(queue.get()))
+                                            != fullQueuesAwaitingDelivery.end();
+            if (isAwaitingDelivery)
             {
-                if (pushToQueue(queue.get(), chunk))
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
-                else
-                {
-                    fullQueuesAwaitingDelivery.push_back(queue);
-                }
+                remainingQueues.emplace_back(queue);
             }
         }
+        fullQueuesAwaitingDelivery.clear();
+
+        // deliver to remaining queues; only the first one which is still full is waited for, the others are retried
+        // right after it since their consumers had the same time to catch up
+        bool hasWaited{false};
+        for (auto& queue : remainingQueues)
+        {
+            bool wasPushed = pushToQueue(queue.get(), chunk);
+            if (!wasPushed && !hasWaited)
+            {
+                hasWaited = true;
+                wasPushed = waitForSpaceAndPushToQueue(queue.get(), chunk);
+            }
+
+            if (wasPushed)
+            {
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+            else
+            {
+                fullQueuesAwaitingDelivery.push_back(queue);
+            }
+        }
+
+        endDelivery();
     }
 
     addToHistoryWithoutDelivery(chunk);
@@ -233,6 +435,81 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<Chu
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::waitForSpaceAndPushToQueue(not_null<ChunkQueueData_t* const> queue,
+                                                                       mepoo::SharedChunk chunk) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    if (!queueData->m_producerSemaphore.has_value())
+    {
+        std::this_thread::yield();
+        return pushToQueue(queue, chunk);
+    }
+
+    queueData->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_relaxed);
+    // pairs with the fence of the consumer between popping a chunk and checking for waiting producers; without the
+    // retry a chunk which was popped before the registration would not wake up this producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool wasPushed = pushToQueue(queue, chunk);
+    bool isRegistered{true};
+    if (!wasPushed)
+    {
+        auto waitState =
+            queueData->m_producerSemaphore->timedWait(MemberType_t::BLOCKED_DELIVERY_WAIT_TIMEOUT).or_else([](auto) {
+                IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED);
+            });
+        if (!waitState.has_error() && waitState.value() == SemaphoreWaitState::NO_TIMEOUT)
+        {
+            // the post was either done by a consumer which claimed the registration or it was handed over by a
+            // producer which left before the post of its consumer arrived; in the latter case this producer is still
+            // registered
+            isRegistered = tryTakeHandedOverPost(queueData);
+        }
+        wasPushed = pushToQueue(queue, chunk);
+    }
+
+    if (isRegistered)
+    {
+        auto numberOfWaitingProducers = queueData->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+        while (numberOfWaitingProducers > 0U
+               && !queueData->m_numberOfWaitingProducers.compare_exchange_weak(
+                   numberOfWaitingProducers, numberOfWaitingProducers - 1U, std::memory_order_relaxed))
+        {
+        }
+        if (numberOfWaitingProducers == 0U)
+        {
+            // a consumer claimed the registration meanwhile; its post is not waited for since the consumer might be
+            // terminated before it posts, instead a post which is not yet available is handed over to the next
+            // producer which is woken up
+            auto wasPostConsumed = queueData->m_producerSemaphore->tryWait().or_else(
+                [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED); });
+            if (!wasPostConsumed.has_error() && !wasPostConsumed.value())
+            {
+                queueData->m_numberOfHandedOverPosts.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    return wasPushed;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::tryTakeHandedOverPost(ChunkQueueData_t* const queueData) noexcept
+{
+    auto numberOfHandedOverPosts = queueData->m_numberOfHandedOverPosts.load(std::memory_order_relaxed);
+    while (numberOfHandedOverPosts > 0U)
+    {
+        if (queueData->m_numberOfHandedOverPosts.compare_exchange_weak(
+                numberOfHandedOverPosts, numberOfHandedOverPosts - 1U, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
@@ -242,16 +519,17 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
     bool retry{false};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto& queues = beginDelivery();
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
+            endDelivery();
             return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        auto& queue = queues[queueIndex.value()];
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
@@ -262,13 +540,16 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
         {
             if (isBlockingQueue)
             {
-                retry = true;
+                // the queue is looked up again after the wait since it might have been removed in the meantime
+                retry = !waitForSpaceAndPushToQueue(queue.get(), chunk);
             }
             else
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
             }
         }
+
+        endDelivery();
     } while (retry);
 
     return ok();
@@ -279,10 +560,20 @@ inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the lookup is done by the sender, hence it uses the active queue snapshot like the delivery
+    const auto& queues = beginDelivery();
+    auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
+    endDelivery();
 
-    auto& queues = getMembers()->m_queues;
+    return queueIndex;
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
@@ -303,29 +594,40 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        beginHistoryUpdate();
+
+        auto& history = getMembers()->m_history;
+        if (history.size() < getMembers()->m_historyCapacity)
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space
+            // in the history, so return value can be ignored
+            history.push_back(chunk);
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+        else
+        {
+            // the oldest chunk is replaced before it is released; an interrupted update leaks it but the history never
+            // contains a released chunk
+            auto& oldestHistoryIndex = getMembers()->m_oldestHistoryIndex;
+            auto chunkToRemove = history[oldestHistoryIndex];
+            history[oldestHistoryIndex] = chunk;
+            oldestHistoryIndex = (oldestHistoryIndex + 1U) % history.size();
+            chunkToRemove.releaseToSharedChunk();
+        }
+
+        endHistoryUpdate();
     }
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    beginHistoryUpdate();
+    const auto historySize = getMembers()->m_history.size();
+    endHistoryUpdate();
 
-    return getMembers()->m_history.size();
+    return historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -339,30 +641,29 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    if (!beginHistoryAccess())
+    {
+        IOX_LOG(Error, "The chunk history is not cleared since the sender is stalled! Its chunks are leaked.");
+        return;
+    }
+
     for (auto& unmanagedChunk : getMembers()->m_history)
     {
         unmanagedChunk.releaseToSharedChunk();
     }
 
     getMembers()->m_history.clear();
+    getMembers()->m_oldestHistoryIndex = 0U;
+
+    endHistoryAccess();
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
-    if (getMembers()->tryLock())
-    {
-        clearHistory();
-        getMembers()->unlock();
-    }
-    else
-    {
-        /// @todo iox-#1711 currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
-        IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION);
-    }
+    // the lock is only held by modifications and not by the sender, hence a terminated sender cannot block the
+    // cleanup
+    clearHistory();
 }
 
 } // namespace popo
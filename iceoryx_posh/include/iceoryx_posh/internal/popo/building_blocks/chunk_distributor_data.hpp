@@ -22,6 +22,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
+#include "iox/duration.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
 #include "iox/relative_pointer.hpp"
@@ -48,15 +50,51 @@ struct ChunkDistributorData : public LockingPolicy
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
+    /// @brief the queues which are modified by adding and removing queues while holding the lock
     QueueContainer_t m_queues;
 
-    /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
-    /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
-    /// crash.
+    /// @brief The delivery does not take the lock but reads the active one of two snapshots of 'm_queues'. After a
+    /// modification of 'm_queues', the inactive snapshot is updated and activated. Before the queue modification
+    /// returns, it waits until a delivery which started on the previous snapshot is finished, i.e. a removed queue
+    /// is not accessed anymore. The deliveries increment 'm_deliveryEpoch' at start and end; an odd value indicates
+    /// a delivery in progress. Like all other operations of a sender, the delivery must only be done by one thread.
+    static constexpr uint32_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) double buffer in shared memory
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    concurrent::Atomic<uint32_t> m_activeQueueSnapshot{0U};
+    mutable concurrent::Atomic<uint64_t> m_deliveryEpoch{0U};
+    /// @brief the process which delivers the chunks; it is checked when a delivery exceeds the grace period
+    mutable concurrent::Atomic<uint32_t> m_deliveringProcessId{0U};
+    /// @brief the epoch of a delivery whose process was terminated or is stalled; the modification of the queues does
+    /// not wait for it again
+    concurrent::Atomic<uint64_t> m_abandonedDeliveryEpoch{0U};
+    /// @brief the number of queues in 'm_queues' for readers which are neither the sender nor a modification
+    concurrent::Atomic<uint64_t> m_numberOfStoredQueues{0U};
+
+    /// @brief when a delivery does not finish within this timeout, the modification of the queues checks whether the
+    /// sending process was terminated
+    static constexpr units::Duration DELIVERY_GRACE_PERIOD_TIMEOUT{units::Duration::fromSeconds(1U)};
+    /// @brief when the sender of a running process does not finish a delivery or history update within this timeout,
+    /// it is marked as stalled and the modification does not wait for it anymore
+    static constexpr units::Duration STALLED_SENDER_TIMEOUT{units::Duration::fromSeconds(5U)};
+
+    /// @brief a producer blocked by a full queue sleeps at most this long before the delivery is restarted; this bounds
+    /// the time a modification of the queues waits for a blocked delivery
+    static constexpr units::Duration BLOCKED_DELIVERY_WAIT_TIMEOUT{units::Duration::fromMilliseconds(10U)};
+
+    /// @brief Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an
+    /// application crash. Once the history is full, it is used as ring buffer whose oldest chunk is replaced in
+    /// place; a sender which is terminated during an update leaks at most one chunk but never leaves a chunk which
+    /// is released twice.
     using HistoryContainer_t =
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
+    uint64_t m_oldestHistoryIndex{0U};
+    /// @brief The sender increments 'm_historyEpoch' at start and end of a history update, a modification which
+    /// accesses the history sets 'm_isHistoryAccessedByModification' and waits until no update is in progress.
+    /// A sender which sees the flag after starting an update backs off until the modification is finished.
+    mutable concurrent::Atomic<uint64_t> m_historyEpoch{0U};
+    concurrent::Atomic<bool> m_isHistoryAccessedByModification{false};
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
 };
 
@@ -17,14 +17,18 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/spin_semaphore.hpp"
+#include "iox/unnamed_semaphore.hpp"
 
 #include <mutex>
 
@@ -46,10 +50,23 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     concurrent::Atomic<bool> m_queueHasLostChunks{false};
+    /// @brief Statistics for the port introspection; they are updated by all producers with relaxed atomics
+    concurrent::Atomic<uint64_t> m_numberOfDiscardedChunks{0U};
+    concurrent::Atomic<uint64_t> m_highWaterMark{0U};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Only available with QueueFullPolicy::BLOCK_PRODUCER; a producer which waits for free space in the queue
+    /// increments 'm_numberOfWaitingProducers' and sleeps on the semaphore; after a chunk was popped, the consumer
+    /// decrements 'm_numberOfWaitingProducers' and posts the semaphore once for the claimed producer
+    optional<build::InterProcessSemaphore> m_producerSemaphore;
+    concurrent::Atomic<uint32_t> m_numberOfWaitingProducers{0U};
+    /// @brief A producer whose registration was claimed by a consumer does not wait for the post since the consumer
+    /// might be terminated before it posts; the pending post is counted here and the producer which receives it
+    /// remains registered
+    concurrent::Atomic<uint32_t> m_numberOfHandedOverPosts{0U};
 };
 
 } // namespace popo
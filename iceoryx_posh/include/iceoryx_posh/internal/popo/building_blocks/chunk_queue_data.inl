@@ -27,6 +27,14 @@ inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(const
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
 {
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        build::InterProcessSemaphore::Builder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_producerSemaphore)
+            .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
+    }
 }
 
 } // namespace popo
@@ -97,6 +97,9 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief wakes up a producer which waits for free space in a queue with QueueFullPolicy::BLOCK_PRODUCER
+    void notifyWaitingProducer() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
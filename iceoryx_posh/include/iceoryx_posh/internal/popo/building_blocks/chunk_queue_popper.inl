@@ -53,6 +53,8 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyWaitingProducer();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -124,6 +126,35 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+    notifyWaitingProducer();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyWaitingProducer() noexcept
+{
+    auto* members = getMembers();
+    if (!members->m_producerSemaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the fence of the producer between registering itself as waiting and retrying the push; either the
+    // producer sees the free space or the consumer sees the waiting producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // a registration of a waiting producer is claimed before the post; this results in exactly one post per waiting
+    // producer instead of one post per popped chunk which would pile up in the semaphore
+    auto numberOfWaitingProducers = members->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+    while (numberOfWaitingProducers > 0U)
+    {
+        if (members->m_numberOfWaitingProducers.compare_exchange_weak(
+                numberOfWaitingProducers, numberOfWaitingProducers - 1U, std::memory_order_relaxed))
+        {
+            members->m_producerSemaphore->post().or_else(
+                [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED); });
+            return;
+        }
+    }
 }
 
 template <typename ChunkQueueDataType>
@@ -54,6 +54,15 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         pushRet.value().releaseToSharedChunk();
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
+        getMembers()->m_numberOfDiscardedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    const auto queueSize = getMembers()->m_queue.size();
+    auto highWaterMark = getMembers()->m_highWaterMark.load(std::memory_order_relaxed);
+    while (queueSize > highWaterMark
+           && !getMembers()->m_highWaterMark.compare_exchange_weak(
+               highWaterMark, queueSize, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
     }
 
     {
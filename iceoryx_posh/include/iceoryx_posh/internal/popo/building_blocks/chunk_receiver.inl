@@ -78,6 +78,15 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     {
         auto sharedChunk = *popRet;
 
+        const auto sendTimestamp = sharedChunk.getSendTimestamp();
+        if (sendTimestamp != 0U)
+        {
+            getMembers()->m_latencyConnections.record(
+                static_cast<uint64_t>(sharedChunk.getChunkHeader()->originId()),
+                sendTimestamp,
+                mepoo::steadyClockTimestamp());
+        }
+
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
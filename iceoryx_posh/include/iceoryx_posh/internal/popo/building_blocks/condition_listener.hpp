@@ -21,6 +21,7 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
+#include "iox/duration.hpp"
 
 namespace iox
 {
@@ -32,7 +33,13 @@ class ConditionListener
   public:
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @brief Creates a ConditionListener
+    /// @param[in] condVarData the condition variable to wait on
+    /// @param[in] spinDuration how long wait() and timedWait() poll the notifications before they sleep on the
+    /// semaphore; with the default of zero they sleep right away. Polling avoids the system calls of the semaphore on
+    /// both sides for the price of a busy core while waiting
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const units::Duration spinDuration = units::Duration::zero()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -70,13 +77,21 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    /// @brief Resets all notifications of a word of the notification bitset
+    /// @return the notifications of the word which were active before the reset
+    ConditionVariableData::NotificationWord_t collectNotificationWord(const uint64_t wordIndex) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    /// @brief Polls the notifications for at most 'spinDuration'
+    /// @return true if a notification is active, otherwise false and the ConditionNotifier posts the semaphore again
+    bool spinUntilNotified(const units::Duration& spinDuration) noexcept;
+    bool hasActiveNotifications(const std::memory_order order) const noexcept;
+
+    NotificationVector_t waitImpl(const units::Duration& spinDuration, const function_ref<bool()> waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    units::Duration m_spinDuration{units::Duration::zero()};
     concurrent::Atomic<bool> m_toBeDestroyed{false};
 };
 
@@ -39,11 +39,37 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    using NotificationWord_t = uint64_t;
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{sizeof(NotificationWord_t) * 8U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+
+    /// @brief Returns the index of the word in 'm_activeNotifications' which contains the bit of a notification
+    static constexpr uint64_t notificationWordIndex(const uint64_t notificationIndex) noexcept
+    {
+        return notificationIndex / NOTIFICATIONS_PER_WORD;
+    }
+
+    /// @brief Returns the mask of the bit of a notification within its word in 'm_activeNotifications'
+    static constexpr NotificationWord_t notificationBitMask(const uint64_t notificationIndex) noexcept
+    {
+        return NotificationWord_t{1U} << (notificationIndex % NOTIFICATIONS_PER_WORD);
+    }
+
+    /// @brief Checks whether the notification with the given index is active
+    bool isNotificationActive(const uint64_t notificationIndex) const noexcept;
+
     optional<build::InterProcessSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
-    concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief bitset with one bit per notification index; a ConditionNotifier sets its bit and the ConditionListener
+    /// collects and clears a whole word at once, hence the wakeup cost depends on the number of active notifications
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size array in shared memory
+    concurrent::Atomic<NotificationWord_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     concurrent::Atomic<bool> m_wasNotified{false};
+    /// @brief is set while the ConditionListener polls the notifications before it sleeps on the semaphore; the
+    /// ConditionNotifier does not post the semaphore in the meantime
+    concurrent::Atomic<bool> m_isListenerSpinning{false};
 };
 
 } // namespace popo
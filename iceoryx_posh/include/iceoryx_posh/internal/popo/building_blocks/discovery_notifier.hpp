@@ -0,0 +1,85 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+class DiscoveryQueue;
+
+/// @brief The kind of data in the port pool a DiscoveryQueue entry refers to
+enum class DiscoveryPortType : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    SERVER,
+    CLIENT,
+    INTERFACE,
+};
+
+/// @brief Member of the data in the port pool which informs RouDi about a state change, e.g. an offer, a subscribe
+/// or a destroy request, by pushing the data to the DiscoveryQueue of the port pool. The data is queued only once
+/// until RouDi processed it.
+class DiscoveryNotifier
+{
+  public:
+    DiscoveryNotifier() noexcept = default;
+    ~DiscoveryNotifier() noexcept = default;
+
+    DiscoveryNotifier(const DiscoveryNotifier&) = delete;
+    DiscoveryNotifier(DiscoveryNotifier&&) = delete;
+    DiscoveryNotifier& operator=(const DiscoveryNotifier&) = delete;
+    DiscoveryNotifier& operator=(DiscoveryNotifier&&) = delete;
+
+    /// @brief Connects the notifier to the queue of the port pool; this is done by the PortPool when the data is
+    /// created
+    /// @param[in] queue is the DiscoveryQueue of the port pool
+    /// @param[in] portType is the kind of data the notifier belongs to
+    /// @param[in] index is the index of the data in its container of the port pool
+    void init(DiscoveryQueue& queue, const DiscoveryPortType portType, const uint64_t index) noexcept;
+
+    /// @brief Disconnects the notifier from the queue; RouDi calls this before the port pool is destroyed, hence the
+    /// state changes while the ports are torn down do not access the queue anymore
+    void detach() noexcept;
+
+    /// @brief Informs RouDi about a state change; does nothing if the data does not belong to a port pool or the
+    /// notifier was detached
+    void notify() noexcept;
+
+    /// @brief Marks the data as not queued; RouDi calls this before it processes the data, hence a state change
+    /// during the processing queues the data again
+    void reset() noexcept;
+
+  private:
+    RelativePointer<DiscoveryQueue> m_queue;
+    DiscoveryPortType m_portType{DiscoveryPortType::PUBLISHER};
+    uint64_t m_index{0U};
+    concurrent::Atomic<bool> m_isAttached{false};
+    concurrent::Atomic<bool> m_isQueued{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_QUEUE_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_QUEUE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lock-free multi-producer queue in shared memory with the data of the port pool whose state changed. The
+/// data is pushed by its DiscoveryNotifier, which also wakes up RouDi via the condition variable of the queue. RouDi
+/// then only processes the queued data instead of scanning the whole port pool. When the queue is full, a discovery
+/// of the whole port pool is requested instead.
+class DiscoveryQueue
+{
+  public:
+    struct Entry
+    {
+        DiscoveryPortType portType{DiscoveryPortType::PUBLISHER};
+        uint64_t index{0U};
+    };
+
+    /// @brief Each data of the port pool is queued at most once at a time
+    static constexpr uint64_t CAPACITY{static_cast<uint64_t>(MAX_PUBLISHERS) + MAX_SUBSCRIBERS + MAX_SERVERS
+                                       + MAX_CLIENTS + MAX_INTERFACE_NUMBER};
+    /// @brief The notification index of the condition variable which is used by the DiscoveryNotifier
+    static constexpr uint64_t PORT_CHANGE_NOTIFICATION_INDEX{0U};
+    /// @brief The notification index of the condition variable which is used by RouDi to trigger a discovery run
+    static constexpr uint64_t TRIGGER_NOTIFICATION_INDEX{1U};
+
+    DiscoveryQueue() noexcept = default;
+    ~DiscoveryQueue() noexcept = default;
+
+    DiscoveryQueue(const DiscoveryQueue&) = delete;
+    DiscoveryQueue(DiscoveryQueue&&) = delete;
+    DiscoveryQueue& operator=(const DiscoveryQueue&) = delete;
+    DiscoveryQueue& operator=(DiscoveryQueue&&) = delete;
+
+    /// @brief Queues the data of the port pool whose state changed and wakes up RouDi
+    /// @param[in] entry refers to the changed data
+    /// @return true if the entry was queued, false if the queue was full and a full discovery was requested instead
+    bool push(const Entry entry) noexcept;
+
+    /// @brief Takes the next changed data of the port pool from the queue
+    /// @return the entry or 'nullopt' if the queue is empty
+    optional<Entry> pop() noexcept;
+
+    /// @brief Requests a discovery of the whole port pool with the next discovery run
+    void requestFullDiscovery() noexcept;
+
+    /// @brief Checks whether a discovery of the whole port pool was requested and resets the request
+    /// @return true if a full discovery was requested since the last call, false otherwise
+    bool takeFullDiscoveryRequest() noexcept;
+
+    /// @brief The condition variable RouDi waits on for changes of the port pool
+    /// @return a reference to the condition variable data
+    ConditionVariableData& conditionVariableData() noexcept;
+
+  private:
+    concurrent::MpmcLockFreeQueue<Entry, CAPACITY> m_queue;
+    concurrent::Atomic<bool> m_isFullDiscoveryRequested{false};
+    ConditionVariableData m_conditionVariableData;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_QUEUE_HPP
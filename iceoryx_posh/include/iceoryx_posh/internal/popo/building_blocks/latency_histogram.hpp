@@ -0,0 +1,152 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The latencies which were recorded since the statistics were taken the last time
+struct LatencyStatistics
+{
+    uint64_t numberOfSamples{0U};
+    uint64_t p50InNanoseconds{0U};
+    uint64_t p99InNanoseconds{0U};
+    uint64_t p999InNanoseconds{0U};
+    uint64_t maxInNanoseconds{0U};
+};
+
+/// @brief Log-linear histogram of latencies in nanoseconds which lives in shared memory. Every power of two is split
+/// into NUMBER_OF_SUB_BUCKETS linear buckets, hence the relative error of a percentile is at most
+/// 1 / NUMBER_OF_SUB_BUCKETS. Latencies above 2^(MAX_EXPONENT + 1) nanoseconds are counted in the last bucket.
+/// @note There must be only one thread which records latencies, e.g. the owner of a ChunkReceiver; the statistics
+/// can be taken concurrently from another process, e.g. from the port introspection of RouDi
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKET_BITS{3U};
+    static constexpr uint64_t NUMBER_OF_SUB_BUCKETS{1U << SUB_BUCKET_BITS};
+    /// @brief the exponent of the largest power of two with a resolved range; 2^40ns are about 18 minutes
+    static constexpr uint64_t MAX_EXPONENT{39U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{(MAX_EXPONENT - SUB_BUCKET_BITS + 2U) * NUMBER_OF_SUB_BUCKETS};
+
+    LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /// @brief Adds a latency to the histogram
+    /// @param[in] latencyInNanoseconds is the latency to add
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Takes the latencies which were recorded since the previous call and empties the histogram, i.e. the
+    /// statistics cover one interval of the caller
+    /// @return the number of samples, the percentiles and the maximum of the taken latencies; the percentiles are the
+    /// upper bound of the bucket which contains them, limited by the maximum
+    LatencyStatistics takeStatistics() noexcept;
+
+    /// @brief The bucket a latency is counted in
+    /// @param[in] latencyInNanoseconds is the latency to look up
+    /// @return the index of the bucket
+    static uint64_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief The largest latency which is counted in a bucket
+    /// @param[in] index of the bucket
+    /// @return the upper bound of the bucket in nanoseconds
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    // NOLINTJUSTIFICATION the buckets live in shared memory and are indexed by 'bucketIndex' only
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    concurrent::Atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+    concurrent::Atomic<uint64_t> m_max{0U};
+};
+
+/// @brief The latency histograms of the connections of a receiver to the publishers which measure the latency. RouDi
+/// assigns a histogram from its pool when such a connection is established, hence receivers without these connections
+/// do not need the memory of a histogram. Once assigned, a histogram stays with the receiver and is reused for the
+/// next connection when its publisher is gone; RouDi takes the histograms back when the receiver is destroyed.
+/// @note The latencies are recorded only by the owner of the receiver, the connections are changed only by RouDi
+class LatencyConnections
+{
+  public:
+    static constexpr uint32_t CAPACITY{MAX_LATENCY_HISTOGRAMS_PER_SUBSCRIBER};
+    /// @brief the value of an invalid UniquePortId
+    static constexpr uint64_t NO_PUBLISHER{0U};
+
+    LatencyConnections() noexcept = default;
+
+    LatencyConnections(const LatencyConnections&) = delete;
+    LatencyConnections(LatencyConnections&&) = delete;
+    LatencyConnections& operator=(const LatencyConnections&) = delete;
+    LatencyConnections& operator=(LatencyConnections&&) = delete;
+
+    /// @brief Records the latency of a sample in the histogram of its publisher. Samples which were sent before the
+    /// connection was established, e.g. the history which is delivered to a late joiner, are not recorded
+    /// @param[in] publisherId is the unique id of the publisher of the sample
+    /// @param[in] sendTimestamp is the steady clock time in nanoseconds when the sample was sent
+    /// @param[in] now is the steady clock time in nanoseconds when the sample was taken
+    void record(const uint64_t publisherId, const uint64_t sendTimestamp, const uint64_t now) noexcept;
+
+    /// @brief Starts the measurement of the connection to a publisher; it is restarted when the publisher was
+    /// already connected before
+    /// @param[in] publisherId is the unique id of the publisher
+    /// @param[in] connectionTimestamp is the steady clock time in nanoseconds when the connection was established
+    /// @param[in] acquireHistogram provides a histogram from the pool when the receiver has none left to reuse; it
+    /// may return nullptr if the pool is exhausted
+    /// @return the histogram if the connection is a new one, nullptr if the publisher was already connected or if
+    /// there is no histogram for the connection
+    LatencyHistogram* connect(const uint64_t publisherId,
+                              const uint64_t connectionTimestamp,
+                              const function_ref<LatencyHistogram*()> acquireHistogram) noexcept;
+
+    /// @brief Stops the measurement of a publisher which is gone; its histogram is kept for the next connection
+    /// @param[in] publisherId is the unique id of the publisher
+    /// @return the histogram of the publisher or nullptr if the publisher was not connected
+    LatencyHistogram* disconnect(const uint64_t publisherId) noexcept;
+
+    /// @brief Takes all histograms away from the receiver, e.g. to return them to the pool of RouDi
+    /// @param[in] releaseHistogram is called with every histogram the receiver has
+    void releaseHistograms(const function_ref<void(LatencyHistogram&)> releaseHistogram) noexcept;
+
+  private:
+    struct Connection
+    {
+        concurrent::Atomic<uint64_t> publisherId{NO_PUBLISHER};
+        concurrent::Atomic<uint64_t> connectionTimestamp{0U};
+        /// @brief written by RouDi before the publisherId is set and not changed while the publisherId is valid
+        RelativePointer<LatencyHistogram> histogram;
+    };
+
+    // NOLINTJUSTIFICATION the connections live in shared memory and are only indexed up to CAPACITY
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Connection m_connections[CAPACITY];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
+#define IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
+
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Monotonic counters of a publisher port which are read by the port introspection of RouDi. The counters are
+/// only written by the user side of the port, which is not thread-safe anyway, hence they are updated with a relaxed
+/// load and store instead of an atomic read-modify-write.
+struct PublisherPortStatistics
+{
+    /// @brief Counts a sample which was sent
+    /// @param[in] userPayloadSize is the size of the user-payload of the sent chunk
+    /// @param[in] chunkSize is the size of the sent chunk
+    void addSentSample(const uint64_t userPayloadSize, const uint64_t chunkSize) noexcept;
+
+    /// @brief Counts a chunk which could not be loaned
+    void addLoanFailure() noexcept;
+
+    concurrent::Atomic<uint64_t> m_numberOfSentSamples{0U};
+    concurrent::Atomic<uint64_t> m_numberOfSentBytes{0U};
+    concurrent::Atomic<uint64_t> m_numberOfLoanFailures{0U};
+    concurrent::Atomic<uint64_t> m_lastChunkSize{0U};
+};
+
+/// @brief Monotonic counters of a subscriber port which are read by the port introspection of RouDi. Like with the
+/// PublisherPortStatistics, only the user side of the port writes the counters.
+/// @note The number of discarded samples and the high-water mark of the queue are part of the ChunkQueueData since
+/// they are updated by the publishers
+struct SubscriberPortStatistics
+{
+    /// @brief Counts a sample which was taken from the queue
+    /// @param[in] userPayloadSize is the size of the user-payload of the received chunk
+    void addReceivedSample(const uint64_t userPayloadSize) noexcept;
+
+    concurrent::Atomic<uint64_t> m_numberOfReceivedSamples{0U};
+    concurrent::Atomic<uint64_t> m_numberOfReceivedBytes{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/port_statistics.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -56,6 +57,8 @@ struct PublisherPortData : public BasePortData
 
     concurrent::Atomic<bool> m_offeringRequested{false};
     concurrent::Atomic<bool> m_offered{false};
+
+    PublisherPortStatistics m_statistics;
 };
 
 } // namespace popo
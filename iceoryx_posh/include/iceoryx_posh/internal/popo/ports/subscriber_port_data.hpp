@@ -21,6 +21,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/port_statistics.hpp"
 #include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iox/atomic.hpp"
@@ -51,6 +52,8 @@ struct SubscriberPortData : public BasePortData
 
     concurrent::Atomic<bool> m_subscribeRequested{false};
     concurrent::Atomic<SubscribeState> m_subscriptionState{SubscribeState::NOT_SUBSCRIBED};
+
+    SubscriberPortStatistics m_statistics;
 };
 
 } // namespace popo
@@ -38,6 +38,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        To find the chunk to remove in constant time, the slots of the used chunks are additionally stored in an open
+///        addressing hash table which is keyed by the ChunkHeader address. The hash table is only accessed from the
+///        runtime context and is not required by RouDi for the cleanup.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -68,18 +71,25 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    static constexpr uint32_t calculateHashTableCapacity() noexcept;
+    static uint32_t hashTablePositionOf(const mepoo::ChunkHeader* chunkHeader) noexcept;
+    void insertIntoHashTable(const uint32_t slot) noexcept;
+    void removeFromHashTable(uint32_t position) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @note the hash table is at most half full which keeps the probe sequences short
+    static constexpr uint32_t HASH_TABLE_CAPACITY{calculateHashTableCapacity()};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     concurrent::AtomicFlag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
+    uint32_t m_hashTable[HASH_TABLE_CAPACITY];
 };
 
 } // namespace popo
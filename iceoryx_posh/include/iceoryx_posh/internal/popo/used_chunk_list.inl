@@ -41,17 +41,14 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
+        auto slot = m_freeListHead;
 
         // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        m_freeListHead = m_listIndices[slot];
+        m_listIndices[slot] = INVALID_INDEX;
+
+        m_listData[slot] = DataElement_t(chunk);
+        insertIntoHashTable(slot);
 
         m_synchronizer.clear(std::memory_order_release);
         return true;
@@ -65,37 +62,23 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
-
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    // the probe sequence ends at the first empty position of the hash table
+    for (auto position = hashTablePositionOf(chunkHeader); m_hashTable[position] != INVALID_INDEX;
+         position = (position + 1U) % HASH_TABLE_CAPACITY)
     {
-        if (!m_listData[current].isLogicalNullptr())
+        auto slot = m_hashTable[position];
+        if (m_listData[slot].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[slot].releaseToSharedChunk();
+            removeFromHashTable(position);
+
+            // insert index to free list
+            m_listIndices[slot] = m_freeListHead;
+            m_freeListHead = slot;
+
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
@@ -136,9 +119,13 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
 
+    for (auto& position : m_hashTable)
+    {
+        position = INVALID_INDEX;
+    }
+
     // clear data
     for (auto& data : m_listData)
     {
@@ -148,6 +135,63 @@ void UsedChunkList<Capacity>::init() noexcept
     m_synchronizer.clear(std::memory_order_release);
 }
 
+template <uint32_t Capacity>
+constexpr uint32_t UsedChunkList<Capacity>::calculateHashTableCapacity() noexcept
+{
+    uint32_t capacity{1U};
+    while (capacity < 2U * Capacity)
+    {
+        capacity *= 2U;
+    }
+    return capacity;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::hashTablePositionOf(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // the chunks are aligned, therefore the lower bits carry no information; the multiplication with the golden ratio
+    // distributes the remaining bits over the whole hash table
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15U};
+    constexpr uint64_t ALIGNMENT_BITS{3U};
+    // NOLINTJUSTIFICATION the address is only used as hash key
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(chunkHeader)) >> ALIGNMENT_BITS;
+    return static_cast<uint32_t>((key * GOLDEN_RATIO) >> 32U) % HASH_TABLE_CAPACITY;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertIntoHashTable(const uint32_t slot) noexcept
+{
+    // there are always free positions since the hash table has at least twice the capacity of the list
+    auto position = hashTablePositionOf(m_listData[slot].getChunkHeader());
+    while (m_hashTable[position] != INVALID_INDEX)
+    {
+        position = (position + 1U) % HASH_TABLE_CAPACITY;
+    }
+    m_hashTable[position] = slot;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromHashTable(uint32_t position) noexcept
+{
+    // backward shift deletion; entries of the following probe sequence are moved into the gap when the gap lies on the
+    // way from their home position to their current position, this keeps all entries reachable without tombstones
+    auto next = (position + 1U) % HASH_TABLE_CAPACITY;
+    while (m_hashTable[next] != INVALID_INDEX)
+    {
+        auto home = hashTablePositionOf(m_listData[m_hashTable[next]].getChunkHeader());
+        auto distanceToGap = (position - home + HASH_TABLE_CAPACITY) % HASH_TABLE_CAPACITY;
+        auto distanceToNext = (next - home + HASH_TABLE_CAPACITY) % HASH_TABLE_CAPACITY;
+        if (distanceToGap < distanceToNext)
+        {
+            m_hashTable[position] = m_hashTable[next];
+            position = next;
+        }
+        next = (next + 1U) % HASH_TABLE_CAPACITY;
+    }
+    m_hashTable[position] = INVALID_INDEX;
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -100,6 +100,8 @@ namespace iox
     error(POPO__CHUNK_TRY_LOCK_ERROR) \
     error(POPO__CHUNK_LOCKING_ERROR) \
     error(POPO__CHUNK_UNLOCKING_ERROR) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED) \
     error(POPO__CAPRO_PROTOCOL_ERROR) \
     error(POPO__CLIENT_PORT_INVALID_REQUEST_TO_FREE_FROM_USER) \
     error(POPO__CLIENT_PORT_INVALID_REQUEST_TO_SEND_FROM_USER) \
@@ -116,6 +118,8 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TYPED_UNIQUE_ID_OVERFLOW) \
     error(MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE) \
@@ -127,6 +131,7 @@ namespace iox
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
     error(MEPOO__TYPED_MEMPOOL_MANAGEMENT_SEGMENT_IS_BROKEN) \
     error(MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT) \
+    error(MEPOO__SEGMENT_WITH_DUPLICATE_WRITER_GROUP_AND_NUMA_NODE) \
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
     error(MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS) \
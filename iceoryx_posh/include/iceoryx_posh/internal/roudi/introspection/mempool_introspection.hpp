@@ -59,6 +59,7 @@ class MemPoolIntrospection
 
     /// @brief This function starts the periodic transmission of snapshots of the mempool introspecton data.
     ///        The send interval can be set by @ref setSendInterval "setSendInterval(...)". By default it's 1 second.
+    ///        With an interval of 0 only one snapshot is sent.
     void run() noexcept;
 
     /// @brief This function stops the thread which sends the introspection data.
@@ -67,7 +68,7 @@ class MemPoolIntrospection
 
     /// @brief This function configures the interval for the transmission of the
     ///        mempool introspection data.
-    /// @param[in] interval duration between two send invocations
+    /// @param[in] interval duration between two send invocations; 0 disables the periodic transmission
     void setSendInterval(const units::Duration interval) noexcept;
 
   protected:
@@ -80,13 +81,18 @@ class MemPoolIntrospection
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const PosixGroup& readerGroup,
                                            const PosixGroup& writerGroup,
+                                           const uint64_t pageSize,
                                            uint32_t id) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
+    /// @brief (re)starts the periodic task with the current send interval; an interval of 0 keeps it stopped
+    void restartPublishingTask() noexcept;
+
   private:
-    units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    units::Duration m_sendInterval{INTROSPECTION_DEFAULT_INTERVAL};
+    bool m_isRunning{false};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "MemPoolIntr", *this, &MemPoolIntrospection::send};
 };
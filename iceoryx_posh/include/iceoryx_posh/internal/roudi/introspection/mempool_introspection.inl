@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_INL
 
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/thread.hpp"
 #include "mempool_introspection.hpp"
 
@@ -45,12 +46,20 @@ inline MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::~MemP
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::run() noexcept
 {
-    m_publishingTask.start(m_sendInterval);
+    // the periodic task sends the first snapshot right away
+    if (m_sendInterval == units::Duration::zero())
+    {
+        send();
+    }
+
+    m_isRunning = true;
+    restartPublishingTask();
 }
 
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::stop() noexcept
 {
+    m_isRunning = false;
     m_publishingTask.stop();
 }
 
@@ -59,9 +68,18 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     const units::Duration interval) noexcept
 {
     m_sendInterval = interval;
-    if (m_publishingTask.is_active())
+    if (m_isRunning)
+    {
+        restartPublishingTask();
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::restartPublishingTask() noexcept
+{
+    m_publishingTask.stop();
+    if (m_sendInterval != units::Duration::zero())
     {
-        m_publishingTask.stop();
         m_publishingTask.start(m_sendInterval);
     }
 }
@@ -71,12 +89,14 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     MemPoolIntrospectionInfo& sample,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
+    const uint64_t pageSize,
     uint32_t id) noexcept
 {
     sample.m_readerGroupName.assign("");
     sample.m_readerGroupName.append(TruncateToCapacity, readerGroup.getName());
     sample.m_writerGroupName.assign("");
     sample.m_writerGroupName.append(TruncateToCapacity, writerGroup.getName());
+    sample.m_pageSize = pageSize;
     sample.m_id = id;
 }
 
@@ -108,6 +128,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             prepareIntrospectionSample(memPoolIntrospectionInfo,
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        PosixGroup::getGroupOfCurrentProcess(),
+                                       detail::pageSize(),
                                        id);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
@@ -118,8 +139,14 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
-                    prepareIntrospectionSample(
-                        memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
+                    prepareIntrospectionSample(memPoolIntrospectionInfo,
+                                               segment.getReaderGroup(),
+                                               segment.getWriterGroup(),
+                                               segment.getPageSize(),
+                                               id);
+                    memPoolIntrospectionInfo.m_numaNode = (segment.isBoundToNumaNode())
+                                                              ? segment.getNumaNode().value()
+                                                              : MemPoolIntrospectionInfo::NO_NUMA_NODE;
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
@@ -164,6 +191,7 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        dst.m_spillAllocations = src.m_spillAllocations;
     }
 }
 
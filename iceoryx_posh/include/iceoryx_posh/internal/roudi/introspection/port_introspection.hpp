@@ -18,18 +18,20 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_PORT_INTROSPECTION_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/seqlock_table.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/service_slot_index.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/periodic_task.hpp"
-#include "iox/fixed_position_container.hpp"
 #include "iox/function.hpp"
+#include "iox/optional.hpp"
 
+#include <chrono>
 #include <mutex>
 
-#include <map>
-
 namespace iox
 {
 namespace roudi
@@ -53,83 +55,70 @@ class PortIntrospection
     using PortIntrospectionTopic = PortIntrospectionFieldTopic;
     using PortThroughputIntrospectionTopic = PortThroughputIntrospectionFieldTopic;
 
+    /// @brief The bookkeeping of the ports. The ports are stored in tables with a sequence counter per slot which
+    /// are written by the discovery of RouDi and read without a lock when the topics are prepared, hence the sampling
+    /// of the introspection blocks the discovery at most while a single entry is read, i.e. when a port is removed
+    /// whose data is still read. The state which is only needed by one side is kept apart
+    /// from the tables; the writers are serialized by a mutex and there must be only one reader thread at a time.
     class PortData
     {
       private:
-        struct Dummy
-        {
-        };
-        using PublisherContainerIndexType = typename FixedPositionContainer<Dummy, MAX_PUBLISHERS>::IndexType;
-        using ConnectionContainerIndexType = typename FixedPositionContainer<Dummy, MAX_SUBSCRIBERS>::IndexType;
-
-        struct ConnectionInfo;
-
         /// internal helper classes
 
+        /// @brief the entries of the tables are copied word by word and must therefore be trivially copyable; the
+        /// name and the service are read from the port data which is alive as long as the port is in the table
         struct PublisherInfo
         {
-            PublisherInfo() noexcept
-            {
-            }
-
-            PublisherInfo(typename PublisherPort::MemberType_t& portData) noexcept
-                : portData(&portData)
-                , process(portData.m_runtimeName)
-                , service(portData.m_serviceDescription)
-            {
-            }
-
-            typename PublisherPort::MemberType_t* portData{nullptr};
-            RuntimeName_t process;
-            capro::ServiceDescription service;
-
-            /// map from indices to ConnectionContainer indices
-            std::map<int, ConnectionContainerIndexType> connectionMap;
-            int index{-1};
+            typename PublisherPort::MemberType_t* portData;
+            uint64_t uniqueId;
         };
 
         struct SubscriberInfo
         {
-            SubscriberInfo() noexcept = default;
-
-            SubscriberInfo(typename SubscriberPort::MemberType_t& portData) noexcept
-                : portData(&portData)
-                , process(portData.m_runtimeName)
-                , service(portData.m_serviceDescription)
-            {
-            }
+            typename SubscriberPort::MemberType_t* portData;
+            uint64_t uniqueId;
+        };
 
-            typename SubscriberPort::MemberType_t* portData{nullptr};
-            RuntimeName_t process;
-            capro::ServiceDescription service;
+        /// @brief the histogram of a connection which measures the latency; it is drained by the reader
+        struct LatencyInfo
+        {
+            uint64_t subscriberId{0U};
+            uint64_t publisherId{0U};
+            popo::LatencyHistogram* histogram{nullptr};
         };
 
+        /// @brief connection of a subscriber, only accessed by the writers
         struct ConnectionInfo
         {
-            ConnectionInfo() noexcept = default;
-
-            ConnectionInfo(typename SubscriberPort::MemberType_t& portData) noexcept
-                : subscriberInfo(portData)
-                , state(ConnectionState::DEFAULT)
-            {
-            }
-
-            ConnectionInfo(SubscriberInfo& subscriberInfo) noexcept
-                : subscriberInfo(subscriberInfo)
-                , state(ConnectionState::DEFAULT)
-            {
-            }
-
-            SubscriberInfo subscriberInfo;
-            iox::optional<PublisherContainerIndexType> publisherInfoIndex;
+            optional<uint64_t> publisherIndex;
             ConnectionState state{ConnectionState::DEFAULT};
 
             bool isConnected() const noexcept
             {
-                return publisherInfoIndex.has_value() && state == ConnectionState::CONNECTED;
+                return publisherIndex.has_value() && state == ConnectionState::CONNECTED;
             }
         };
 
+        /// @brief counters at the time of the previous throughput topic, used to compute the rates and to detect
+        /// changes; only accessed by the reader
+        struct PublisherCounters
+        {
+            uint64_t uniqueId{0U};
+            uint64_t numberOfSentSamples{0U};
+            uint64_t numberOfSentBytes{0U};
+            uint64_t numberOfLoanFailures{0U};
+        };
+
+        /// @brief counters at the time of the previous throughput topic; only accessed by the reader
+        struct SubscriberCounters
+        {
+            uint64_t uniqueId{0U};
+            uint64_t numberOfReceivedSamples{0U};
+            uint64_t numberOfReceivedBytes{0U};
+            uint64_t numberOfDiscardedSamples{0U};
+            uint64_t queueHighWaterMark{0U};
+        };
+
       public:
         PortData() noexcept;
 
@@ -155,6 +144,20 @@ class PortIntrospection
         ///              and true otherwise
         bool removeSubscriber(const SubscriberPort& port) noexcept;
 
+        /// @brief add the latency histogram of a connection to be tracked by introspection
+        /// @param[in] subscriberId unique port id of the subscriber
+        /// @param[in] publisherId unique port id of the publisher
+        /// @param[in] histogram of the connection
+        /// @return returns false if the histogram could not be added and true otherwise
+        bool addLatencyConnection(const popo::UniquePortId& subscriberId,
+                                  const popo::UniquePortId& publisherId,
+                                  popo::LatencyHistogram& histogram) noexcept;
+
+        /// @brief remove the latency histogram of a connection from introspection
+        /// @param[in] histogram of the connection
+        /// @return returns false if the histogram was not tracked and true otherwise
+        bool removeLatencyConnection(const popo::LatencyHistogram& histogram) noexcept;
+
         /// @brief update the state of any connection identified by the capro id of a given message
         ///        according to the message type (e.g. capro::SUB for a subscription request)
         /// @param[in] message capro message to be processed
@@ -175,10 +178,24 @@ class PortIntrospection
         /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortIntrospectionTopic& topic) noexcept;
 
-        void prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept;
+        /// @brief prepare the throughput topic from the counters in the port data; the rates are computed from the
+        /// difference to the counters at the previous call and only the ports whose counters changed are added unless
+        /// a keyframe is requested. The latency histograms are drained, i.e. the latencies cover the time since the
+        /// previous call
+        /// @param[out] topic data structure to be prepared for sending
+        /// @param[in] isKeyframe adds all ports to the topic, also the ones without changes
+        void prepareTopic(PortThroughputIntrospectionTopic& topic, const bool isKeyframe) noexcept;
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
+        /// @brief checks whether subscribers were added or removed or changed their subscription state since the
+        /// previous SubscriberPortChangingIntrospectionFieldTopic was prepared; the subscribers are not read
+        /// @return true if the topic needs to be sent again, false otherwise
+        bool hasSubscriberPortChanges() const noexcept;
+
+        /// @brief marks the SubscriberPortChangingIntrospectionFieldTopic to be sent again
+        void setSubscriberPortsChanged() noexcept;
+
         /// @brief compute the next connection state based on the current connection state and a capro message type when
         /// the communication policy is OneToMany
         /// @param[in] currentState current connection state (e.g. CONNECTED)
@@ -206,23 +223,39 @@ class PortIntrospection
         void setNew(bool value) noexcept;
 
       private:
-        using PublisherContainer = FixedPositionContainer<PublisherInfo, MAX_PUBLISHERS>;
-        using ConnectionContainer = FixedPositionContainer<ConnectionInfo, MAX_SUBSCRIBERS>;
-
-        /// @brief inner map maps from unique port IDs to indices in the PublisherContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, PublisherContainerIndexType>> m_publisherMap;
-
-        /// inner map maps from unique port IDs to indices in the ConnectionContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, ConnectionContainerIndexType>> m_connectionMap;
-
-        /// @note we avoid allocating the objects on the heap but can still use a map
-        /// to locate/remove them fast(er)
-        /// max number needs to be a compile time constant
-        PublisherContainer m_publisherContainer;
-        ConnectionContainer m_connectionContainer;
+        optional<uint64_t> findPublisher(const capro::ServiceDescription& service,
+                                         const uint64_t uniqueId) const noexcept;
+        optional<uint64_t> findSubscriber(const capro::ServiceDescription& service,
+                                          const uint64_t uniqueId) const noexcept;
+
+        const capro::ServiceDescription& publisherService(const uint64_t index) const noexcept;
+        const capro::ServiceDescription& subscriberService(const uint64_t index) const noexcept;
+
+        SeqLockTable<PublisherInfo, MAX_PUBLISHERS> m_publisherTable;
+        SeqLockTable<SubscriberInfo, MAX_SUBSCRIBERS> m_subscriberTable;
+        SeqLockTable<LatencyInfo, MAX_LATENCY_HISTOGRAMS> m_latencyTable;
+
+        /// @brief the slots of the tables by the service of the ports, only accessed by the writers
+        ServiceSlotIndex<MAX_PUBLISHERS> m_publisherIndex;
+        ServiceSlotIndex<MAX_SUBSCRIBERS> m_subscriberIndex;
+
+        /// @brief the connections of the subscribers, the index is the same as in the m_subscriberTable
+        // NOLINTJUSTIFICATION indexed by the slots of m_subscriberTable which are bounded by MAX_SUBSCRIBERS
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        ConnectionInfo m_connections[MAX_SUBSCRIBERS];
+        std::mutex m_writerMutex;
+
+        // NOLINTJUSTIFICATION indexed by the slots of the tables which are bounded by their capacity
+        // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        PublisherCounters m_publisherCounters[MAX_PUBLISHERS];
+        SubscriberCounters m_subscriberCounters[MAX_SUBSCRIBERS];
+        // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        std::chrono::steady_clock::time_point m_lastThroughputTime{std::chrono::steady_clock::now()};
 
         concurrent::Atomic<bool> m_newData;
-        std::mutex m_mutex;
+        /// @brief subscribers were added, removed or reported a changed subscription state since the previous
+        /// SubscriberPortChangingIntrospectionFieldTopic
+        concurrent::Atomic<bool> m_subscriberListChanged{true};
     };
 
     // end of helper classes
@@ -261,6 +294,20 @@ class PortIntrospection
     ///              and true otherwise
     bool removeSubscriber(const SubscriberPort& port) noexcept;
 
+    /// @brief add the latency histogram of a connection to a publisher with 'PublisherOptions::measureLatency'
+    /// @param[in] subscriberId unique port id of the subscriber
+    /// @param[in] publisherId unique port id of the publisher
+    /// @param[in] histogram of the connection
+    /// @return returns false if the histogram could not be added and true otherwise
+    bool addLatencyConnection(const popo::UniquePortId& subscriberId,
+                              const popo::UniquePortId& publisherId,
+                              popo::LatencyHistogram& histogram) noexcept;
+
+    /// @brief remove the latency histogram of a connection; this must be done before the histogram is released
+    /// @param[in] histogram of the connection
+    /// @return returns false if the histogram was not tracked and true otherwise
+    bool removeLatencyConnection(const popo::LatencyHistogram& histogram) noexcept;
+
     /// @brief report a capro message to introspection (since this could change the state of active connections)
     /// @param[in] message capro message to be processed
     void reportMessage(const capro::CaproMessage& message) noexcept;
@@ -273,6 +320,11 @@ class PortIntrospection
     /// which are subscribed to the same topic
     void reportMessage(const capro::CaproMessage& message, const popo::UniquePortId& id) noexcept;
 
+    /// @brief report that the subscription state of subscribers changed; the PortManager calls this after it
+    /// dispatched capro messages to subscriber ports, hence the subscriber ports topic is only prepared and sent
+    /// after such a change and not by polling the subscription state of every subscriber each interval
+    void reportSubscriberStateChange() noexcept;
+
     /// @brief register publisher port used to send introspection
     /// @param[in] publisherPort publisher port to be registered
     /// @return true if registration was successful, false otherwise
@@ -281,10 +333,9 @@ class PortIntrospection
                                PublisherPort&& publisherPortSubscriberPortsData) noexcept;
 
     /// @brief set the time interval used to send new introspection data
-    /// @param[in] interval duration between two send invocations
+    /// @param[in] interval duration between two send invocations; 0 disables the periodic sending
     void setSendInterval(const units::Duration interval) noexcept;
 
-
     /// @brief start the internal send thread
     void run() noexcept;
 
@@ -298,7 +349,8 @@ class PortIntrospection
     /// @brief sends the throughput data; this is used from the unittests
     void sendThroughputData() noexcept;
 
-    /// @brief sends the subscriberport changing data, this is used from the unittests
+    /// @brief sends the subscriberport changing data if it changed since the previous sample, this is used from the
+    /// unittests
     void sendSubscriberPortsData() noexcept;
 
     /// @brief calls the three specific send functions from above, this is used from the periodic task
@@ -310,9 +362,22 @@ class PortIntrospection
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
 
   private:
+    /// @brief (re)starts the periodic task with the current send interval; an interval of 0 keeps it stopped
+    void restartPublishingTask() noexcept;
+
+    /// @brief requests a keyframe of the throughput topic if the message acknowledges a subscription to it
+    /// @param[in] message capro message which was reported
+    void requestThroughputKeyframeOnNewSubscriber(const capro::CaproMessage& message) noexcept;
+
     PortData m_portData;
 
-    units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    /// @brief set when a subscriber connected to the throughput topic, it needs all ports with the next sample
+    concurrent::Atomic<bool> m_throughputKeyframeRequested{false};
+    /// @brief only accessed by the thread which sends the topics
+    uint64_t m_throughputSamplesSinceKeyframe{0U};
+
+    units::Duration m_sendInterval{INTROSPECTION_DEFAULT_INTERVAL};
+    bool m_isRunning{false};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "PortIntr", *this, &PortIntrospection::send};
 };
@@ -44,6 +44,7 @@ template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::reportMessage(const capro::CaproMessage& message) noexcept
 {
     m_portData.updateConnectionState(message);
+    requestThroughputKeyframeOnNewSubscriber(message);
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -51,6 +52,25 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::reportMessage(cons
                                                                             const popo::UniquePortId& id) noexcept
 {
     m_portData.updateSubscriberConnectionState(message, id);
+    requestThroughputKeyframeOnNewSubscriber(message);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::reportSubscriberStateChange() noexcept
+{
+    m_portData.setSubscriberPortsChanged();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::requestThroughputKeyframeOnNewSubscriber(
+    const capro::CaproMessage& message) noexcept
+{
+    // the ACK of the throughput publisher completes the subscription of a new subscriber
+    if (message.m_type == capro::CaproMessageType::ACK
+        && message.m_serviceDescription == IntrospectionPortThroughputService)
+    {
+        m_throughputKeyframeRequested.store(true, std::memory_order_relaxed);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -86,7 +106,8 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
 
-    m_publishingTask.start(m_sendInterval);
+    m_isRunning = true;
+    restartPublishingTask();
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -112,8 +133,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendPortData() noe
         auto sample = static_cast<PortIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
         new (sample) PortIntrospectionFieldTopic();
 
-        m_portData.prepareTopic(*sample); // requires internal mutex (blocks
-                                          // further introspection events)
+        m_portData.prepareTopic(*sample); // does not block further introspection events
         m_publisherPort->sendChunk(maybeChunkHeader.value());
     }
 }
@@ -131,8 +151,18 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendThroughputData
             static_cast<PortThroughputIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
         new (throughputSample) PortThroughputIntrospectionFieldTopic();
 
-        m_portData.prepareTopic(*throughputSample); // requires internal mutex (blocks
-        // further introspection events)
+        // the history of the topic is not sufficient for a late joiner since it contains only the changed ports
+        ++m_throughputSamplesSinceKeyframe;
+        const bool isKeyframe = m_throughputKeyframeRequested.exchange(false, std::memory_order_relaxed)
+                                || m_throughputSamplesSinceKeyframe >= INTROSPECTION_THROUGHPUT_KEYFRAME_INTERVAL;
+        if (isKeyframe)
+        {
+            m_throughputSamplesSinceKeyframe = 0U;
+        }
+        throughputSample->m_isKeyframe = isKeyframe;
+
+        // does not block further introspection events
+        m_portData.prepareTopic(*throughputSample, isKeyframe);
         m_publisherPortThroughput->sendChunk(maybeChunkHeader.value());
     }
 }
@@ -140,6 +170,11 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendThroughputData
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData() noexcept
 {
+    if (!m_portData.hasSubscriberPortChanges())
+    {
+        return;
+    }
+
     auto maybeChunkHeader =
         m_publisherPortSubscriberPortsData->tryAllocateChunk(sizeof(SubscriberPortChangingIntrospectionFieldTopic),
                                                              alignof(SubscriberPortChangingIntrospectionFieldTopic),
@@ -151,8 +186,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
             static_cast<SubscriberPortChangingIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
         new (subscriberPortChangingDataSample) SubscriberPortChangingIntrospectionFieldTopic();
 
-        m_portData.prepareTopic(*subscriberPortChangingDataSample); // requires internal mutex (blocks
-        // further introspection events)
+        m_portData.prepareTopic(*subscriberPortChangingDataSample); // does not block further introspection events
         m_publisherPortSubscriberPortsData->sendChunk(maybeChunkHeader.value());
     }
 }
@@ -161,17 +195,69 @@ template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(const units::Duration interval) noexcept
 {
     m_sendInterval = interval;
-    if (m_publishingTask.is_active())
+    if (m_isRunning)
     {
-        m_publishingTask.stop();
-        m_publishingTask.start(m_sendInterval);
+        restartPublishingTask();
     }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::stop() noexcept
+{
+    m_isRunning = false;
+    m_publishingTask.stop();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::restartPublishingTask() noexcept
 {
     m_publishingTask.stop();
+    if (m_sendInterval != units::Duration::zero())
+    {
+        m_publishingTask.start(m_sendInterval);
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline const capro::ServiceDescription&
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::publisherService(const uint64_t index) const noexcept
+{
+    return m_publisherTable.entry(index).portData->m_serviceDescription;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline const capro::ServiceDescription&
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::subscriberService(const uint64_t index) const noexcept
+{
+    return m_subscriberTable.entry(index).portData->m_serviceDescription;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline optional<uint64_t> PortIntrospection<PublisherPort, SubscriberPort>::PortData::findPublisher(
+    const capro::ServiceDescription& service, const uint64_t uniqueId) const noexcept
+{
+    optional<uint64_t> publisherIndex;
+    m_publisherIndex.forEachInBucket(service, [&](const uint64_t index) {
+        if (m_publisherTable.entry(index).uniqueId == uniqueId && publisherService(index) == service)
+        {
+            publisherIndex = index;
+        }
+    });
+    return publisherIndex;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline optional<uint64_t> PortIntrospection<PublisherPort, SubscriberPort>::PortData::findSubscriber(
+    const capro::ServiceDescription& service, const uint64_t uniqueId) const noexcept
+{
+    optional<uint64_t> subscriberIndex;
+    m_subscriberIndex.forEachInBucket(service, [&](const uint64_t index) {
+        if (m_subscriberTable.entry(index).uniqueId == uniqueId && subscriberService(index) == service)
+        {
+            subscriberIndex = index;
+        }
+    });
+    return subscriberIndex;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -181,20 +267,21 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateCo
     const capro::ServiceDescription& service = message.m_serviceDescription;
     capro::CaproMessageType messageType = message.m_type;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
-    {
-        return false; // no corresponding capro Id ...
-    }
-
-    auto& innerConnectionMap = iter->second;
+    bool hasSubscribers{false};
+    m_subscriberIndex.forEachInBucket(service, [&](const uint64_t index) {
+        if (subscriberService(index) == service)
+        {
+            auto& connection = m_connections[index];
+            connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, messageType);
+            hasSubscribers = true;
+        }
+    });
 
-    for (auto& pair : innerConnectionMap)
+    if (!hasSubscribers)
     {
-        auto connection = m_connectionContainer.iter_from_index(pair.second);
-        connection->state = getNextState<iox::build::CommunicationPolicy>(connection->state, messageType);
+        return false; // no corresponding capro Id ...
     }
 
     setNew(true);
@@ -205,27 +292,18 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateSubscriberConnectionState(
     const capro::CaproMessage& message, const popo::UniquePortId& id) noexcept
 {
-    const capro::ServiceDescription& service = message.m_serviceDescription;
     capro::CaproMessageType messageType = message.m_type;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
+    auto subscriberIndex = findSubscriber(message.m_serviceDescription, static_cast<uint64_t>(id));
+    if (!subscriberIndex.has_value())
     {
-        return false; // no corresponding capro Id ...
+        return false; // no corresponding capro Id or unique port id ...
     }
 
-    auto& innerConnectionMap = iter->second;
-
-    auto iterInnerMap = innerConnectionMap.find(id);
-    if (iterInnerMap == innerConnectionMap.end())
-    {
-        return false;
-    }
-
-    auto connection = m_connectionContainer.iter_from_index(iterInnerMap->second);
-    connection->state = getNextState<iox::build::CommunicationPolicy>(connection->state, messageType);
+    auto& connection = m_connections[subscriberIndex.value()];
+    connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, messageType);
 
     setNew(true);
     return true;
@@ -235,56 +313,29 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addPublisher(
     typename PublisherPort::MemberType_t& port) noexcept
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    auto service = port.m_serviceDescription;
-    auto uniqueId = port.m_uniqueId;
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto publisherInfo = m_publisherContainer.emplace(PublisherInfo(port));
-    if (publisherInfo == m_publisherContainer.end())
+    const auto& service = port.m_serviceDescription;
+    const PublisherInfo publisherInfo{&port, static_cast<uint64_t>(port.m_uniqueId)};
+    if (findPublisher(service, publisherInfo.uniqueId).has_value())
     {
         return false;
     }
 
-    auto iter = m_publisherMap.find(service);
-    if (iter == m_publisherMap.end())
+    auto publisherIndex = m_publisherTable.insert(publisherInfo);
+    if (!publisherIndex.has_value())
     {
-        // service is new, create new map
-        std::map<popo::UniquePortId, PublisherContainerIndexType> innerPublisherMap;
-        innerPublisherMap.insert(std::make_pair(uniqueId, publisherInfo.to_index()));
-        m_publisherMap.insert(std::make_pair(service, innerPublisherMap));
-    }
-    else
-    {
-        // service exists, add new entry
-        auto& innerPublisherMap = iter->second;
-        auto iter = innerPublisherMap.find(uniqueId);
-        if (iter == innerPublisherMap.end())
-        {
-            innerPublisherMap.insert(std::make_pair(uniqueId, publisherInfo.to_index()));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
+    m_publisherIndex.insert(publisherIndex.value(), service);
 
-    // connect publisher to all subscribers with the same Id
-
-    // find corresponding subscribers
-    auto connIter = m_connectionMap.find(service);
-    if (connIter != m_connectionMap.end())
-    {
-        auto& innerConnectionMap = connIter->second;
-        for (auto& pair : innerConnectionMap)
+    // connect publisher to all subscribers with the same service
+    m_subscriberIndex.forEachInBucket(service, [&](const uint64_t index) {
+        if (subscriberService(index) == service)
         {
-            auto connection = m_connectionContainer.iter_from_index(pair.second);
-            if (service == connection->subscriberInfo.service)
-            {
-                connection->publisherInfoIndex = publisherInfo.to_index();
-            }
+            m_connections[index].publisherIndex = publisherIndex.value();
         }
-    }
+    });
 
     setNew(true);
     return true;
@@ -294,60 +345,34 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addSubscriber(
     typename SubscriberPort::MemberType_t& portData) noexcept
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    auto service = portData.m_serviceDescription;
-    auto uniqueId = portData.m_uniqueId;
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto connection = m_connectionContainer.emplace(ConnectionInfo(portData));
-    if (connection == m_connectionContainer.end())
+    const auto& service = portData.m_serviceDescription;
+    const SubscriberInfo subscriberInfo{&portData, static_cast<uint64_t>(portData.m_uniqueId)};
+    if (findSubscriber(service, subscriberInfo.uniqueId).has_value())
     {
         return false;
     }
 
-    auto iter = m_connectionMap.find(service);
-
-    if (iter == m_connectionMap.end())
-    {
-        // service is new, create new map
-        std::map<popo::UniquePortId, ConnectionContainerIndexType> innerConnectionMap;
-        innerConnectionMap.insert(std::make_pair(uniqueId, connection.to_index()));
-        m_connectionMap.insert(std::make_pair(service, innerConnectionMap));
-    }
-    else
+    auto subscriberIndex = m_subscriberTable.insert(subscriberInfo);
+    if (!subscriberIndex.has_value())
     {
-        // service exists, add new entry
-        auto& innerConnectionMap = iter->second;
-        auto iter = innerConnectionMap.find(uniqueId);
-        if (iter == innerConnectionMap.end())
-        {
-            innerConnectionMap.insert(std::make_pair(uniqueId, connection.to_index()));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
+    m_subscriberIndex.insert(subscriberIndex.value(), service);
 
-    auto sendIter = m_publisherMap.find(service);
-    if (sendIter != m_publisherMap.end())
-    {
-        auto& innerPublisherMap = sendIter->second;
-        for (auto& iter : innerPublisherMap)
+    auto& connection = m_connections[subscriberIndex.value()];
+    connection = ConnectionInfo();
+
+    // set corresponding publisher info if exists
+    m_publisherIndex.forEachInBucket(service, [&](const uint64_t index) {
+        if (publisherService(index) == service)
         {
-            auto publisherInfo = m_publisherContainer.iter_from_index(iter.second);
-            // set corresponding publisher info if exists
-            if (publisherInfo != m_publisherContainer.end())
-            {
-                connection->publisherInfoIndex = publisherInfo.to_index();
-            }
-            else
-            {
-                connection->publisherInfoIndex.reset();
-            }
+            connection.publisherIndex = index;
         }
-    }
+    });
 
+    m_subscriberListChanged.store(true, std::memory_order_release);
     return true;
 }
 
@@ -355,36 +380,27 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool
 PortIntrospection<PublisherPort, SubscriberPort>::PortData::removePublisher(const PublisherPort& port) noexcept
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto iter = m_publisherMap.find(port.getCaProServiceDescription());
-    if (iter == m_publisherMap.end())
+    auto publisherIndex =
+        findPublisher(port.getCaProServiceDescription(), static_cast<uint64_t>(port.getUniqueID()));
+    if (!publisherIndex.has_value())
     {
         return false;
     }
 
-    auto& innerPublisherMap = iter->second;
-    auto iterInnerMap = innerPublisherMap.find(port.getUniqueID());
-    if (iterInnerMap == innerPublisherMap.end())
-    {
-        return false;
-    }
-    auto m_publisherIndex = iterInnerMap->second;
-    auto publisher = m_publisherContainer.iter_from_index(m_publisherIndex);
-
     // disconnect publisher from all its subscribers
-    for (auto& pair : publisher->connectionMap)
+    for (auto& connection : m_connections)
     {
-        auto connIter = m_connectionContainer.iter_from_index(pair.second);
-        if (connIter != m_connectionContainer.end())
+        if (connection.publisherIndex == publisherIndex)
         {
-            connIter->publisherInfoIndex.reset();       // publisher is disconnected
-            connIter->state = ConnectionState::DEFAULT; // connection state is now default
+            connection.publisherIndex.reset();          // publisher is disconnected
+            connection.state = ConnectionState::DEFAULT; // connection state is now default
         }
     }
 
-    innerPublisherMap.erase(iterInnerMap);
-    m_publisherContainer.erase(publisher);
+    m_publisherIndex.remove(publisherIndex.value(), port.getCaProServiceDescription());
+    m_publisherTable.erase(publisherIndex.value());
     setNew(true); // indicates we have to send new data because
                   // something changed
 
@@ -395,45 +411,62 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool
 PortIntrospection<PublisherPort, SubscriberPort>::PortData::removeSubscriber(const SubscriberPort& port) noexcept
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    auto iter = m_connectionMap.find(port.getCaProServiceDescription());
-    if (iter == m_connectionMap.end())
+    auto subscriberIndex =
+        findSubscriber(port.getCaProServiceDescription(), static_cast<uint64_t>(port.getUniqueID()));
+    if (!subscriberIndex.has_value())
     {
         return false; // not found and therefore not removed
     }
 
-    auto& innerConnectionMap = iter->second;
-    auto mapIter = innerConnectionMap.find(port.getUniqueID());
+    m_subscriberIndex.remove(subscriberIndex.value(), port.getCaProServiceDescription());
+    m_subscriberTable.erase(subscriberIndex.value());
+    m_connections[subscriberIndex.value()] = ConnectionInfo();
 
-    if (mapIter == innerConnectionMap.end())
-    {
-        return false; // not found and therefore not removed
-    }
+    m_subscriberListChanged.store(true, std::memory_order_release);
+    setNew(true);
+    return true;
+}
 
-    // remove subscriber in corresponding publisher
-    auto connectionIndex = mapIter->second;
-    auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-    auto publisherInfoIndex = connection->publisherInfoIndex;
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addLatencyConnection(
+    const popo::UniquePortId& subscriberId,
+    const popo::UniquePortId& publisherId,
+    popo::LatencyHistogram& histogram) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_writerMutex);
 
-    if (publisherInfoIndex.has_value())
+    for (uint64_t index = 0U; index < MAX_LATENCY_HISTOGRAMS; ++index)
     {
-        auto publisherInfo = m_publisherContainer.iter_from_index(publisherInfoIndex.value());
-        if (publisherInfo != m_publisherContainer.end())
+        if (m_latencyTable.isUsed(index) && m_latencyTable.entry(index).histogram == &histogram)
         {
-            auto connIter = publisherInfo->connectionMap.find(connectionIndex);
-            if (connIter != publisherInfo->connectionMap.end())
-            {
-                publisherInfo->connectionMap.erase(connIter);
-            }
+            return false;
         }
     }
 
-    innerConnectionMap.erase(mapIter);
-    m_connectionContainer.erase(connection);
+    LatencyInfo latencyInfo;
+    latencyInfo.subscriberId = static_cast<uint64_t>(subscriberId);
+    latencyInfo.publisherId = static_cast<uint64_t>(publisherId);
+    latencyInfo.histogram = &histogram;
+    return m_latencyTable.insert(latencyInfo).has_value();
+}
 
-    setNew(true);
-    return true;
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::removeLatencyConnection(
+    const popo::LatencyHistogram& histogram) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_writerMutex);
+
+    for (uint64_t index = 0U; index < MAX_LATENCY_HISTOGRAMS; ++index)
+    {
+        if (m_latencyTable.isUsed(index) && m_latencyTable.entry(index).histogram == &histogram)
+        {
+            m_latencyTable.erase(index);
+            return true;
+        }
+    }
+    return false;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -533,107 +566,237 @@ template <typename PublisherPort, typename SubscriberPort>
 inline void
 PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortIntrospectionTopic& topic) noexcept
 {
-    auto& m_publisherList = topic.m_publisherList;
-
-    std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
+    // reset before the tables are read, a concurrent change sets the flag again and is sent with the next topic
+    setNew(false);
 
-    int32_t index{0};
-    for (auto& pub : m_publisherMap)
-    {
-        auto& innerPublisherMap = pub.second;
-        for (auto& pair : innerPublisherMap)
+    auto& m_publisherList = topic.m_publisherList;
+    for (uint64_t index = 0U; index < MAX_PUBLISHERS; ++index)
+    {
+        PublisherPortData publisherData;
+        const bool isUsed = m_publisherTable.read(index, [&](const PublisherInfo& publisherInfo) {
+            const auto& service = publisherInfo.portData->m_serviceDescription;
+            publisherData.m_publisherPortID = publisherInfo.uniqueId;
+            publisherData.m_sourceInterface = service.getSourceInterface();
+            publisherData.m_name = publisherInfo.portData->m_runtimeName;
+
+            publisherData.m_caproInstanceID = service.getInstanceIDString();
+            publisherData.m_caproServiceID = service.getServiceIDString();
+            publisherData.m_caproEventMethodID = service.getEventIDString();
+        });
+        if (isUsed)
         {
-            auto m_publisherIndex = pair.second;
-            if (m_publisherIndex >= 0)
-            {
-                auto publisherInfo = m_publisherContainer.iter_from_index(m_publisherIndex);
-                PublisherPortData publisherData;
-                PublisherPort port(publisherInfo->portData);
-                publisherData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
-                publisherData.m_sourceInterface = publisherInfo->service.getSourceInterface();
-                publisherData.m_name = publisherInfo->process;
-
-                publisherData.m_caproInstanceID = publisherInfo->service.getInstanceIDString();
-                publisherData.m_caproServiceID = publisherInfo->service.getServiceIDString();
-                publisherData.m_caproEventMethodID = publisherInfo->service.getEventIDString();
-
-                m_publisherList.emplace_back(publisherData);
-                publisherInfo->index = index++;
-            }
+            m_publisherList.emplace_back(publisherData);
         }
     }
 
     auto& m_subscriberList = topic.m_subscriberList;
-    for (auto& connPair : m_connectionMap)
-    {
-        for (auto& pair : connPair.second)
+    for (uint64_t index = 0U; index < MAX_SUBSCRIBERS; ++index)
+    {
+        SubscriberPortData subscriberData;
+        const bool isUsed = m_subscriberTable.read(index, [&](const SubscriberInfo& subscriberInfo) {
+            const auto& service = subscriberInfo.portData->m_serviceDescription;
+            subscriberData.m_name = subscriberInfo.portData->m_runtimeName;
+
+            subscriberData.m_caproInstanceID = service.getInstanceIDString();
+            subscriberData.m_caproServiceID = service.getServiceIDString();
+            subscriberData.m_caproEventMethodID = service.getEventIDString();
+        });
+        if (isUsed)
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
-            {
-                auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-                SubscriberPortData subscriberData;
-                auto& subscriberInfo = connection->subscriberInfo;
+            m_subscriberList.emplace_back(subscriberData);
+        }
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic, const bool isKeyframe) noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto intervalInNanoseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastThroughputTime).count());
+    m_lastThroughputTime = now;
+    const double intervalInSeconds = static_cast<double>(intervalInNanoseconds) / 1.0e9;
+    auto perSecond = [&](const uint64_t delta) -> double {
+        return (intervalInNanoseconds > 0U) ? static_cast<double>(delta) / intervalInSeconds : 0.0;
+    };
+
+    // only the ports whose counters changed are added, except for a keyframe; the port data is read in the reader
+    // since it is destroyed only after the port was removed from the introspection, which waits for the reader
+    for (uint64_t index = 0U; index < MAX_PUBLISHERS; ++index)
+    {
+        PortThroughputData throughputData;
+        const bool isUsed = m_publisherTable.read(index, [&](const PublisherInfo& publisherInfo) {
+            const auto& statistics = publisherInfo.portData->m_statistics;
+            throughputData.m_publisherPortID = publisherInfo.uniqueId;
+            throughputData.m_numberOfSentSamples = statistics.m_numberOfSentSamples.load(std::memory_order_relaxed);
+            throughputData.m_numberOfSentBytes = statistics.m_numberOfSentBytes.load(std::memory_order_relaxed);
+            throughputData.m_numberOfLoanFailures = statistics.m_numberOfLoanFailures.load(std::memory_order_relaxed);
+            throughputData.m_chunkSize = statistics.m_lastChunkSize.load(std::memory_order_relaxed);
+            throughputData.m_isField = publisherInfo.portData->m_options.historyCapacity > 0U;
+        });
+        if (!isUsed)
+        {
+            continue;
+        }
+
+        auto& counters = m_publisherCounters[index];
+        if (counters.uniqueId != throughputData.m_publisherPortID)
+        {
+            // the slot was reused by another port
+            counters = PublisherCounters();
+            counters.uniqueId = throughputData.m_publisherPortID;
+        }
+
+        const auto numberOfSentSamples = throughputData.m_numberOfSentSamples;
+        const auto numberOfSentBytes = throughputData.m_numberOfSentBytes;
+        const auto deltaSamples = numberOfSentSamples - counters.numberOfSentSamples;
+        const auto deltaBytes = numberOfSentBytes - counters.numberOfSentBytes;
+        if (!isKeyframe && deltaSamples == 0U
+            && throughputData.m_numberOfLoanFailures == counters.numberOfLoanFailures)
+        {
+            // idle ports are left out, the subscribers keep the counters of the previous samples
+            continue;
+        }
+        counters.numberOfSentSamples = numberOfSentSamples;
+        counters.numberOfSentBytes = numberOfSentBytes;
+        counters.numberOfLoanFailures = throughputData.m_numberOfLoanFailures;
+
+        throughputData.m_sampleSize = (numberOfSentSamples > 0U) ? numberOfSentBytes / numberOfSentSamples : 0U;
+        throughputData.m_chunksPerMinute = perSecond(deltaSamples) * 60.0;
+        throughputData.m_lastSendIntervalInNanoseconds =
+            (deltaSamples > 0U) ? intervalInNanoseconds / deltaSamples : 0U;
+        throughputData.m_sentBytesPerSecond = perSecond(deltaBytes);
+        topic.m_throughputList.emplace_back(throughputData);
+    }
+
+    for (uint64_t index = 0U; index < MAX_SUBSCRIBERS; ++index)
+    {
+        SubscriberThroughputData throughputData;
+        const bool isUsed = m_subscriberTable.read(index, [&](const SubscriberInfo& subscriberInfo) {
+            const auto& statistics = subscriberInfo.portData->m_statistics;
+            const auto& receiverData = subscriberInfo.portData->m_chunkReceiverData;
+            throughputData.m_subscriberPortID = subscriberInfo.uniqueId;
+            throughputData.m_numberOfReceivedSamples =
+                statistics.m_numberOfReceivedSamples.load(std::memory_order_relaxed);
+            throughputData.m_numberOfReceivedBytes = statistics.m_numberOfReceivedBytes.load(std::memory_order_relaxed);
+            throughputData.m_numberOfDiscardedSamples =
+                receiverData.m_numberOfDiscardedChunks.load(std::memory_order_relaxed);
+            throughputData.m_queueHighWaterMark = receiverData.m_highWaterMark.load(std::memory_order_relaxed);
+        });
+        if (!isUsed)
+        {
+            continue;
+        }
+
+        auto& counters = m_subscriberCounters[index];
+        if (counters.uniqueId != throughputData.m_subscriberPortID)
+        {
+            // the slot was reused by another port
+            counters = SubscriberCounters();
+            counters.uniqueId = throughputData.m_subscriberPortID;
+        }
 
-                subscriberData.m_name = subscriberInfo.process;
+        if (!isKeyframe && throughputData.m_numberOfReceivedSamples == counters.numberOfReceivedSamples
+            && throughputData.m_numberOfDiscardedSamples == counters.numberOfDiscardedSamples
+            && throughputData.m_queueHighWaterMark == counters.queueHighWaterMark)
+        {
+            continue;
+        }
 
-                subscriberData.m_caproInstanceID = subscriberInfo.service.getInstanceIDString();
-                subscriberData.m_caproServiceID = subscriberInfo.service.getServiceIDString();
-                subscriberData.m_caproEventMethodID = subscriberInfo.service.getEventIDString();
-                m_subscriberList.emplace_back(subscriberData);
+        // the queue capacity is only read for the ports which are added
+        bool isSamePort{false};
+        m_subscriberTable.read(index, [&](const SubscriberInfo& subscriberInfo) {
+            isSamePort = (subscriberInfo.uniqueId == throughputData.m_subscriberPortID);
+            if (isSamePort)
+            {
+                throughputData.m_queueCapacity = subscriberInfo.portData->m_chunkReceiverData.m_queue.capacity();
             }
+        });
+        if (!isSamePort)
+        {
+            continue;
         }
-    }
 
-    // needs to be done while holding the lock
-    setNew(false);
-}
+        throughputData.m_receivedSamplesPerSecond =
+            perSecond(throughputData.m_numberOfReceivedSamples - counters.numberOfReceivedSamples);
+        throughputData.m_receivedBytesPerSecond =
+            perSecond(throughputData.m_numberOfReceivedBytes - counters.numberOfReceivedBytes);
+
+        counters.numberOfReceivedSamples = throughputData.m_numberOfReceivedSamples;
+        counters.numberOfReceivedBytes = throughputData.m_numberOfReceivedBytes;
+        counters.numberOfDiscardedSamples = throughputData.m_numberOfDiscardedSamples;
+        counters.queueHighWaterMark = throughputData.m_queueHighWaterMark;
+        topic.m_subscriberThroughputList.emplace_back(throughputData);
+    }
+
+    // the histograms are drained in the reader since they are released to the pool only after they were removed
+    // from the introspection
+    for (uint64_t index = 0U; index < MAX_LATENCY_HISTOGRAMS; ++index)
+    {
+        LatencyInfo latencyInfo;
+        popo::LatencyStatistics statistics;
+        m_latencyTable.read(index, [&](const LatencyInfo& info) {
+            latencyInfo = info;
+            statistics = info.histogram->takeStatistics();
+        });
+        if (statistics.numberOfSamples == 0U)
+        {
+            continue;
+        }
 
-template <typename PublisherPort, typename SubscriberPort>
-inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
-{
-    /// @todo iox-#402 re-add port throughput
+        ConnectionLatencyData latencyData;
+        latencyData.m_subscriberPortID = latencyInfo.subscriberId;
+        latencyData.m_publisherPortID = latencyInfo.publisherId;
+        latencyData.m_numberOfSamples = statistics.numberOfSamples;
+        latencyData.m_p50InNanoseconds = statistics.p50InNanoseconds;
+        latencyData.m_p99InNanoseconds = statistics.p99InNanoseconds;
+        latencyData.m_p999InNanoseconds = statistics.p999InNanoseconds;
+        latencyData.m_maxInNanoseconds = statistics.maxInNanoseconds;
+        topic.m_connectionLatencyList.emplace_back(latencyData);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
     SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& connPair : m_connectionMap)
+    // reset before the table is read, a concurrent change sets the flag again and is sent with the next topic; the
+    // acquire synchronizes with the change which was reported before
+    m_subscriberListChanged.exchange(false, std::memory_order_acq_rel);
+
+    for (uint64_t index = 0U; index < MAX_SUBSCRIBERS; ++index)
     {
-        for (auto& pair : connPair.second)
+        SubscriberPortChangingData subscriberData;
+        const bool isUsed = m_subscriberTable.read(index, [&](const SubscriberInfo& subscriberInfo) {
+            SubscriberPort port(subscriberInfo.portData);
+            subscriberData.subscriptionState = port.getSubscriptionState();
+
+            // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
+            // subscriberData.fifoSize = port.getDeliveryFiFoSize();
+            subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+        });
+        if (!isUsed)
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
-            {
-                auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-                auto& subscriberInfo = connection->subscriberInfo;
-                SubscriberPortChangingData subscriberData;
-                if (subscriberInfo.portData != nullptr)
-                {
-                    SubscriberPort port(subscriberInfo.portData);
-                    subscriberData.subscriptionState = port.getSubscriptionState();
-
-                    // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
-                    // subscriberData.fifoSize = port.getDeliveryFiFoSize();
-                    subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
-                }
-                else
-                {
-                    subscriberData.fifoCapacity = 0u;
-                    subscriberData.fifoSize = 0u;
-                    subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
-                    subscriberData.propagationScope = capro::Scope::INVALID;
-                }
-                topic.subscriberPortChangingDataList.push_back(subscriberData);
-            }
+            continue;
         }
+
+        topic.subscriberPortChangingDataList.push_back(subscriberData);
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::hasSubscriberPortChanges() const noexcept
+{
+    return m_subscriberListChanged.load(std::memory_order_acquire);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::setSubscriberPortsChanged() noexcept
+{
+    m_subscriberListChanged.store(true, std::memory_order_release);
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::isNew() const noexcept
 {
@@ -672,6 +835,22 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::removeSubscriber(c
     return m_portData.removeSubscriber(port);
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline bool
+PortIntrospection<PublisherPort, SubscriberPort>::addLatencyConnection(const popo::UniquePortId& subscriberId,
+                                                                       const popo::UniquePortId& publisherId,
+                                                                       popo::LatencyHistogram& histogram) noexcept
+{
+    return m_portData.addLatencyConnection(subscriberId, publisherId, histogram);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::removeLatencyConnection(
+    const popo::LatencyHistogram& histogram) noexcept
+{
+    return m_portData.removeLatencyConnection(histogram);
+}
+
 } // namespace roudi
 } // namespace iox
 
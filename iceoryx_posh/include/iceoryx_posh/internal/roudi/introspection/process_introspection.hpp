@@ -19,12 +19,15 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/process_statistics.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
 #include "iox/detail/periodic_task.hpp"
 #include "iox/function.hpp"
 #include "iox/list.hpp"
+#include "iox/vector.hpp"
 
+#include <chrono>
 #include <mutex>
 
 namespace iox
@@ -35,7 +38,10 @@ namespace roudi
 ///        It is recommended to use the ProcessIntrospectionType alias which sets
 ///        the intended template parameter.
 ///        The class tracks the adding and removal of processes and sends it to
-///        the introspection client if subscribed.
+///        the introspection client if subscribed. Additionally, the CPU, memory
+///        and context switch statistics of a limited number of processes are
+///        sampled round-robin in every interval and the changed ones are sent
+///        on a separate topic, hence the process list is only sent on changes.
 template <typename PublisherPort>
 class ProcessIntrospection
 {
@@ -60,10 +66,11 @@ class ProcessIntrospection
     /// @param[in] pid is the PID of the process to remove
     void removeProcess(const int pid) noexcept;
 
-    /// @brief This functions registers the POSH publisher port which is used
+    /// @brief This functions registers the POSH publisher ports which are used
     ///        to send the data to the instrospcetion client
-    /// @param publisherPort is the publisher port for transmission
-    void registerPublisherPort(PublisherPort&& publisherPort) noexcept;
+    /// @param publisherPort is the publisher port for transmission of the process list
+    /// @param statisticsPublisherPort is the publisher port for transmission of the process statistics
+    void registerPublisherPort(PublisherPort&& publisherPort, PublisherPort&& statisticsPublisherPort) noexcept;
 
     /// @brief This function starts a thread which periodically sends
     ///        the introspection data to the client. The send interval
@@ -77,21 +84,62 @@ class ProcessIntrospection
 
     /// @brief This function configures the interval for the transmission of the
     ///        port introspection data.
-    /// @param[in] interval duration between two send invocations.
+    /// @param[in] interval duration between two send invocations; 0 disables the periodic transmission
     void setSendInterval(const units::Duration interval) noexcept;
 
+    /// @brief This function configures how many processes are sampled for their statistics per send interval.
+    ///        Every sample reads the proc filesystem, hence this bounds the cost of the process introspection.
+    /// @param[in] samplesPerInterval maximum number of processes which are sampled per interval; 0 disables the
+    ///            sampling and the statistics of the processes stay 0
+    void setStatisticsSamplesPerInterval(const uint32_t samplesPerInterval) noexcept;
+
   protected:
     optional<PublisherPort> m_publisherPort;
+    optional<PublisherPort> m_statisticsPublisherPort;
     void send() noexcept;
 
   private:
-    using ProcessList_t = iox::list<ProcessIntrospectionData, MAX_PROCESS_NUMBER>;
+    /// @brief (re)starts the periodic task with the current send interval; an interval of 0 keeps it stopped
+    void restartPublishingTask() noexcept;
+
+    /// @brief reads the statistics of the next processes in round-robin order and collects the changed ones in
+    /// m_changedStatistics; the proc filesystem is read without holding the mutex in order to not delay the
+    /// registration of processes
+    void sampleStatistics() noexcept;
+
+    void sendProcessList() noexcept;
+    void sendStatistics() noexcept;
+
+    struct ProcessEntry
+    {
+        ProcessIntrospectionData data;
+        ProcessStatisticsData statistics;
+        std::chrono::steady_clock::time_point lastSampleTime;
+        bool hasStatistics{false};
+    };
+
+    struct StatisticsSample
+    {
+        int pid{0};
+        optional<ProcessStatistics> statistics;
+        std::chrono::steady_clock::time_point sampleTime;
+    };
+
+    using ProcessList_t = iox::list<ProcessEntry, MAX_PROCESS_NUMBER>;
     ProcessList_t m_processList;
     bool m_processListNewData{true}; // true because we want to have a valid field, even with an empty list
 
     std::mutex m_mutex;
 
-    units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    ProcessStatisticsReader m_statisticsReader;
+    uint32_t m_statisticsSamplesPerInterval{PROCESS_STATISTICS_DEFAULT_SAMPLES_PER_INTERVAL};
+    uint64_t m_nextStatisticsSampleIndex{0U};
+    /// @brief only used by 'send' and therefore not guarded by the mutex
+    vector<StatisticsSample, MAX_PROCESS_NUMBER> m_statisticsSamples;
+    vector<ProcessStatisticsData, MAX_PROCESS_NUMBER> m_changedStatistics;
+
+    units::Duration m_sendInterval{INTROSPECTION_DEFAULT_INTERVAL};
+    bool m_isRunning{false};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "ProcessIntr", *this, &ProcessIntrospection::send};
 };
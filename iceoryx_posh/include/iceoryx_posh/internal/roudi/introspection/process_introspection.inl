@@ -22,6 +22,7 @@
 #include "iox/logging.hpp"
 #include "iox/thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 namespace iox
@@ -41,6 +42,10 @@ inline ProcessIntrospection<PublisherPort>::~ProcessIntrospection() noexcept
     {
         m_publisherPort->stopOffer();
     }
+    if (m_statisticsPublisherPort.has_value())
+    {
+        m_statisticsPublisherPort->stopOffer();
+    }
 }
 
 template <typename PublisherPort>
@@ -52,7 +57,7 @@ inline void ProcessIntrospection<PublisherPort>::addProcess(const int pid, const
 
     {
         std::lock_guard<std::mutex> guard(m_mutex);
-        m_processList.push_back(procIntrData);
+        m_processList.push_back(ProcessEntry{procIntrData, {}, {}, false});
         m_processListNewData = true;
     }
 }
@@ -64,7 +69,7 @@ inline void ProcessIntrospection<PublisherPort>::removeProcess(const int pid) no
 
     for (auto it = m_processList.begin(); it != m_processList.end(); ++it)
     {
-        if (it->m_pid == pid)
+        if (it->data.m_pid == pid)
         {
             m_processList.erase(it);
             break;
@@ -74,12 +79,14 @@ inline void ProcessIntrospection<PublisherPort>::removeProcess(const int pid) no
 }
 
 template <typename PublisherPort>
-inline void ProcessIntrospection<PublisherPort>::registerPublisherPort(PublisherPort&& publisherPort) noexcept
+inline void ProcessIntrospection<PublisherPort>::registerPublisherPort(PublisherPort&& publisherPort,
+                                                                       PublisherPort&& statisticsPublisherPort) noexcept
 {
     // we do not want to call this twice
     if (!m_publisherPort.has_value())
     {
         m_publisherPort.emplace(std::move(publisherPort));
+        m_statisticsPublisherPort.emplace(std::move(statisticsPublisherPort));
     }
 }
 
@@ -88,16 +95,27 @@ inline void ProcessIntrospection<PublisherPort>::run() noexcept
 {
     // @todo iox-#518 error handling for non debug builds
     IOX_ENFORCE(m_publisherPort.has_value(), "Port must be initialized");
+    IOX_ENFORCE(m_statisticsPublisherPort.has_value(), "Port must be initialized");
 
     // this is a field, there needs to be a sample before activate is called
     send();
     m_publisherPort->offer();
+    m_statisticsPublisherPort->offer();
 
-    m_publishingTask.start(m_sendInterval);
+    m_isRunning = true;
+    restartPublishingTask();
 }
 
 template <typename PublisherPort>
 inline void ProcessIntrospection<PublisherPort>::send() noexcept
+{
+    sampleStatistics();
+    sendProcessList();
+    sendStatistics();
+}
+
+template <typename PublisherPort>
+inline void ProcessIntrospection<PublisherPort>::sendProcessList() noexcept
 {
     std::lock_guard<std::mutex> guard(m_mutex);
     if (m_processListNewData)
@@ -111,9 +129,9 @@ inline void ProcessIntrospection<PublisherPort>::send() noexcept
             auto sample = static_cast<ProcessIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
             new (sample) ProcessIntrospectionFieldTopic;
 
-            for (auto& intrData : m_processList)
+            for (auto& entry : m_processList)
             {
-                sample->m_processList.emplace_back(intrData);
+                sample->m_processList.emplace_back(entry.data);
             }
             m_processListNewData = false;
 
@@ -122,9 +140,137 @@ inline void ProcessIntrospection<PublisherPort>::send() noexcept
     }
 }
 
+template <typename PublisherPort>
+inline void ProcessIntrospection<PublisherPort>::sendStatistics() noexcept
+{
+    if (m_changedStatistics.empty())
+    {
+        return;
+    }
+
+    auto maybeChunkHeader = m_statisticsPublisherPort->tryAllocateChunk(sizeof(ProcessStatisticsIntrospectionTopic),
+                                                                        alignof(ProcessStatisticsIntrospectionTopic),
+                                                                        CHUNK_NO_USER_HEADER_SIZE,
+                                                                        CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_value())
+    {
+        auto sample = static_cast<ProcessStatisticsIntrospectionTopic*>(maybeChunkHeader.value()->userPayload());
+        new (sample) ProcessStatisticsIntrospectionTopic;
+
+        for (const auto& statistics : m_changedStatistics)
+        {
+            sample->m_processStatisticsList.emplace_back(statistics);
+        }
+
+        m_statisticsPublisherPort->sendChunk(maybeChunkHeader.value());
+    }
+}
+
+template <typename PublisherPort>
+inline void ProcessIntrospection<PublisherPort>::sampleStatistics() noexcept
+{
+    m_statisticsSamples.clear();
+    m_changedStatistics.clear();
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        const uint64_t numberOfProcesses = m_processList.size();
+        if (m_statisticsSamplesPerInterval == 0U || numberOfProcesses == 0U)
+        {
+            return;
+        }
+
+        const uint64_t numberOfSamples =
+            std::min(static_cast<uint64_t>(m_statisticsSamplesPerInterval), numberOfProcesses);
+        const uint64_t firstIndex = m_nextStatisticsSampleIndex % numberOfProcesses;
+        // the indices wrap around at the end of the list
+        uint64_t index{0U};
+        for (auto& entry : m_processList)
+        {
+            const uint64_t distanceToFirst = (index + numberOfProcesses - firstIndex) % numberOfProcesses;
+            if (distanceToFirst < numberOfSamples)
+            {
+                m_statisticsSamples.push_back(StatisticsSample{entry.data.m_pid, nullopt, {}});
+            }
+            ++index;
+        }
+        m_nextStatisticsSampleIndex = (firstIndex + numberOfSamples) % numberOfProcesses;
+    }
+
+    for (auto& sample : m_statisticsSamples)
+    {
+        sample.statistics = m_statisticsReader.read(sample.pid);
+        sample.sampleTime = std::chrono::steady_clock::now();
+    }
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    for (const auto& sample : m_statisticsSamples)
+    {
+        if (!sample.statistics.has_value())
+        {
+            continue;
+        }
+        // the process could have been removed meanwhile
+        for (auto& entry : m_processList)
+        {
+            if (entry.data.m_pid != sample.pid)
+            {
+                continue;
+            }
+
+            auto& data = entry.statistics;
+            const auto& statistics = sample.statistics.value();
+            const uint64_t previousCpuTime = data.m_userCpuTimeInNanoseconds + data.m_systemCpuTimeInNanoseconds;
+            const uint64_t cpuTime = statistics.userCpuTimeInNanoseconds + statistics.systemCpuTimeInNanoseconds;
+
+            double cpuUsagePercent{0.0};
+            if (entry.hasStatistics && cpuTime >= previousCpuTime)
+            {
+                const auto elapsedTime =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(sample.sampleTime - entry.lastSampleTime);
+                if (elapsedTime.count() > 0)
+                {
+                    constexpr double PERCENT{100.0};
+                    cpuUsagePercent = PERCENT * static_cast<double>(cpuTime - previousCpuTime)
+                                      / static_cast<double>(elapsedTime.count());
+                }
+            }
+
+            const bool hasChanged = !entry.hasStatistics || cpuTime != previousCpuTime
+                                    || data.m_residentSetSizeInBytes != statistics.residentSetSizeInBytes
+                                    || data.m_numberOfVoluntaryContextSwitches
+                                           != statistics.numberOfVoluntaryContextSwitches
+                                    || data.m_numberOfInvoluntaryContextSwitches
+                                           != statistics.numberOfInvoluntaryContextSwitches
+                                    || data.m_numberOfMinorPageFaults != statistics.numberOfMinorPageFaults
+                                    || data.m_numberOfMajorPageFaults != statistics.numberOfMajorPageFaults
+                                    // an unchanged CPU time resets a previous usage to 0
+                                    || data.m_cpuUsagePercent > 0.0;
+
+            data.m_userCpuTimeInNanoseconds = statistics.userCpuTimeInNanoseconds;
+            data.m_systemCpuTimeInNanoseconds = statistics.systemCpuTimeInNanoseconds;
+            data.m_cpuUsagePercent = cpuUsagePercent;
+            data.m_residentSetSizeInBytes = statistics.residentSetSizeInBytes;
+            data.m_numberOfVoluntaryContextSwitches = statistics.numberOfVoluntaryContextSwitches;
+            data.m_numberOfInvoluntaryContextSwitches = statistics.numberOfInvoluntaryContextSwitches;
+            data.m_numberOfMinorPageFaults = statistics.numberOfMinorPageFaults;
+            data.m_numberOfMajorPageFaults = statistics.numberOfMajorPageFaults;
+            data.m_pid = sample.pid;
+            entry.lastSampleTime = sample.sampleTime;
+            entry.hasStatistics = true;
+
+            if (hasChanged)
+            {
+                m_changedStatistics.push_back(data);
+            }
+            break;
+        }
+    }
+}
+
 template <typename PublisherPort>
 inline void ProcessIntrospection<PublisherPort>::stop() noexcept
 {
+    m_isRunning = false;
     m_publishingTask.stop();
 }
 
@@ -132,9 +278,26 @@ template <typename PublisherPort>
 inline void ProcessIntrospection<PublisherPort>::setSendInterval(const units::Duration interval) noexcept
 {
     m_sendInterval = interval;
-    if (m_publishingTask.is_active())
+    if (m_isRunning)
+    {
+        restartPublishingTask();
+    }
+}
+
+template <typename PublisherPort>
+inline void
+ProcessIntrospection<PublisherPort>::setStatisticsSamplesPerInterval(const uint32_t samplesPerInterval) noexcept
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_statisticsSamplesPerInterval = samplesPerInterval;
+}
+
+template <typename PublisherPort>
+inline void ProcessIntrospection<PublisherPort>::restartPublishingTask() noexcept
+{
+    m_publishingTask.stop();
+    if (m_sendInterval != units::Duration::zero())
     {
-        m_publishingTask.stop();
         m_publishingTask.start(m_sendInterval);
     }
 }
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_PROCESS_STATISTICS_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_PROCESS_STATISTICS_HPP
+
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Resource usage of a process as reported by the operating system
+struct ProcessStatistics
+{
+    uint64_t userCpuTimeInNanoseconds{0U};
+    uint64_t systemCpuTimeInNanoseconds{0U};
+    uint64_t residentSetSizeInBytes{0U};
+    uint64_t numberOfVoluntaryContextSwitches{0U};
+    uint64_t numberOfInvoluntaryContextSwitches{0U};
+    uint64_t numberOfMinorPageFaults{0U};
+    uint64_t numberOfMajorPageFaults{0U};
+};
+
+/// @brief Reads the resource usage of arbitrary processes from the proc filesystem, i.e. '/proc/<pid>/stat' and
+/// '/proc/<pid>/status'. A read costs two small file reads and does not allocate.
+/// @note On platforms without a proc filesystem no statistics are available
+class ProcessStatisticsReader
+{
+  public:
+    /// @brief Queries the clock ticks and the page size which are required to convert the raw values
+    ProcessStatisticsReader() noexcept;
+
+    /// @brief Reads the current statistics of a process
+    /// @param[in] pid of the process
+    /// @return the statistics or nullopt if the process does not exist or the statistics are not available
+    optional<ProcessStatistics> read(const int pid) const noexcept;
+
+    /// @brief Parses the content of '/proc/<pid>/stat' into the CPU time, page fault and resident set size fields
+    /// @param[in] content null-terminated content of the file
+    /// @param[in] clockTicksPerSecond to convert the CPU time to nanoseconds
+    /// @param[in] pageSize to convert the resident set size to bytes
+    /// @param[out] statistics which are updated
+    /// @return true if all fields could be parsed, false otherwise
+    static bool parseStat(const char* content,
+                          const uint64_t clockTicksPerSecond,
+                          const uint64_t pageSize,
+                          ProcessStatistics& statistics) noexcept;
+
+    /// @brief Parses the content of '/proc/<pid>/status' into the context switch fields
+    /// @param[in] content null-terminated content of the file
+    /// @param[out] statistics which are updated
+    /// @return true if all fields could be parsed, false otherwise
+    static bool parseStatus(const char* content, ProcessStatistics& statistics) noexcept;
+
+  private:
+    uint64_t m_clockTicksPerSecond{0U};
+    uint64_t m_pageSize{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_PROCESS_STATISTICS_HPP
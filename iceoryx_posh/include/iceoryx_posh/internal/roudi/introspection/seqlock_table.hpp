@@ -0,0 +1,110 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Fixed-capacity table with a sequence counter per slot. The slots are written by one thread at a time and
+/// read without a lock; a reader which overlaps with a write to the same slot retries, hence the readers never block
+/// the writer. The entries are only replaced as a whole, i.e. a slot is either free or contains an entry which does
+/// not change until it is erased. The entries are stored in atomic words and copied word by word, therefore they must
+/// be trivially copyable; data which is referenced by an entry, e.g. the port data, is kept alive by a grace period,
+/// i.e. 'erase' waits until a reader which may still use the erased entry is finished.
+/// @note The writers must be serialized by the user and there must be only one reader thread at a time; the writer
+/// methods must not be called from the readers
+template <typename T, uint64_t Capacity>
+class SeqLockTable
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The entries are copied word by word");
+
+  public:
+    static constexpr uint64_t CAPACITY{Capacity};
+
+    SeqLockTable() noexcept = default;
+
+    SeqLockTable(const SeqLockTable&) = delete;
+    SeqLockTable(SeqLockTable&&) = delete;
+    SeqLockTable& operator=(const SeqLockTable&) = delete;
+    SeqLockTable& operator=(SeqLockTable&&) = delete;
+
+    /// @brief Adds an entry in the first free slot; only for the writer
+    /// @param[in] entry to add
+    /// @return the index of the slot or nullopt if the table is full
+    optional<uint64_t> insert(const T& entry) noexcept;
+
+    /// @brief Frees a slot and waits until the reader does not use the entry anymore; only for the writer
+    /// @param[in] index of the slot, must be in use
+    void erase(const uint64_t index) noexcept;
+
+    /// @brief Checks whether a slot contains an entry; only for the writer
+    /// @param[in] index of the slot
+    /// @return true if the slot is in use, false otherwise
+    bool isUsed(const uint64_t index) const noexcept;
+
+    /// @brief Copy of the entry of a slot; only for the writer
+    /// @param[in] index of the slot, must be in use
+    /// @return the entry
+    T entry(const uint64_t index) const noexcept;
+
+    /// @brief Reads the entry of a slot consistently; can be called concurrently to the writer
+    /// @param[in] index of the slot
+    /// @param[in] reader is called with a validated copy of the entry if the slot is in use. Data which is referenced
+    /// by the entry and freed only after the entry was erased can be accessed safely in the reader
+    /// @return true if the slot is in use, false otherwise
+    template <typename Reader>
+    bool read(const uint64_t index, Reader&& reader) const noexcept;
+
+  private:
+    static constexpr uint64_t NUMBER_OF_WORDS{(sizeof(T) + sizeof(uint64_t) - 1U) / sizeof(uint64_t)};
+
+    struct Slot
+    {
+        /// @brief odd while the slot is written
+        concurrent::Atomic<uint64_t> sequence{0U};
+        concurrent::Atomic<bool> isUsed{false};
+        // NOLINTJUSTIFICATION the entry is stored in atomic words which are only indexed up to NUMBER_OF_WORDS
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        concurrent::Atomic<uint64_t> words[NUMBER_OF_WORDS];
+    };
+
+    static void store(Slot& slot, const T& entry) noexcept;
+    static T load(const Slot& slot) noexcept;
+
+    template <typename Writer>
+    void write(Slot& slot, Writer&& writer) noexcept;
+
+    // NOLINTJUSTIFICATION the slots are only indexed up to Capacity
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Slot m_slots[Capacity];
+    /// @brief odd while the reader is in 'read'; the writer waits for it to change after an entry was erased
+    mutable concurrent::Atomic<uint64_t> m_readSection{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/introspection/seqlock_table.inl"
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_HPP
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_INL
+#define IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_INL
+
+#include "iceoryx_posh/internal/roudi/introspection/seqlock_table.hpp"
+#include "iox/assertions.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+constexpr uint64_t SeqLockTable<T, Capacity>::CAPACITY;
+
+template <typename T, uint64_t Capacity>
+inline optional<uint64_t> SeqLockTable<T, Capacity>::insert(const T& entry) noexcept
+{
+    for (uint64_t index = 0U; index < Capacity; ++index)
+    {
+        auto& slot = m_slots[index];
+        if (!slot.isUsed.load(std::memory_order_relaxed))
+        {
+            write(slot, [&] {
+                store(slot, entry);
+                slot.isUsed.store(true, std::memory_order_relaxed);
+            });
+            return index;
+        }
+    }
+    return nullopt;
+}
+
+template <typename T, uint64_t Capacity>
+inline void SeqLockTable<T, Capacity>::erase(const uint64_t index) noexcept
+{
+    IOX_ENFORCE(isUsed(index), "Only used slots can be erased");
+    auto& slot = m_slots[index];
+    write(slot, [&] { slot.isUsed.store(false, std::memory_order_relaxed); });
+
+    // grace period: a reader which entered 'read' before the slot was freed may still use the entry; the fences order
+    // the free slot before the check of the reader and the entry of the reader before its read of the slot
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto readSection = m_readSection.load(std::memory_order_relaxed);
+    if ((readSection % 2U) != 0U)
+    {
+        while (m_readSection.load(std::memory_order_acquire) == readSection)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline bool SeqLockTable<T, Capacity>::isUsed(const uint64_t index) const noexcept
+{
+    IOX_ENFORCE(index < Capacity, "Index out of bounds");
+    return m_slots[index].isUsed.load(std::memory_order_relaxed);
+}
+
+template <typename T, uint64_t Capacity>
+inline T SeqLockTable<T, Capacity>::entry(const uint64_t index) const noexcept
+{
+    IOX_ENFORCE(isUsed(index), "Only used slots have an entry");
+    return load(m_slots[index]);
+}
+
+template <typename T, uint64_t Capacity>
+inline void SeqLockTable<T, Capacity>::store(Slot& slot, const T& entry) noexcept
+{
+    // NOLINTJUSTIFICATION the buffer of the words is only indexed up to NUMBER_OF_WORDS
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint64_t words[NUMBER_OF_WORDS]{};
+    std::memcpy(&words[0], &entry, sizeof(T));
+    for (uint64_t i = 0U; i < NUMBER_OF_WORDS; ++i)
+    {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline T SeqLockTable<T, Capacity>::load(const Slot& slot) noexcept
+{
+    // NOLINTJUSTIFICATION the buffer of the words is only indexed up to NUMBER_OF_WORDS
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint64_t words[NUMBER_OF_WORDS]{};
+    for (uint64_t i = 0U; i < NUMBER_OF_WORDS; ++i)
+    {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    // T is trivially copyable but may have default member initializers
+    T entry;
+    std::memcpy(static_cast<void*>(&entry), &words[0], sizeof(T));
+    return entry;
+}
+
+template <typename T, uint64_t Capacity>
+template <typename Writer>
+inline void SeqLockTable<T, Capacity>::write(Slot& slot, Writer&& writer) noexcept
+{
+    // there is only one writer at a time, hence the sequence can be incremented without a read-modify-write
+    const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1U, std::memory_order_relaxed);
+    // the odd sequence must be visible before any of the writes to the slot
+    std::atomic_thread_fence(std::memory_order_release);
+
+    writer();
+
+    slot.sequence.store(sequence + 2U, std::memory_order_release);
+}
+
+template <typename T, uint64_t Capacity>
+template <typename Reader>
+inline bool SeqLockTable<T, Capacity>::read(const uint64_t index, Reader&& reader) const noexcept
+{
+    IOX_ENFORCE(index < Capacity, "Index out of bounds");
+    const auto& slot = m_slots[index];
+
+    // there is only one reader, the section becomes odd
+    m_readSection.store(m_readSection.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool isUsed{false};
+    T entry;
+    while (true)
+    {
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((sequence % 2U) != 0U)
+        {
+            // the writer is in the middle of an update of this slot
+            std::this_thread::yield();
+            continue;
+        }
+
+        isUsed = slot.isUsed.load(std::memory_order_relaxed);
+        if (isUsed)
+        {
+            entry = load(slot);
+        }
+
+        // the reads of the slot must be done before the sequence is checked again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            break;
+        }
+    }
+
+    // only the validated copy is handed to the reader; the data it references is not freed before the section ends
+    if (isUsed)
+    {
+        reader(static_cast<const T&>(entry));
+    }
+
+    m_readSection.store(m_readSection.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    return isUsed;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_SEQLOCK_TABLE_INL
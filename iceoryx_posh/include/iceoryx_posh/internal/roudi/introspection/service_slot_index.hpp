@@ -0,0 +1,70 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/function_ref.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Hash index from a service description to the slots of a table with the given capacity. The slots of a
+/// bucket are chained in insertion order; since a slot can only be in one bucket, the index cannot run out of nodes.
+/// @note The index is not thread-safe, it is meant for the writers of a SeqLockTable
+template <uint64_t Capacity>
+class ServiceSlotIndex
+{
+  public:
+    ServiceSlotIndex() noexcept;
+
+    /// @brief Adds a slot to the bucket of the service description
+    /// @param[in] slot to add, must not be in the index
+    /// @param[in] serviceDescription of the entry in the slot
+    void insert(const uint64_t slot, const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Removes a slot from the bucket of the service description
+    /// @param[in] slot to remove
+    /// @param[in] serviceDescription with which the slot was inserted
+    void remove(const uint64_t slot, const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Applies a callable to all slots in the bucket of the service description in insertion order; the
+    /// entries in the slots can have a different service description with a colliding hash
+    void forEachInBucket(const capro::ServiceDescription& serviceDescription,
+                         const function_ref<void(const uint64_t)> callable) const noexcept;
+
+  private:
+    static constexpr uint32_t NUMBER_OF_BUCKETS{internal::nextPowerOfTwo(static_cast<uint32_t>(Capacity))};
+    static constexpr uint64_t NO_SLOT{Capacity};
+
+    static uint32_t bucketOf(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size arrays of slot indices
+    uint64_t m_nextSlots[Capacity];
+    uint64_t m_bucketHeads[NUMBER_OF_BUCKETS];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/introspection/service_slot_index.inl"
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_HPP
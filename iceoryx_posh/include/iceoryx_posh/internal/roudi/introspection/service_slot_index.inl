@@ -0,0 +1,98 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_INL
+#define IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/introspection/service_slot_index.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <uint64_t Capacity>
+inline ServiceSlotIndex<Capacity>::ServiceSlotIndex() noexcept
+{
+    for (auto& nextSlot : m_nextSlots)
+    {
+        nextSlot = NO_SLOT;
+    }
+    for (auto& head : m_bucketHeads)
+    {
+        head = NO_SLOT;
+    }
+}
+
+template <uint64_t Capacity>
+inline void ServiceSlotIndex<Capacity>::insert(const uint64_t slot,
+                                               const capro::ServiceDescription& serviceDescription) noexcept
+{
+    IOX_ENFORCE(slot < Capacity, "Slot out of bounds");
+
+    m_nextSlots[slot] = NO_SLOT;
+    auto* link = &m_bucketHeads[bucketOf(serviceDescription)];
+    while (*link != NO_SLOT)
+    {
+        link = &m_nextSlots[*link];
+    }
+    *link = slot;
+}
+
+template <uint64_t Capacity>
+inline void ServiceSlotIndex<Capacity>::remove(const uint64_t slot,
+                                               const capro::ServiceDescription& serviceDescription) noexcept
+{
+    auto* link = &m_bucketHeads[bucketOf(serviceDescription)];
+    while (*link != NO_SLOT)
+    {
+        if (*link == slot)
+        {
+            *link = m_nextSlots[slot];
+            m_nextSlots[slot] = NO_SLOT;
+            return;
+        }
+        link = &m_nextSlots[*link];
+    }
+}
+
+template <uint64_t Capacity>
+inline void
+ServiceSlotIndex<Capacity>::forEachInBucket(const capro::ServiceDescription& serviceDescription,
+                                            const function_ref<void(const uint64_t)> callable) const noexcept
+{
+    // the next slot is read before the callable is applied, hence the callable is allowed to remove the current slot
+    auto slot = m_bucketHeads[bucketOf(serviceDescription)];
+    while (slot != NO_SLOT)
+    {
+        const auto nextSlot = m_nextSlots[slot];
+        callable(slot);
+        slot = nextSlot;
+    }
+}
+
+template <uint64_t Capacity>
+inline uint32_t ServiceSlotIndex<Capacity>::bucketOf(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return internal::hashOf(serviceDescription.getServiceIDString(),
+                            serviceDescription.getInstanceIDString(),
+                            serviceDescription.getEventIDString())
+           & (NUMBER_OF_BUCKETS - 1U);
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_SERVICE_SLOT_INDEX_INL
@@ -38,6 +38,7 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/posix_shared_memory_object.hpp"
 #include "iox/type_traits.hpp"
@@ -61,8 +62,25 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Sets the interval in which the port introspection is published
+    /// @param[in] interval between two samples of the port introspection topics; 0 disables the periodic publishing
+    void setPortIntrospectionInterval(const units::Duration interval) noexcept;
+
     void doDiscovery() noexcept;
 
+    /// @brief Processes only the ports which changed since the last run, i.e. the entries of the DiscoveryQueue of the
+    /// port pool; the whole port pool is processed like with 'doDiscovery' if the queue was full or a full discovery
+    /// was requested
+    void doDiscoveryForChangedPorts() noexcept;
+
+    /// @brief The queue the ports use to inform RouDi about changes
+    /// @return a reference to the DiscoveryQueue of the port pool
+    popo::DiscoveryQueue& discoveryQueue() noexcept;
+
+    /// @brief Stops the notifications of the ports via the DiscoveryQueue; called by RouDi once the discovery loop
+    /// is stopped and before the ports are destroyed
+    void detachDiscoveryQueue() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -133,16 +151,22 @@ class PortManager
 
     void handlePublisherPorts() noexcept;
 
+    void handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
     void handleSubscriberPorts() noexcept;
 
+    void handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
     void handleClientPorts() noexcept;
 
+    void handleClientPort(popo::ClientPortData& clientPortData) noexcept;
+
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
 
     void makeAllServerPortsToStopOffer() noexcept;
@@ -151,12 +175,16 @@ class PortManager
 
     void handleServerPorts() noexcept;
 
+    void handleServerPort(popo::ServerPortData& serverPortData) noexcept;
+
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
     void handleInterfaces() noexcept;
 
     void handleConditionVariables() noexcept;
 
+    void handleConditionVariable(popo::ConditionVariableData* const conditionVariableData) noexcept;
+
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
@@ -166,6 +194,19 @@ class PortManager
     void sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                           PublisherPortRouDiType& publisherSource) noexcept;
 
+    /// @brief Starts the latency measurement of a connection which was acknowledged by a publisher with
+    /// 'PublisherOptions::measureLatency'; the histogram is taken from the port pool
+    /// @param[in] publisher which acknowledged the subscription
+    /// @param[in] subscription is the SUB message of the subscriber
+    /// @param[in] subscriberId is the unique port id of the subscriber
+    void connectLatencyHistogram(const PublisherPortRouDiType& publisher,
+                                 const capro::CaproMessage& subscription,
+                                 const popo::UniquePortId& subscriberId) noexcept;
+
+    /// @brief Stops the latency measurement of all connections to a publisher which is destroyed
+    /// @param[in] publisher which is destroyed
+    void disconnectLatencyHistograms(const PublisherPortRouDiType& publisher) noexcept;
+
     bool isCompatibleClientServer(const popo::ServerPortRouDi& server,
                                   const popo::ClientPortRouDi& client) const noexcept;
 
@@ -195,8 +236,39 @@ class PortManager
     const ServiceRegistry& serviceRegistry() const noexcept;
 
   private:
+    /// @brief Chains the subscriber ports with the same service description hash in singly linked lists in insertion
+    /// order. This avoids scanning all subscriber ports whenever a publisher offers or stops offering its service.
+    class SubscriberPortIndex
+    {
+      public:
+        SubscriberPortIndex() noexcept;
+
+        void insert(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+        void remove(const SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
+        /// @brief Applies a callable to all subscriber ports in the bucket of the service description; the ports can
+        /// have a different service description with a colliding hash
+        void forEachInBucket(const capro::ServiceDescription& serviceDescription,
+                             function_ref<void(SubscriberPortType::MemberType_t&)> callable) const noexcept;
+
+      private:
+        static constexpr uint32_t CAPACITY{MAX_SUBSCRIBERS};
+        static constexpr uint32_t NUMBER_OF_BUCKETS{internal::nextPowerOfTwo(CAPACITY)};
+        static constexpr uint32_t NO_NODE{CAPACITY};
+
+        static uint32_t bucketOf(const capro::ServiceDescription& serviceDescription) noexcept;
+
+        // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size arrays of node indices
+        SubscriberPortType::MemberType_t* m_subscriberPorts[CAPACITY];
+        uint32_t m_nextNodes[CAPACITY];
+        uint32_t m_bucketHeads[NUMBER_OF_BUCKETS];
+        // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        uint32_t m_freeNodes{0U};
+    };
+
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
+    SubscriberPortIndex m_subscriberPortIndex;
     ServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_queue.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
@@ -39,6 +41,9 @@ struct PortPoolData
     {
     }
 
+    /// @brief the data of the port pool whose state changed since the last discovery run
+    popo::DiscoveryQueue m_discoveryQueue;
+
     using InterfaceContainer = FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER>;
     InterfaceContainer m_interfacePortMembers;
 
@@ -57,6 +62,11 @@ struct PortPoolData
     using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
     ClientContainer m_clientPortMembers;
 
+    /// @brief the histograms for the connections to publishers which measure the latency; they are assigned to the
+    /// receivers only when such a connection is established
+    using LatencyHistogramContainer = FixedPositionContainer<popo::LatencyHistogram, MAX_LATENCY_HISTOGRAMS>;
+    LatencyHistogramContainer m_latencyHistograms;
+
     const roudi::UniqueRouDiId m_uniqueRouDiId;
 };
 
@@ -22,7 +22,6 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
@@ -54,7 +53,8 @@ class RouDi
 
     virtual ~RouDi() noexcept;
 
-    /// @brief Triggers the discovery loop to run immediately instead of waiting for the next tick interval
+    /// @brief Triggers the discovery loop to run immediately and to process all ports instead of only the ports which
+    /// signaled a change
     /// @param[in] timeout is the time to wait to unblock the function call in case the discovery loop never signals to
     /// have finished the run
     void triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcept;
@@ -101,6 +101,8 @@ class RouDi
   private:
     void processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept;
 
+    void triggerDiscoveryLoop() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
@@ -108,7 +110,6 @@ class RouDi
     concurrent::Atomic<bool> m_runMonitoringAndDiscoveryThread;
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
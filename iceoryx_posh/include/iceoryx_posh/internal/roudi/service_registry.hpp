@@ -32,6 +32,32 @@ namespace iox
 {
 namespace roudi
 {
+namespace internal
+{
+/// @brief Calculates the smallest power of two which is not less than the given number
+constexpr uint32_t nextPowerOfTwo(const uint32_t number) noexcept
+{
+    uint32_t powerOfTwo{1U};
+    while (powerOfTwo < number)
+    {
+        powerOfTwo *= 2U;
+    }
+    return powerOfTwo;
+}
+
+/// @brief FNV-1a hash of a string
+uint32_t hashOf(const capro::IdString_t& id) noexcept;
+
+/// @brief Combines the hashes of the service, instance and event string of a service description
+uint32_t hashOf(const capro::IdString_t& service,
+                const capro::IdString_t& instance,
+                const capro::IdString_t& event) noexcept;
+} // namespace internal
+
+/// @brief Reference counted set of the service descriptions of all publishers and servers. To avoid a linear search
+/// on every lookup, the entries are additionally stored in hash indices which are keyed by the whole service
+/// description as well as by the service, instance and event string for searches with wildcards. The indices only
+/// refer to the slots of the entries, hence the registry can be copied into shared memory like before.
 class ServiceRegistry
 {
   public:
@@ -56,6 +82,8 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    ServiceRegistry() noexcept;
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -81,7 +109,8 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void purge(const capro::ServiceDescription& serviceDescription) noexcept;
 
-    /// @brief Searches for given service description in registry
+    /// @brief Searches for given service description in registry; the matching entries are looked up in the index
+    ///        of the first given string, only a search with three wildcards visits all entries
     /// @param[in] service, string or wildcard (= iox::nullopt) to search for
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
@@ -106,8 +135,36 @@ class ServiceRegistry
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief The keys of the hash indices
+    enum class IndexKey : uint32_t
+    {
+        SERVICE_DESCRIPTION = 0U,
+        SERVICE,
+        INSTANCE,
+        EVENT,
+    };
+    static constexpr uint32_t NUMBER_OF_INDEX_KEYS{4U};
+
+    /// @brief The number of buckets is a power of two to map a hash to a bucket with a mask
+    static constexpr uint32_t NUMBER_OF_BUCKETS{internal::nextPowerOfTwo(CAPACITY)};
+
+    /// @brief Chains the slots of m_serviceDescriptions with the same bucket in a circular doubly linked list in
+    ///        insertion order, i.e. the previous slot of the first slot in a chain is the last slot
+    struct HashIndex
+    {
+        // NOLINTJUSTIFICATION fixed size arrays of indices which are copied with the registry into shared memory
+        // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        uint32_t bucketHeads[NUMBER_OF_BUCKETS];
+        uint32_t nextSlots[CAPACITY];
+        uint32_t previousSlots[CAPACITY];
+        // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    HashIndex m_indices[NUMBER_OF_INDEX_KEYS];
+
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
@@ -118,6 +175,22 @@ class ServiceRegistry
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    static uint32_t hashOf(const IndexKey key, const capro::ServiceDescription& serviceDescription) noexcept;
+    static uint32_t bucketOf(const uint32_t hash) noexcept;
+
+    /// @brief Applies a callable to all entries in the bucket of the hash in the given index; the entries can have a
+    ///        different key since the hashes of different keys can collide
+    void forEachInBucket(const IndexKey key,
+                         const uint32_t hash,
+                         function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
+
+    void emplaceEntry(const uint32_t slot,
+                      const capro::ServiceDescription& serviceDescription,
+                      ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept;
+    void resetEntry(const uint32_t slot) noexcept;
+
+    void insertIntoIndices(const uint32_t slot) noexcept;
+    void removeFromIndices(const uint32_t slot) noexcept;
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
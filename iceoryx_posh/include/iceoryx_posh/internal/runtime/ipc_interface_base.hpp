@@ -128,6 +128,12 @@ enum class IpcMessageErrorType : int32_t
 /// @param[in] str string to convert
 IpcMessageType stringToIpcMessageType(const char* str) noexcept;
 
+/// @brief Reads the message type from an entry of a message without a heap allocation
+/// @param[in] message which contains the message type
+/// @param[in] index of the entry with the message type
+/// @return the message type or IpcMessageType::NOTYPE if the entry is not a valid message type
+IpcMessageType ipcMessageTypeAtIndex(const IpcMessage& message, const uint32_t index) noexcept;
+
 /// @brief Converts a message type enumeration value into a string
 /// @param[in] msg enum value to convert
 std::string IpcMessageTypeToString(const IpcMessageType msg) noexcept;
@@ -274,6 +280,9 @@ class IpcInterface
     bool hasClosableIpcChannel() const noexcept;
 
   protected:
+    /// @brief fixed capacity buffer which receives a message without allocating on the heap
+    using ReceiveBuffer_t = string<IpcChannelType::MAX_MESSAGE_SIZE>;
+
     InterfaceName_t m_interfaceName;
     RuntimeName_t m_runtimeName;
     uint64_t m_maxMessageSize{0U};
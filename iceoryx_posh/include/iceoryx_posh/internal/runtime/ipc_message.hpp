@@ -17,7 +17,11 @@
 #ifndef IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 #define IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
+#include "iox/optional.hpp"
+#include "iox/string.hpp"
 
 #include <cstdint>
 #include <sstream>
@@ -39,9 +43,17 @@ namespace runtime
 ///    separator. A message is defined as valid if all entries contained in
 ///    that message are valid and it ends with the separator or it is empty,
 ///    otherwise it is defined as invalid.
+///
+///    The message is stored in a fixed size buffer of MAX_MESSAGE_SIZE characters
+///    which is sent and received without heap allocations. An entry which does not
+///    fit into the remaining buffer invalidates the message.
 class IpcMessage
 {
   public:
+    /// @brief the largest message which is exchanged between RouDi and the runtimes
+    static constexpr uint64_t MAX_MESSAGE_SIZE = algorithm::maxVal(ROUDI_MESSAGE_SIZE, APP_MESSAGE_SIZE);
+    using MessageBuffer_t = string<MAX_MESSAGE_SIZE>;
+
     /// @brief Creates an empty and valid IPC channel message.
     IpcMessage() noexcept = default;
 
@@ -77,6 +89,21 @@ class IpcMessage
     //          If the message is invalid the return value is undefined.
     std::string getElementAtIndex(const uint32_t index) const noexcept;
 
+    /// @brief Converts the entry at position index to an integer without copying it into a std::string
+    /// @tparam T integer type of the entry
+    /// @param[in] index desired entry position
+    /// @return the integer or nullopt if the entry does not exist or is not a number which fits into T
+    template <typename T>
+    optional<T> getIntegerAtIndex(const uint32_t index) const noexcept;
+
+    /// @brief Copies the entry at position index into a fixed-size string without a heap allocation; an entry
+    ///         which exceeds the capacity is truncated
+    /// @tparam Capacity of the string
+    /// @param[in] index desired entry position
+    /// @return If the element exists it returns the element at index otherwise an empty string
+    template <uint64_t Capacity>
+    string<Capacity> getStringAtIndex(const uint32_t index) const noexcept;
+
     /// @brief returns if an entry is valid.
     ///      Non valid entries are containing at least one separator
     /// @param[in] entry sstring to check
@@ -94,6 +121,11 @@ class IpcMessage
     /// @return the current message as separator separated string
     std::string getMessage() const noexcept;
 
+    /// @brief Provides the separator separated string without a copy
+    ///        If the message is invalid the return value is undefined.
+    /// @return the buffer which contains the current message
+    const MessageBuffer_t& getMessageBuffer() const noexcept;
+
     /// @brief Takes a separator separated string and interprets it as
     ///      a IpcMessage. In this case the IpcMessage can only become
     ///      invalid if it is not empty and does not end with the separator.
@@ -102,6 +134,11 @@ class IpcMessage
     /// @param[in] separator separated string for the message
     void setMessage(const std::string& msg) noexcept;
 
+    /// @brief Takes a null-terminated separator separated string and interprets it as
+    ///      a IpcMessage, see setMessage(const std::string&)
+    /// @param[in] msg null-terminated separator separated string for the message
+    void setMessage(const char* const msg) noexcept;
+
     /// @brief Clears the message. After a call to clearMessage() the
     //      message becomes valid again.
     void clearMessage() noexcept;
@@ -119,8 +156,17 @@ class IpcMessage
     bool operator==(const IpcMessage& rhs) const noexcept;
 
   private:
+    /// @brief Finds the entry at position index within the message buffer
+    /// @param[in] index desired entry position
+    /// @param[out] element is set to the beginning of the entry which is not null-terminated
+    /// @param[out] size is set to the size of the entry
+    /// @return true if the entry exists, false otherwise
+    bool findElement(const uint32_t index, const char*& element, uint64_t& size) const noexcept;
+    void setMessage(const char* const msg, const uint64_t size) noexcept;
+    void appendEntry(const char* const entry, const uint64_t size) noexcept;
+
     static const char m_separator; // default value is ,
-    std::string m_msg;
+    MessageBuffer_t m_msg;
     bool m_isValid{true};
     uint32_t m_numberOfElements{0};
 };
@@ -19,6 +19,11 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
 namespace iox
 {
 namespace runtime
@@ -26,18 +31,30 @@ namespace runtime
 template <typename T>
 void IpcMessage::addEntry(const T& entry) noexcept
 {
-    std::stringstream newEntry;
-    newEntry << entry;
-
-    if (!isValidEntry(newEntry.str()))
+    // single byte integers are streamed as characters and are therefore not formatted as numbers
+    if constexpr (std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) > 1U)
+    {
+        // sign and one more digit than 'digits10' which only counts the digits that can be fully represented
+        constexpr uint64_t MAX_NUMBER_OF_CHARACTERS{std::numeric_limits<T>::digits10 + 2U};
+        char number[MAX_NUMBER_OF_CHARACTERS];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) end of the array
+        const auto result = std::to_chars(&number[0], &number[0] + MAX_NUMBER_OF_CHARACTERS, entry);
+        appendEntry(&number[0], static_cast<uint64_t>(result.ptr - &number[0]));
+    }
+    else if constexpr (std::is_same<T, std::string>::value || is_iox_string<T>::value)
+    {
+        appendEntry(entry.c_str(), entry.size());
+    }
+    else if constexpr (std::is_convertible<const T&, const char*>::value)
     {
-        IOX_LOG(Error, "\'" << newEntry.str().c_str() << "\' is an invalid IPC channel entry");
-        m_isValid = false;
+        appendEntry(entry, strlen(entry));
     }
     else
     {
-        m_msg.append(newEntry.str() + m_separator);
-        ++m_numberOfElements;
+        std::stringstream newEntry;
+        newEntry << entry;
+        const auto newEntryString = newEntry.str();
+        appendEntry(newEntryString.c_str(), newEntryString.size());
     }
 }
 
@@ -48,6 +65,41 @@ IpcMessage& IpcMessage::operator<<(const T& entry) noexcept
     return *this;
 }
 
+template <typename T>
+optional<T> IpcMessage::getIntegerAtIndex(const uint32_t index) const noexcept
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "Only integers are supported");
+
+    const char* element{nullptr};
+    uint64_t size{0U};
+    if (!findElement(index, element, size))
+    {
+        return nullopt;
+    }
+
+    T value{0};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) end of the entry within the message buffer
+    const auto* const elementEnd = element + size;
+    const auto result = std::from_chars(element, elementEnd, value);
+    if (result.ec != std::errc() || result.ptr != elementEnd)
+    {
+        return nullopt;
+    }
+    return value;
+}
+
+template <uint64_t Capacity>
+string<Capacity> IpcMessage::getStringAtIndex(const uint32_t index) const noexcept
+{
+    const char* element{nullptr};
+    uint64_t size{0U};
+    if (!findElement(index, element, size))
+    {
+        return string<Capacity>();
+    }
+    return string<Capacity>(TruncateToCapacity, element, size);
+}
+
 } // namespace runtime
 } // namespace iox
 
@@ -29,6 +29,15 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines from which mempools a chunk is acquired
+enum class AllocationPolicy : uint8_t
+{
+    /// @brief only the smallest mempool which fits the requested chunk size is used
+    BEST_FIT,
+    /// @brief if the best fitting mempool has no free chunks left, the next larger mempools are used
+    SPILL_OVER_TO_LARGER_MEMPOOLS
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +55,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    AllocationPolicy m_allocationPolicy{AllocationPolicy::BEST_FIT};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -58,6 +68,10 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry entry) noexcept;
 
+    /// @brief Sets the policy which is used to select the mempool a chunk is acquired from
+    /// @param[in] allocationPolicy to use
+    MePooConfig& setAllocationPolicy(const AllocationPolicy allocationPolicy) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/vector.hpp"
 
@@ -27,6 +28,21 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief Defines how the shared memory of a segment is mapped into RouDi
+struct SegmentMemoryOptions
+{
+    /// @brief advise the operating system to back the segment with huge pages
+    bool useHugePages{false};
+    /// @brief lock the segment into RAM so that it is never paged out
+    bool lockMemory{false};
+    /// @brief fault in all pages of the segment on creation instead of on first access
+    bool prefaultMemory{false};
+    /// @brief number of threads which zero or prefault the segment on creation; 0 uses one thread per CPU core
+    uint32_t initializationThreads{1U};
+    /// @brief bind the segment to this NUMA node; a writer group can have one segment per NUMA node
+    optional<uint32_t> numaNode;
+};
+
 struct SegmentConfig
 {
     struct SegmentEntry
@@ -34,11 +50,13 @@ struct SegmentConfig
         SegmentEntry(const PosixGroup::groupName_t& readerGroup,
                      const PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const SegmentMemoryOptions& memoryOptions = SegmentMemoryOptions()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_memoryOptions(memoryOptions)
 
         {
         }
@@ -47,6 +65,7 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        SegmentMemoryOptions m_memoryOptions;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
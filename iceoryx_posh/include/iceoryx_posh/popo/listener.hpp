@@ -19,15 +19,19 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
 #include "iox/smart_lock.hpp"
+#include "iox/unnamed_semaphore.hpp"
+#include "iox/vector.hpp"
 
 #include <thread>
 
@@ -80,8 +84,12 @@ enum class ListenerError
 
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
-///        an encapsulated thread inside this class.
+///        an encapsulated thread inside this class. Optionally, the callbacks are dispatched to a pool of
+///        worker threads, see ListenerOptions.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
+/// @attention With more than one worker thread, the callbacks of different events are executed concurrently and
+///            must not rely on being serialized with each other. The callbacks of the same event are still never
+///            executed concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
 ///            another thread.
@@ -103,6 +111,10 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener which is configured with the provided options
+    /// @param[in] options the spin duration, the number of worker threads and their CPU affinity
+    explicit Listener(const ListenerOptions& options) noexcept;
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -168,12 +180,17 @@ class Listener
     uint64_t size() const noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options = {}) noexcept;
 
   private:
     class Event_t;
 
     void threadLoop() noexcept;
+    void workerLoop(const optional<uint32_t> cpuAffinity) noexcept;
+    void startWorkerThreads(const ListenerOptions& options) noexcept;
+    void stopWorkerThreads() noexcept;
+    void dispatchToWorker(const uint32_t index) noexcept;
+    void executeSerialized(const uint32_t index) noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
@@ -210,6 +227,14 @@ class Listener
 
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS];
+
+    vector<std::thread, MAX_NUMBER_OF_WORKERS_PER_LISTENER> m_workerThreads;
+    concurrent::MpmcLockFreeQueue<uint32_t, MAX_NUMBER_OF_EVENTS> m_readyEvents;
+    optional<UnnamedSemaphore> m_readyEventsSemaphore;
+    /// @brief number of dispatches of an event since its callback was last started by a worker; an event is only
+    ///        queued when the counter leaves zero which serializes the callbacks of one event
+    concurrent::Atomic<uint64_t> m_pendingExecutions[MAX_NUMBER_OF_EVENTS];
+    concurrent::Atomic<bool> m_stopWorkers{false};
     std::mutex m_addEventMutex;
 
     concurrent::Atomic<bool> m_wasDtorCalled{false};
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+#define IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/duration.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure the Listener
+struct ListenerOptions
+{
+    /// @brief How long the Listener thread busy polls for events before it is put to sleep; while polling, the
+    ///        notifying side does not wake up the thread with a system call
+    units::Duration spinDuration{units::Duration::zero()};
+
+    /// @brief The number of worker threads which execute the callbacks. With zero worker threads the callbacks are
+    ///        executed by the Listener thread itself. The value is limited to MAX_NUMBER_OF_WORKERS_PER_LISTENER.
+    /// @note  The callbacks of one event are never executed concurrently but the callbacks of different events are
+    ///        executed concurrently when there is more than one worker thread
+    uint64_t numberOfWorkerThreads{0U};
+
+    /// @brief The CPU core the worker thread with the corresponding index is pinned to. Worker threads without an
+    ///        entry are not pinned.
+    /// @note  The CPU affinity is ignored with a warning on platforms which do not support it
+    vector<uint32_t, MAX_NUMBER_OF_WORKERS_PER_LISTENER> workerCpuAffinity;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LISTENER_OPTIONS_HPP
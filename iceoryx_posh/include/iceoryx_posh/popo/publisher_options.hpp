@@ -24,6 +24,7 @@
 #include "iox/detail/serialization.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -45,6 +46,23 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of chunks which are acquired at once from a mempool and cached by the publisher; this reduces
+    /// the contention on the mempools when many publishers loan chunks concurrently but the cached chunks are not
+    /// available for other publishers; 0 disables the cache and values larger than
+    /// mepoo::ChunkCache::MAX_CHUNKS_PER_MEMPOOL are clamped
+    uint32_t chunkCacheSize{0U};
+
+    /// @brief Value of 'numaNode' to use any writable segment
+    static constexpr uint32_t ANY_NUMA_NODE{std::numeric_limits<uint32_t>::max()};
+
+    /// @brief The NUMA node the chunks of the publisher should be located on; when the writer group of the
+    /// application has a segment on this node it is used for the publisher, otherwise the default segment is used
+    uint32_t numaNode{ANY_NUMA_NODE};
+
+    /// @brief The option whether the chunks should be stamped with the send time; the subscribers then record the
+    /// latency until the chunks are taken in a histogram which is published by the port introspection
+    bool measureLatency{false};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
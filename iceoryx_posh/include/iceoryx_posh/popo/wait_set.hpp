@@ -66,6 +66,11 @@ class WaitSet
     using NotificationInfoVector = vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief Creates a WaitSet which polls for triggers before it sleeps
+    /// @param[in] spinDuration how long wait() and timedWait() busy poll for triggers before the thread is put to
+    /// sleep; while polling, the notifying side does not wake up the WaitSet with a system call
+    explicit WaitSet(const units::Duration spinDuration) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -214,7 +219,8 @@ class WaitSet
 
   protected:
     friend class iox::posh::experimental::WaitSetBuilder;
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData,
+                     const units::Duration spinDuration = units::Duration::zero()) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
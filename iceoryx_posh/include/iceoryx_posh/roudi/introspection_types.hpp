@@ -21,6 +21,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/vector.hpp"
 
+#include <limits>
+
 namespace iox
 {
 namespace roudi
@@ -41,6 +43,7 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    uint64_t m_spillAllocations{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -50,9 +53,16 @@ using MemPoolInfoContainer = vector<MemPoolInfo, MAX_NUMBER_OF_MEMPOOLS>;
 struct MemPoolIntrospectionInfo
 {
     using GroupName_t = string<MAX_GROUP_NAME_LENGTH>;
+    static constexpr uint32_t NO_NUMA_NODE{std::numeric_limits<uint32_t>::max()};
+
     uint32_t m_id;
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
+    /// @brief size of the pages the segment is mapped with, differs from the regular page size when huge pages are
+    /// used
+    uint64_t m_pageSize{0U};
+    /// @brief the NUMA node the memory of the segment is bound to or NO_NUMA_NODE if it is not bound
+    uint32_t m_numaNode{NO_NUMA_NODE};
     MemPoolInfoContainer m_mempoolInfo;
 };
 
@@ -91,20 +101,69 @@ struct PortIntrospectionFieldTopic
 const capro::ServiceDescription
     IntrospectionPortThroughputService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortThroughput");
 
+/// @brief container for the throughput of a publisher port; the rates refer to the time since the previous sample
+/// of the PortThroughputIntrospectionFieldTopic which contained the port
 struct PortThroughputData
 {
     uint64_t m_publisherPortID{0};
+    /// @brief average user-payload size of all samples sent so far
     uint64_t m_sampleSize{0};
+    /// @brief chunk size of the last sent sample
     uint64_t m_chunkSize{0};
     double m_chunksPerMinute{0};
+    /// @brief average time between two samples which were sent within the last interval; 0 if nothing was sent
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    uint64_t m_numberOfSentSamples{0};
+    uint64_t m_numberOfSentBytes{0};
+    uint64_t m_numberOfLoanFailures{0};
+    double m_sentBytesPerSecond{0};
+};
+
+/// @brief container for the throughput of a subscriber port; the rates refer to the time since the previous sample
+/// of the PortThroughputIntrospectionFieldTopic which contained the port
+struct SubscriberThroughputData
+{
+    uint64_t m_subscriberPortID{0};
+    uint64_t m_numberOfReceivedSamples{0};
+    uint64_t m_numberOfReceivedBytes{0};
+    double m_receivedSamplesPerSecond{0};
+    double m_receivedBytesPerSecond{0};
+    /// @brief samples which were dropped by the publishers because the queue was full (DISCARD_OLDEST_DATA)
+    uint64_t m_numberOfDiscardedSamples{0};
+    /// @brief the maximum number of samples which were in the queue at the same time
+    uint64_t m_queueHighWaterMark{0};
+    uint64_t m_queueCapacity{0};
+};
+
+/// @brief container for the latencies from sending until taking the samples of a connection to a publisher with
+/// 'PublisherOptions::measureLatency'; like the rates, they refer to the time since the previous sample of the
+/// PortThroughputIntrospectionFieldTopic which contained the connection. The history a subscriber receives when it
+/// connects is not measured.
+struct ConnectionLatencyData
+{
+    uint64_t m_subscriberPortID{0};
+    uint64_t m_publisherPortID{0};
+    uint64_t m_numberOfSamples{0};
+    uint64_t m_p50InNanoseconds{0};
+    uint64_t m_p99InNanoseconds{0};
+    uint64_t m_p999InNanoseconds{0};
+    uint64_t m_maxInNanoseconds{0};
 };
 
-/// @brief the topic for the port throughput that a user can subscribe to
+/// @brief the topic for the port throughput that a user can subscribe to; it contains only the ports whose counters
+/// changed since the previous sample, the ports which are left out have the same counters and rates of zero. A
+/// keyframe contains all ports; it is sent every INTROSPECTION_THROUGHPUT_KEYFRAME_INTERVAL samples and as the next
+/// sample after a subscriber connected, hence a late joiner knows all ports once it received a keyframe
 struct PortThroughputIntrospectionFieldTopic
 {
+    bool m_isKeyframe{false};
+    /// @brief the ports are identified by the m_publisherPortID of the PortIntrospectionFieldTopic->m_publisherList
     vector<PortThroughputData, MAX_PUBLISHERS> m_throughputList;
+    /// @brief the ports are identified by the m_subscriberPortID, the unique ID of the subscriber port
+    vector<SubscriberThroughputData, MAX_SUBSCRIBERS> m_subscriberThroughputList;
+    /// @brief only the connections which took samples since the previous sample of this topic
+    vector<ConnectionLatencyData, MAX_LATENCY_HISTOGRAMS> m_connectionLatencyList;
 };
 
 const capro::ServiceDescription
@@ -132,12 +191,43 @@ struct ProcessIntrospectionData
     RuntimeName_t m_name;
 };
 
-/// @brief the topic for the process introspection that a user can subscribe to
+/// @brief the topic for the process introspection that a user can subscribe to; it is only sent when processes are
+/// added or removed
 struct ProcessIntrospectionFieldTopic
 {
     vector<ProcessIntrospectionData, MAX_PROCESS_NUMBER> m_processList;
 };
 
+const capro::ServiceDescription
+    IntrospectionProcessStatisticsService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "ProcessStatistics");
+
+/// @brief the statistics of a process as sampled from the operating system
+struct ProcessStatisticsData
+{
+    /// @brief identifies the process of the ProcessIntrospectionFieldTopic->m_processList
+    int m_pid{0};
+    uint64_t m_userCpuTimeInNanoseconds{0U};
+    uint64_t m_systemCpuTimeInNanoseconds{0U};
+    /// @brief the CPU time between the last two samples relative to the elapsed time; 100 corresponds to one fully
+    /// utilized core
+    double m_cpuUsagePercent{0.0};
+    uint64_t m_residentSetSizeInBytes{0U};
+    uint64_t m_numberOfVoluntaryContextSwitches{0U};
+    uint64_t m_numberOfInvoluntaryContextSwitches{0U};
+    uint64_t m_numberOfMinorPageFaults{0U};
+    uint64_t m_numberOfMajorPageFaults{0U};
+};
+
+/// @brief the topic for the process statistics that a user can subscribe to; it contains only the processes which
+/// were sampled in the interval and whose statistics changed, the other processes keep their previous statistics.
+/// The processes are sampled round-robin, hence a subscriber knows the statistics of all processes after
+/// the number of processes divided by 'RouDiConfig::processStatisticsSamplesPerInterval' intervals. The topic is not
+/// sent if the sampling is disabled or the statistics are not available on the platform
+struct ProcessStatisticsIntrospectionTopic
+{
+    vector<ProcessStatisticsData, MAX_PROCESS_NUMBER> m_processStatisticsList;
+};
+
 } // namespace roudi
 } // namespace iox
 
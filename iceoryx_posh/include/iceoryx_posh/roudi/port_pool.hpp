@@ -52,6 +52,7 @@ enum class PortPoolError : uint8_t
     SERVER_PORT_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    LATENCY_HISTOGRAM_LIST_FULL,
 };
 
 class PortPool
@@ -68,6 +69,15 @@ class PortPool
     PortPoolData::InterfaceContainer& getInterfacePortDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief The queue with the data of the port pool whose state changed since the last discovery run
+    /// @return a reference to the DiscoveryQueue
+    popo::DiscoveryQueue& getDiscoveryQueue() noexcept;
+
+    /// @brief Detaches the DiscoveryNotifier of all data in the port pool from the DiscoveryQueue; this must be done
+    /// before the ports are destroyed since the segment of the queue is not necessarily registered anymore at that
+    /// time
+    void detachDiscoveryNotifiers() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -129,6 +139,15 @@ class PortPool
     expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Acquires a LatencyHistogram from the internal pool for a connection which measures the latency
+    /// @return on success a pointer to an empty LatencyHistogram; on error a PortPoolError
+    expected<popo::LatencyHistogram*, PortPoolError> acquireLatencyHistogram() noexcept;
+
+    /// @brief Returns a LatencyHistogram to the internal pool
+    /// @param[in] latencyHistogram is a pointer to the LatencyHistogram to be returned
+    /// @note after this call the provided LatencyHistogram is no longer available for usage
+    void releaseLatencyHistogram(const popo::LatencyHistogram* const latencyHistogram) noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -159,6 +178,11 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+  private:
+    void initDiscoveryNotifier(popo::DiscoveryNotifier& notifier,
+                               const popo::DiscoveryPortType portType,
+                               const uint64_t index) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
@@ -41,6 +41,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
     {
         return nullptr;
     }
+    initDiscoveryNotifier(port->m_discoveryNotifier, popo::DiscoveryPortType::SUBSCRIBER, port.to_index());
 
     return port.to_ptr();
 }
@@ -65,6 +66,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
     {
         return nullptr;
     }
+    initDiscoveryNotifier(port->m_discoveryNotifier, popo::DiscoveryPortType::SUBSCRIBER, port.to_index());
 
     return port.to_ptr();
 }
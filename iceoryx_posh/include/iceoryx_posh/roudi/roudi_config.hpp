@@ -52,6 +52,12 @@ struct RouDiConfig
     // introspection samples
     /// @brief The number of memory chunks used per introspection topic
     uint32_t introspectionChunkCount{10};
+    /// @brief The interval in which the introspection topics are published; 0 disables the periodic publishing, then
+    /// only the initial sample of the introspection fields is sent
+    units::Duration introspectionInterval{roudi::INTROSPECTION_DEFAULT_INTERVAL};
+    /// @brief The maximum number of processes whose CPU, memory and context switch statistics are sampled per
+    /// interval of the process introspection; the processes are sampled round-robin, 0 disables the sampling
+    uint32_t processStatisticsSamplesPerInterval{roudi::PROCESS_STATISTICS_DEFAULT_SAMPLES_PER_INTERVAL};
 
     /// @brief the number of memory chunks used for discovery
     uint32_t discoveryChunkCount{10};
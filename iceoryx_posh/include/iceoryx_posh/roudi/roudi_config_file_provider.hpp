@@ -35,6 +35,7 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_ALLOCATION_POLICY - the allocation policy of a segment is neither 'best-fit' nor 'spill-over'
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +47,8 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_ALLOCATION_POLICY,
+    DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +61,8 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_ALLOCATION_POLICY",
+                                                                 "DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
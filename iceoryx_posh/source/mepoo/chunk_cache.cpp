@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkCache::MAX_CHUNKS_PER_MEMPOOL;
+constexpr uint32_t ChunkCache::CHUNK_MANAGEMENT_POOL_INDEX;
+
+ChunkCache::ChunkCache(const uint32_t batchSize) noexcept
+    : m_batchSize(algorithm::minVal(batchSize, MAX_CHUNKS_PER_MEMPOOL))
+{
+    if (isEnabled())
+    {
+        m_magazines.resize(m_magazines.capacity());
+    }
+}
+
+bool ChunkCache::isEnabled() const noexcept
+{
+    return m_batchSize > 0U;
+}
+
+void* ChunkCache::getChunk(MemPool& memPool, const uint32_t memPoolIndex) noexcept
+{
+    if (!isEnabled())
+    {
+        return memPool.getChunk();
+    }
+
+    IOX_ENFORCE(memPoolIndex < m_magazines.size(), "Invalid mempool index for the ChunkCache");
+    auto& magazine = m_magazines[memPoolIndex];
+    if (magazine.m_numberOfChunks == 0U)
+    {
+        magazine.m_memPool = &memPool;
+        // the number of chunks is published per acquired chunk and not after the refill, else the chunks would leak
+        // when the process terminates during the refill since 'drain' could not return them
+        memPool.getChunkIndices(&magazine.m_chunkIndices[0], m_batchSize, &magazine.m_numberOfChunks);
+        if (magazine.m_numberOfChunks == 0U)
+        {
+            return nullptr;
+        }
+    }
+
+    --magazine.m_numberOfChunks;
+    return memPool.getChunkFromIndex(magazine.m_chunkIndices[magazine.m_numberOfChunks]);
+}
+
+uint32_t ChunkCache::getNumberOfCachedChunks(const uint32_t memPoolIndex) const noexcept
+{
+    return (memPoolIndex < m_magazines.size()) ? m_magazines[memPoolIndex].m_numberOfChunks : 0U;
+}
+
+void ChunkCache::drain() noexcept
+{
+    for (auto& magazine : m_magazines)
+    {
+        if (magazine.m_numberOfChunks > 0U)
+        {
+            magazine.m_memPool->freeChunkIndices(&magazine.m_chunkIndices[0], magazine.m_numberOfChunks);
+            magazine.m_numberOfChunks = 0U;
+        }
+    }
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -30,11 +30,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint64_t chunkSize) noexcept
+                         const uint64_t chunkSize,
+                         const uint64_t spillAllocations) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_spillAllocations(spillAllocations)
 {
 }
 
@@ -157,6 +159,35 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+uint32_t
+MemPool::getChunkIndices(uint32_t* const indices, const uint32_t count, uint32_t* const numberOfOwnedIndices) noexcept
+{
+    const uint32_t numberOfChunks = m_freeIndices.popN(indices, count, numberOfOwnedIndices);
+
+    if (numberOfChunks > 0U)
+    {
+        m_usedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return numberOfChunks;
+}
+
+void MemPool::freeChunkIndices(const uint32_t* const indices, const uint32_t count) noexcept
+{
+    if (!m_freeIndices.pushN(indices, count))
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(count, std::memory_order_relaxed);
+}
+
+void* MemPool::getChunkFromIndex(const uint32_t index) const noexcept
+{
+    return indexToPointer(index, m_chunkSize, m_rawMemory.get());
+}
+
 uint64_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -182,7 +213,13 @@ MemPoolInfo MemPool::getInfo() const noexcept
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_spillAllocations.load(std::memory_order_relaxed)};
+}
+
+void MemPool::countSpillAllocation() noexcept
+{
+    m_spillAllocations.fetch_add(1U, std::memory_order_relaxed);
 }
 
 } // namespace mepoo
@@ -28,6 +28,12 @@ namespace iox
 {
 namespace mepoo
 {
+namespace
+{
+/// @brief 'getChunk' fails on every loan during an overload; the errors are therefore logged at most once per interval
+constexpr uint64_t GET_CHUNK_ERROR_LOG_INTERVAL_MS{1000U};
+} // namespace
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -72,6 +78,39 @@ void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocat
     m_denyAddMemPool = true;
     uint64_t chunkSize = sizeof(ChunkManagement);
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+
+    generateSizeClassIndex();
+}
+
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t lowerBoundOfSizeClass{1ULL << sizeClass};
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < lowerBoundOfSizeClass)
+        {
+            ++memPoolIndex;
+        }
+        m_firstMemPoolOfSizeClass.emplace_back(memPoolIndex);
+    }
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint64_t chunkSize) noexcept
+{
+    // binary search for the most significant bit with a fixed number of steps
+    uint64_t value{chunkSize};
+    uint32_t sizeClass{0U};
+    for (uint32_t shift = NUMBER_OF_SIZE_CLASSES / 2U; shift > 0U; shift /= 2U)
+    {
+        if (value >= (1ULL << shift))
+        {
+            value >>= shift;
+            sizeClass += shift;
+        }
+    }
+    return sizeClass;
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -139,11 +178,29 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_allocationPolicy = mePooConfig.m_allocationPolicy;
 
     generateChunkManagementPool(managementAllocator);
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunkImpl(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkCache& chunkCache) noexcept
+{
+    return getChunkImpl(chunkSettings, &chunkCache);
+}
+
+void* MemoryManager::acquireChunk(MemPool& memPool, const uint32_t memPoolIndex, ChunkCache* const chunkCache) noexcept
+{
+    return (chunkCache == nullptr) ? memPool.getChunk() : chunkCache->getChunk(memPool, memPoolIndex);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunkImpl(const ChunkSettings& chunkSettings,
+                                                                        ChunkCache* const chunkCache) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
@@ -151,42 +208,72 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
 
     uint64_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    // the size class index is available once the memory manager is configured; with at most one mempool per size
+    // class the first candidate already fits, otherwise only the mempools of the same size class are skipped
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = m_firstMemPoolOfSizeClass.empty()
+                                ? 0U
+                                : m_firstMemPoolOfSizeClass[sizeClassOf(requiredChunkSize)];
+    for (; memPoolIndex < numberOfMemPools; ++memPoolIndex)
     {
+        auto& memPool = m_memPoolVector[memPoolIndex];
         uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
         if (chunkSizeOfMemPool >= requiredChunkSize)
         {
-            chunk = memPool.getChunk();
+            chunk = acquireChunk(memPool, memPoolIndex, chunkCache);
             memPoolPointer = &memPool;
             aquiredChunkSize = chunkSizeOfMemPool;
             break;
         }
     }
 
+    if (chunk == nullptr && memPoolPointer != nullptr
+        && m_allocationPolicy == AllocationPolicy::SPILL_OVER_TO_LARGER_MEMPOOLS)
+    {
+        for (++memPoolIndex; memPoolIndex < numberOfMemPools; ++memPoolIndex)
+        {
+            auto& memPool = m_memPoolVector[memPoolIndex];
+            chunk = acquireChunk(memPool, memPoolIndex, chunkCache);
+            if (chunk != nullptr)
+            {
+                memPool.countSpillAllocation();
+                memPoolPointer = &memPool;
+                aquiredChunkSize = memPool.getChunkSize();
+                break;
+            }
+        }
+    }
+
     if (m_memPoolVector.size() == 0)
     {
-        IOX_LOG(Error, "There are no mempools available!");
+        IOX_LOG_RATE_LIMITED(Error, GET_CHUNK_ERROR_LOG_INTERVAL_MS, "There are no mempools available!");
 
-        IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, iox::er::RUNTIME_ERROR);
+        IOX_REPORT_RATE_LIMITED(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL,
+                                iox::er::RUNTIME_ERROR,
+                                GET_CHUNK_ERROR_LOG_INTERVAL_MS);
         return err(Error::NO_MEMPOOLS_AVAILABLE);
     }
     else if (memPoolPointer == nullptr)
     {
-        IOX_LOG(
+        IOX_LOG_RATE_LIMITED(
             Error,
+            GET_CHUNK_ERROR_LOG_INTERVAL_MS,
             "The following mempools are available:" << [this](auto& log) -> auto& {
                 this->printMemPoolVector(log);
                 return log;
             } << "Could not find a fitting mempool for a chunk of size "
               << requiredChunkSize);
 
-        IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, iox::er::RUNTIME_ERROR);
+        IOX_REPORT_RATE_LIMITED(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE,
+                                iox::er::RUNTIME_ERROR,
+                                GET_CHUNK_ERROR_LOG_INTERVAL_MS);
         return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
     }
     else if (chunk == nullptr)
     {
-        IOX_LOG(
+        IOX_LOG_RATE_LIMITED(
             Error,
+            GET_CHUNK_ERROR_LOG_INTERVAL_MS,
             "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
                 << chunkSettings.userPayloadSize()
                 << "The following mempools are available:" << [this](auto& log) -> auto& {
@@ -194,16 +281,35 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
                 return log;
             });
 
-        IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, iox::er::RUNTIME_ERROR);
+        IOX_REPORT_RATE_LIMITED(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS,
+                                iox::er::RUNTIME_ERROR,
+                                GET_CHUNK_ERROR_LOG_INTERVAL_MS);
         return err(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
-    else
+
+    // the chunk management pool can run empty independently of the data mempools since the chunk caches of other
+    // publishers might hold its chunks
+    void* chunkManagementMemory =
+        acquireChunk(m_chunkManagementPool.front(), ChunkCache::CHUNK_MANAGEMENT_POOL_INDEX, chunkCache);
+    if (chunkManagementMemory == nullptr)
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return ok(SharedChunk(chunkManagement));
+        memPoolPointer->freeChunk(chunk);
+
+        IOX_LOG_RATE_LIMITED(Error,
+                             GET_CHUNK_ERROR_LOG_INTERVAL_MS,
+                             "MemoryManager: unable to acquire a chunk management for a chunk-payload size of "
+                                 << chunkSettings.userPayloadSize());
+
+        IOX_REPORT_RATE_LIMITED(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS,
+                                iox::er::RUNTIME_ERROR,
+                                GET_CHUNK_ERROR_LOG_INTERVAL_MS);
+        return err(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
+
+    auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+    auto chunkManagement = new (chunkManagementMemory)
+        ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+    return ok(SharedChunk(chunkManagement));
 }
 
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
@@ -41,6 +41,12 @@ void MePooConfig::addMemPool(MePooConfig::Entry entry) noexcept
     }
 }
 
+MePooConfig& MePooConfig::setAllocationPolicy(const AllocationPolicy allocationPolicy) noexcept
+{
+    m_allocationPolicy = allocationPolicy;
+    return *this;
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
@@ -17,10 +17,19 @@
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
 {
+uint64_t steadyClockTimestamp() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
 SharedChunk::SharedChunk(ChunkManagement* const resource) noexcept
     : m_chunkManagement(resource)
 {
@@ -136,6 +145,19 @@ ChunkHeader* SharedChunk::getChunkHeader() const noexcept
     }
 }
 
+void SharedChunk::setSendTimestamp(const uint64_t timestamp) noexcept
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_sendTimestamp = timestamp;
+    }
+}
+
+uint64_t SharedChunk::getSendTimestamp() const noexcept
+{
+    return (m_chunkManagement != nullptr) ? m_chunkManagement->m_sendTimestamp : 0U;
+}
+
 ChunkManagement* SharedChunk::release() noexcept
 {
     ChunkManagement* returnValue = m_chunkManagement;
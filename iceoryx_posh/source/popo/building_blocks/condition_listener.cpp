@@ -17,13 +17,16 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/deadline_timer.hpp"
 
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const units::Duration spinDuration) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_spinDuration(spinDuration)
 {
 }
 
@@ -57,7 +60,7 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
+    return waitImpl(m_spinDuration, [this]() -> bool {
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
@@ -69,8 +72,11 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    // the polling is part of the time to wait
+    const auto spinDuration = algorithm::minVal(m_spinDuration, timeToWait);
+    const auto remainingTimeToWait = timeToWait - spinDuration;
+    return waitImpl(spinDuration, [this, remainingTimeToWait]() -> bool {
+        if (this->getMembers()->m_semaphore->timedWait(remainingTimeToWait).has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         }
@@ -78,7 +84,42 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+bool ConditionListener::hasActiveNotifications(const std::memory_order order) const noexcept
+{
+    for (const auto& notificationWord : getMembers()->m_activeNotifications)
+    {
+        if (notificationWord.load(order) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ConditionListener::spinUntilNotified(const units::Duration& spinDuration) noexcept
+{
+    if (spinDuration == units::Duration::zero())
+    {
+        return false;
+    }
+
+    getMembers()->m_isListenerSpinning.store(true, std::memory_order_relaxed);
+    deadline_timer spinTimer(spinDuration);
+    bool hasNotifications{false};
+    do
+    {
+        hasNotifications = hasActiveNotifications(std::memory_order_relaxed);
+    } while (!hasNotifications && !m_toBeDestroyed.load(std::memory_order_relaxed) && !spinTimer.hasExpired());
+
+    // pairs with the ConditionNotifier which sets the notification before it checks whether the listener spins;
+    // either the notifier sees that the listener stopped spinning and posts the semaphore or the listener sees the
+    // notification here
+    getMembers()->m_isListenerSpinning.store(false, std::memory_order_seq_cst);
+    return hasNotifications || hasActiveNotifications(std::memory_order_seq_cst);
+}
+
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const units::Duration& spinDuration,
+                                                                    const function_ref<bool()> waitCall) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
@@ -87,12 +128,15 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+        for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            auto notificationWord = collectNotificationWord(wordIndex);
+            while (notificationWord != 0U)
             {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
+                activeNotifications.emplace_back(static_cast<Type_t>(
+                    wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD + indexOfLowestSetBit(notificationWord)));
+                // clear the lowest set bit
+                notificationWord &= notificationWord - 1U;
             }
         }
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
@@ -100,16 +144,29 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
             return activeNotifications;
         }
 
+        if (spinUntilNotified(spinDuration))
+        {
+            continue;
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+ConditionVariableData::NotificationWord_t ConditionListener::collectNotificationWord(const uint64_t wordIndex) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is always in range
+    auto& notificationWord = getMembers()->m_activeNotifications[wordIndex];
+    // the cheap load avoids acquiring the cache line exclusively when no notification of this word is active
+    if (notificationWord.load(std::memory_order_relaxed) == 0U)
+    {
+        return 0U;
+    }
+
     getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    return notificationWord.exchange(0U, std::memory_order_acquire);
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
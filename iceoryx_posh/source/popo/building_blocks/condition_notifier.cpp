@@ -38,10 +38,18 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    getMembers()
+        ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_notificationIndex)]
+        .fetch_or(ConditionVariableData::notificationBitMask(m_notificationIndex), std::memory_order_seq_cst);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
-    getMembers()->m_semaphore->post().or_else(
-        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+
+    // a spinning ConditionListener sees the notification without the system call; pairs with
+    // 'ConditionListener::spinUntilNotified'
+    if (!getMembers()->m_isListenerSpinning.load(std::memory_order_seq_cst))
+    {
+        getMembers()->m_semaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+    }
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
@@ -36,10 +36,18 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         .create(m_semaphore)
         .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& notificationWord : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        notificationWord.store(0U, std::memory_order_relaxed);
     }
 }
+
+bool ConditionVariableData::isNotificationActive(const uint64_t notificationIndex) const noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is checked by the ConditionNotifier
+    const auto notificationWord = m_activeNotifications[notificationWordIndex(notificationIndex)].load(
+        std::memory_order_relaxed);
+    return (notificationWord & notificationBitMask(notificationIndex)) != 0U;
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_queue.hpp"
+
+namespace iox
+{
+namespace popo
+{
+void DiscoveryNotifier::init(DiscoveryQueue& queue, const DiscoveryPortType portType, const uint64_t index) noexcept
+{
+    m_queue = &queue;
+    m_portType = portType;
+    m_index = index;
+    m_isQueued.store(false, std::memory_order_relaxed);
+    m_isAttached.store(true, std::memory_order_release);
+}
+
+void DiscoveryNotifier::detach() noexcept
+{
+    m_isAttached.store(false, std::memory_order_release);
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    // the queue is not accessed after the detach since its segment might already be unregistered
+    if (!m_isAttached.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    // the release synchronizes the state change of the port with RouDi which resets the flag before it reads the state
+    if (!m_isQueued.exchange(true, std::memory_order_acq_rel))
+    {
+        if (!m_queue->push({m_portType, m_index}))
+        {
+            // the queue requested a full discovery which covers this change
+            m_isQueued.store(false, std::memory_order_release);
+        }
+    }
+}
+
+void DiscoveryNotifier::reset() noexcept
+{
+    m_isQueued.exchange(false, std::memory_order_acq_rel);
+}
+
+} // namespace popo
+} // namespace iox
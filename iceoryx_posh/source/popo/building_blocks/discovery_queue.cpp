@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_queue.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+
+namespace iox
+{
+namespace popo
+{
+bool DiscoveryQueue::push(const Entry entry) noexcept
+{
+    const bool isQueued = m_queue.tryPush(entry);
+    if (!isQueued)
+    {
+        requestFullDiscovery();
+    }
+    ConditionNotifier(m_conditionVariableData, PORT_CHANGE_NOTIFICATION_INDEX).notify();
+    return isQueued;
+}
+
+optional<DiscoveryQueue::Entry> DiscoveryQueue::pop() noexcept
+{
+    return m_queue.pop();
+}
+
+void DiscoveryQueue::requestFullDiscovery() noexcept
+{
+    m_isFullDiscoveryRequested.store(true, std::memory_order_release);
+}
+
+bool DiscoveryQueue::takeFullDiscoveryRequest() noexcept
+{
+    return m_isFullDiscoveryRequested.exchange(false, std::memory_order_acq_rel);
+}
+
+ConditionVariableData& DiscoveryQueue::conditionVariableData() noexcept
+{
+    return m_conditionVariableData;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,233 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// @brief the position of the most significant set bit; 'value' must not be 0
+uint64_t mostSignificantBit(uint64_t value) noexcept
+{
+    uint64_t position{0U};
+    for (uint64_t shift = 32U; shift > 0U; shift /= 2U)
+    {
+        if ((value >> shift) != 0U)
+        {
+            value >>= shift;
+            position += shift;
+        }
+    }
+    return position;
+}
+} // namespace
+
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_SUB_BUCKETS;
+constexpr uint64_t LatencyHistogram::MAX_EXPONENT;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    // the statistics are taken concurrently by emptying the buckets, hence the increment must not lose them
+    m_buckets[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+
+    auto max = m_max.load(std::memory_order_relaxed);
+    while (latencyInNanoseconds > max
+           && !m_max.compare_exchange_weak(max, latencyInNanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencyStatistics LatencyHistogram::takeStatistics() noexcept
+{
+    // every bucket is emptied on its own; a latency which is recorded meanwhile is either in this or the next interval
+    // NOLINTJUSTIFICATION the snapshot has the size of the buckets and is indexed like them
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint64_t snapshot[NUMBER_OF_BUCKETS];
+    LatencyStatistics statistics;
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot[i] = m_buckets[i].exchange(0U, std::memory_order_relaxed);
+        statistics.numberOfSamples += snapshot[i];
+    }
+    statistics.maxInNanoseconds = m_max.exchange(0U, std::memory_order_relaxed);
+
+    if (statistics.numberOfSamples == 0U)
+    {
+        return LatencyStatistics();
+    }
+
+    auto percentile = [&](const uint64_t perMille) {
+        const auto rank = std::max((statistics.numberOfSamples * perMille + 999U) / 1000U, uint64_t{1U});
+        uint64_t numberOfSamplesUpToBucket{0U};
+        for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+        {
+            numberOfSamplesUpToBucket += snapshot[i];
+            if (numberOfSamplesUpToBucket >= rank)
+            {
+                return std::min(bucketUpperBound(i), statistics.maxInNanoseconds);
+            }
+        }
+        return statistics.maxInNanoseconds;
+    };
+    statistics.p50InNanoseconds = percentile(500U);
+    statistics.p99InNanoseconds = percentile(990U);
+    statistics.p999InNanoseconds = percentile(999U);
+
+    return statistics;
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    if (latencyInNanoseconds < NUMBER_OF_SUB_BUCKETS)
+    {
+        return latencyInNanoseconds;
+    }
+
+    const auto exponent = mostSignificantBit(latencyInNanoseconds);
+    if (exponent > MAX_EXPONENT)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    const auto subBucket = (latencyInNanoseconds >> (exponent - SUB_BUCKET_BITS)) & (NUMBER_OF_SUB_BUCKETS - 1U);
+    return (exponent - SUB_BUCKET_BITS + 1U) * NUMBER_OF_SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    if (index < NUMBER_OF_SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const auto shift = index / NUMBER_OF_SUB_BUCKETS - 1U;
+    const auto subBucket = index % NUMBER_OF_SUB_BUCKETS;
+    const auto lowerBound = (NUMBER_OF_SUB_BUCKETS + subBucket) << shift;
+    return lowerBound + (uint64_t{1U} << shift) - 1U;
+}
+
+constexpr uint32_t LatencyConnections::CAPACITY;
+constexpr uint64_t LatencyConnections::NO_PUBLISHER;
+
+void LatencyConnections::record(const uint64_t publisherId, const uint64_t sendTimestamp, const uint64_t now) noexcept
+{
+    // the unused connections have no publisher
+    if (publisherId == NO_PUBLISHER)
+    {
+        return;
+    }
+
+    for (auto& connection : m_connections)
+    {
+        // pairs with the release store of the publisherId in 'connect' which makes the histogram visible
+        if (connection.publisherId.load(std::memory_order_acquire) != publisherId)
+        {
+            continue;
+        }
+        if (sendTimestamp >= connection.connectionTimestamp.load(std::memory_order_relaxed))
+        {
+            connection.histogram->record((now > sendTimestamp) ? now - sendTimestamp : 0U);
+        }
+        return;
+    }
+}
+
+LatencyHistogram* LatencyConnections::connect(const uint64_t publisherId,
+                                              const uint64_t connectionTimestamp,
+                                              const function_ref<LatencyHistogram*()> acquireHistogram) noexcept
+{
+    Connection* unusedConnection{nullptr};
+    for (auto& connection : m_connections)
+    {
+        const auto connectedPublisherId = connection.publisherId.load(std::memory_order_relaxed);
+        if (connectedPublisherId == publisherId)
+        {
+            connection.connectionTimestamp.store(connectionTimestamp, std::memory_order_relaxed);
+            return nullptr;
+        }
+        // prefer a connection which already has a histogram to not take another one from the pool
+        if (connectedPublisherId == NO_PUBLISHER
+            && (unusedConnection == nullptr || (!unusedConnection->histogram && connection.histogram)))
+        {
+            unusedConnection = &connection;
+        }
+    }
+
+    if (unusedConnection == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (unusedConnection->histogram)
+    {
+        // discard the latencies of the previous publisher
+        unusedConnection->histogram->takeStatistics();
+    }
+    else
+    {
+        auto* histogram = acquireHistogram();
+        if (histogram == nullptr)
+        {
+            return nullptr;
+        }
+        unusedConnection->histogram = histogram;
+    }
+
+    unusedConnection->connectionTimestamp.store(connectionTimestamp, std::memory_order_relaxed);
+    unusedConnection->publisherId.store(publisherId, std::memory_order_release);
+    return unusedConnection->histogram.get();
+}
+
+LatencyHistogram* LatencyConnections::disconnect(const uint64_t publisherId) noexcept
+{
+    if (publisherId == NO_PUBLISHER)
+    {
+        return nullptr;
+    }
+
+    for (auto& connection : m_connections)
+    {
+        if (connection.publisherId.load(std::memory_order_relaxed) == publisherId)
+        {
+            connection.publisherId.store(NO_PUBLISHER, std::memory_order_relaxed);
+            return connection.histogram.get();
+        }
+    }
+    return nullptr;
+}
+
+void LatencyConnections::releaseHistograms(const function_ref<void(LatencyHistogram&)> releaseHistogram) noexcept
+{
+    for (auto& connection : m_connections)
+    {
+        connection.publisherId.store(NO_PUBLISHER, std::memory_order_relaxed);
+        if (connection.histogram)
+        {
+            releaseHistogram(*connection.histogram.get());
+            connection.histogram = RelativePointer<LatencyHistogram>();
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
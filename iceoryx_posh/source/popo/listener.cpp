@@ -15,7 +15,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_platform/pthread.hpp"
 #include "iox/assertions.hpp"
+#include "iox/logging.hpp"
+
+#include <cerrno>
 
 namespace iox
 {
@@ -26,10 +30,16 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const ListenerOptions& options) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, options.spinDuration)
 {
+    startWorkerThreads(options);
     m_thread = std::thread(&Listener::threadLoop, this);
 }
 
@@ -39,6 +49,7 @@ Listener::~Listener() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    stopWorkerThreads();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -55,8 +66,134 @@ void Listener::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_workerThreads.empty())
+            {
+                m_events[id]->executeCallback();
+            }
+            else
+            {
+                dispatchToWorker(static_cast<uint32_t>(id));
+            }
+        }
+    }
+}
+
+void Listener::startWorkerThreads(const ListenerOptions& options) noexcept
+{
+    if (options.numberOfWorkerThreads == 0U)
+    {
+        return;
+    }
+
+    auto numberOfWorkerThreads = options.numberOfWorkerThreads;
+    if (numberOfWorkerThreads > MAX_NUMBER_OF_WORKERS_PER_LISTENER)
+    {
+        IOX_LOG(Warn,
+                "The Listener supports at most " << MAX_NUMBER_OF_WORKERS_PER_LISTENER << " worker threads but "
+                                                 << numberOfWorkerThreads << " were requested.");
+        numberOfWorkerThreads = MAX_NUMBER_OF_WORKERS_PER_LISTENER;
+    }
+
+    UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(false)
+        .create(m_readyEventsSemaphore)
+        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE); });
+
+    for (uint64_t i = 0U; i < numberOfWorkerThreads; ++i)
+    {
+        optional<uint32_t> cpuAffinity;
+        if (i < options.workerCpuAffinity.size())
+        {
+            cpuAffinity.emplace(options.workerCpuAffinity[i]);
+        }
+        m_workerThreads.emplace_back(&Listener::workerLoop, this, cpuAffinity);
+    }
+}
+
+void Listener::stopWorkerThreads() noexcept
+{
+    if (m_workerThreads.empty())
+    {
+        return;
+    }
+
+    m_stopWorkers.store(true, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < m_workerThreads.size(); ++i)
+    {
+        m_readyEventsSemaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED); });
+    }
+
+    for (auto& worker : m_workerThreads)
+    {
+        worker.join();
+    }
+}
+
+void Listener::dispatchToWorker(const uint32_t index) noexcept
+{
+    // when the callback is already queued or executed, the worker which owns it executes it once more
+    if (m_pendingExecutions[index].fetch_add(1U, std::memory_order_acq_rel) != 0U)
+    {
+        return;
+    }
+
+    IOX_ENFORCE(m_readyEvents.tryPush(index), "Every event is at most once in the queue of ready events");
+    m_readyEventsSemaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED); });
+}
+
+void Listener::workerLoop(const optional<uint32_t> cpuAffinity) noexcept
+{
+    // the worker pins itself before it waits for the first callback, i.e. no callback runs on another CPU
+    if (cpuAffinity.has_value())
+    {
+        auto result = iox_pthread_setaffinity(iox_pthread_self(), cpuAffinity.value());
+        if (result == ENOSYS)
+        {
+            IOX_LOG(Warn, "Pinning the Listener worker threads to a CPU is not supported on this platform.");
+        }
+        else if (result != 0)
+        {
+            IOX_LOG(Warn,
+                    "Unable to pin a Listener worker thread to CPU " << cpuAffinity.value() << "; error code "
+                                                                     << result);
+        }
+    }
+
+    while (true)
+    {
+        if (m_readyEventsSemaphore->wait().has_error())
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED);
+            return;
+        }
+
+        if (m_stopWorkers.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_readyEvents.pop().and_then([this](const auto index) { executeSerialized(index); });
+    }
+}
+
+void Listener::executeSerialized(const uint32_t index) noexcept
+{
+    auto& pendingExecutions = m_pendingExecutions[index];
+    while (true)
+    {
+        m_events[index]->executeCallback();
+
+        uint64_t expectedExecutions{1U};
+        if (pendingExecutions.compare_exchange_strong(
+                expectedExecutions, 0U, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return;
         }
+        // all dispatches which arrived while the callback was executed are collapsed into one further execution
+        pendingExecutions.store(1U, std::memory_order_release);
     }
 }
 
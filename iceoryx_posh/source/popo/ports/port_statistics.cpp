@@ -0,0 +1,51 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/port_statistics.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+void increment(concurrent::Atomic<uint64_t>& counter, const uint64_t value) noexcept
+{
+    // there is only one writer, the readers only need to see a consistent value
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+} // namespace
+
+void PublisherPortStatistics::addSentSample(const uint64_t userPayloadSize, const uint64_t chunkSize) noexcept
+{
+    increment(m_numberOfSentSamples, 1U);
+    increment(m_numberOfSentBytes, userPayloadSize);
+    m_lastChunkSize.store(chunkSize, std::memory_order_relaxed);
+}
+
+void PublisherPortStatistics::addLoanFailure() noexcept
+{
+    increment(m_numberOfLoanFailures, 1U);
+}
+
+void SubscriberPortStatistics::addReceivedSample(const uint64_t userPayloadSize) noexcept
+{
+    increment(m_numberOfReceivedSamples, 1U);
+    increment(m_numberOfReceivedBytes, userPayloadSize);
+}
+
+} // namespace popo
+} // namespace iox
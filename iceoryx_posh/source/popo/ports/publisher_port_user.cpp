@@ -44,8 +44,13 @@ PublisherPortUser::tryAllocateChunk(const uint64_t userPayloadSize,
                                     const uint32_t userHeaderSize,
                                     const uint32_t userHeaderAlignment) noexcept
 {
-    return m_chunkSender.tryAllocate(
+    auto chunkHeader = m_chunkSender.tryAllocate(
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkHeader.has_error())
+    {
+        getMembers()->m_statistics.addLoanFailure();
+    }
+    return chunkHeader;
 }
 
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
@@ -59,6 +64,8 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
 
     if (offerRequested)
     {
+        // samples which only end up in the history of a not offered publisher are not counted as sent
+        getMembers()->m_statistics.addSentSample(chunkHeader->userPayloadSize(), chunkHeader->chunkSize());
         m_chunkSender.send(chunkHeader);
     }
     else
@@ -81,6 +88,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -89,6 +97,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
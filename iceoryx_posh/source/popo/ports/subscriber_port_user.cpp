@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -65,7 +67,12 @@ SubscribeState SubscriberPortUser::getSubscriptionState() const noexcept
 
 expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk() noexcept
 {
-    return m_chunkReceiver.tryGet();
+    auto chunkHeader = m_chunkReceiver.tryGet();
+    if (chunkHeader.has_value())
+    {
+        getMembers()->m_statistics.addReceivedSample(chunkHeader.value()->userPayloadSize());
+    }
+    return chunkHeader;
 }
 
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
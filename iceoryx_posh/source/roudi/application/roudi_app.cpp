@@ -51,6 +51,9 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(Trace, "  Process Kill Delay = " << roudiConfig.processKillDelay);
         IOX_LOG(Trace, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
         IOX_LOG(Trace, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
+        IOX_LOG(Trace, "  Introspection Interval = " << roudiConfig.introspectionInterval);
+        IOX_LOG(Trace,
+                "  Process Statistics Samples Per Interval = " << roudiConfig.processStatisticsSamplesPerInterval);
         IOX_LOG(Trace, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
     }
 }
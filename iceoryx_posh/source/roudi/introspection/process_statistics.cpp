@@ -0,0 +1,267 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/process_statistics.hpp"
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace iox
+{
+namespace roudi
+{
+namespace
+{
+/// @brief large enough for '/proc/<pid>/stat' and '/proc/<pid>/status' of a regular process
+constexpr uint64_t PROC_FILE_BUFFER_SIZE{4096U};
+constexpr uint64_t PROC_FILE_PATH_SIZE{64U};
+constexpr uint64_t NANOSECONDS_PER_SECOND{1000000000U};
+
+// field numbers as documented in proc(5); the first field after the command name is the third one
+constexpr uint64_t STAT_FIELD_AFTER_COMMAND{3U};
+constexpr uint64_t STAT_FIELD_MINOR_FAULTS{10U};
+constexpr uint64_t STAT_FIELD_MAJOR_FAULTS{12U};
+constexpr uint64_t STAT_FIELD_USER_TIME{14U};
+constexpr uint64_t STAT_FIELD_SYSTEM_TIME{15U};
+constexpr uint64_t STAT_FIELD_RESIDENT_SET_SIZE{24U};
+
+/// @brief reads a whole file into the buffer and terminates it with '\0'
+/// @return true if the file could be read, false otherwise, e.g. when the process terminated meanwhile
+bool readProcFile(const char* path, char* buffer, const uint64_t bufferSize) noexcept
+{
+    auto openResult = IOX_POSIX_CALL(iox_open)(path, O_RDONLY, static_cast<iox_mode_t>(0))
+                          .failureReturnValue(-1)
+                          .suppressErrorMessagesForErrnos(ENOENT, ESRCH)
+                          .evaluate();
+    if (openResult.has_error())
+    {
+        return false;
+    }
+    const int fileDescriptor = openResult->value;
+
+    bool hasReadError{false};
+    uint64_t size{0U};
+    while (size + 1U < bufferSize)
+    {
+        auto readResult =
+            IOX_POSIX_CALL(iox_read)(fileDescriptor, &buffer[size], static_cast<size_t>(bufferSize - 1U - size))
+                .failureReturnValue(-1)
+                .suppressErrorMessagesForErrnos(ESRCH)
+                .evaluate();
+        if (readResult.has_error())
+        {
+            hasReadError = true;
+            break;
+        }
+        if (readResult->value == 0)
+        {
+            break;
+        }
+        size += static_cast<uint64_t>(readResult->value);
+    }
+    buffer[size] = '\0';
+
+    IOX_POSIX_CALL(iox_close)(fileDescriptor).failureReturnValue(-1).evaluate().or_else([](auto& r) {
+        IOX_LOG(Error, "Unable to close proc file: " << r.getHumanReadableErrnum());
+    });
+
+    return !hasReadError && size > 0U;
+}
+
+bool parseUnsigned(const char* position, uint64_t& value) noexcept
+{
+    char* end{nullptr};
+    errno = 0;
+    const auto parsedValue = std::strtoull(position, &end, 10);
+    if (end == position || errno != 0)
+    {
+        return false;
+    }
+    value = static_cast<uint64_t>(parsedValue);
+    return true;
+}
+
+uint64_t ticksToNanoseconds(const uint64_t ticks, const uint64_t clockTicksPerSecond) noexcept
+{
+    // split into seconds and remainder to not overflow for long running processes
+    return (ticks / clockTicksPerSecond) * NANOSECONDS_PER_SECOND
+           + ((ticks % clockTicksPerSecond) * NANOSECONDS_PER_SECOND) / clockTicksPerSecond;
+}
+} // namespace
+
+ProcessStatisticsReader::ProcessStatisticsReader() noexcept
+{
+    auto clockTicks = IOX_POSIX_CALL(iox_sysconf)(IOX_SC_CLK_TCK).failureReturnValue(-1).evaluate();
+    auto pageSize = IOX_POSIX_CALL(iox_sysconf)(IOX_SC_PAGESIZE).failureReturnValue(-1).evaluate();
+    if (clockTicks.has_error() || pageSize.has_error() || clockTicks->value <= 0 || pageSize->value <= 0)
+    {
+        IOX_LOG(Info, "The process statistics are not available on this platform");
+        return;
+    }
+    m_clockTicksPerSecond = static_cast<uint64_t>(clockTicks->value);
+    m_pageSize = static_cast<uint64_t>(pageSize->value);
+}
+
+optional<ProcessStatistics> ProcessStatisticsReader::read(const int pid) const noexcept
+{
+    if (m_clockTicksPerSecond == 0U)
+    {
+        return nullopt;
+    }
+
+    // NOLINTJUSTIFICATION fixed size buffers for the C API of the proc files, the sizes are passed along
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char path[PROC_FILE_PATH_SIZE];
+    char buffer[PROC_FILE_BUFFER_SIZE];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    ProcessStatistics statistics;
+
+    std::snprintf(path, PROC_FILE_PATH_SIZE, "/proc/%d/stat", pid);
+    if (!readProcFile(path, buffer, PROC_FILE_BUFFER_SIZE)
+        || !parseStat(buffer, m_clockTicksPerSecond, m_pageSize, statistics))
+    {
+        return nullopt;
+    }
+
+    // the context switches are only available in the status file; when it cannot be read they stay 0
+    std::snprintf(path, PROC_FILE_PATH_SIZE, "/proc/%d/status", pid);
+    if (readProcFile(path, buffer, PROC_FILE_BUFFER_SIZE))
+    {
+        parseStatus(buffer, statistics);
+    }
+
+    return statistics;
+}
+
+bool ProcessStatisticsReader::parseStat(const char* content,
+                                        const uint64_t clockTicksPerSecond,
+                                        const uint64_t pageSize,
+                                        ProcessStatistics& statistics) noexcept
+{
+    // the command name is in parentheses and can contain spaces and parentheses itself
+    const char* position = std::strrchr(content, ')');
+    if (position == nullptr || clockTicksPerSecond == 0U)
+    {
+        return false;
+    }
+    ++position;
+
+    uint64_t userTime{0U};
+    uint64_t systemTime{0U};
+    uint64_t residentSetSize{0U};
+    uint64_t minorFaults{0U};
+    uint64_t majorFaults{0U};
+    uint64_t numberOfParsedFields{0U};
+
+    for (uint64_t field = STAT_FIELD_AFTER_COMMAND; field <= STAT_FIELD_RESIDENT_SET_SIZE; ++field)
+    {
+        while (*position == ' ')
+        {
+            ++position;
+        }
+        if (*position == '\0')
+        {
+            return false;
+        }
+
+        uint64_t* value{nullptr};
+        switch (field)
+        {
+        case STAT_FIELD_MINOR_FAULTS:
+            value = &minorFaults;
+            break;
+        case STAT_FIELD_MAJOR_FAULTS:
+            value = &majorFaults;
+            break;
+        case STAT_FIELD_USER_TIME:
+            value = &userTime;
+            break;
+        case STAT_FIELD_SYSTEM_TIME:
+            value = &systemTime;
+            break;
+        case STAT_FIELD_RESIDENT_SET_SIZE:
+            value = &residentSetSize;
+            break;
+        default:
+            break;
+        }
+        if (value != nullptr)
+        {
+            if (!parseUnsigned(position, *value))
+            {
+                return false;
+            }
+            ++numberOfParsedFields;
+        }
+
+        while (*position != ' ' && *position != '\0')
+        {
+            ++position;
+        }
+    }
+
+    constexpr uint64_t NUMBER_OF_REQUIRED_FIELDS{5U};
+    if (numberOfParsedFields != NUMBER_OF_REQUIRED_FIELDS)
+    {
+        return false;
+    }
+
+    statistics.userCpuTimeInNanoseconds = ticksToNanoseconds(userTime, clockTicksPerSecond);
+    statistics.systemCpuTimeInNanoseconds = ticksToNanoseconds(systemTime, clockTicksPerSecond);
+    statistics.residentSetSizeInBytes = residentSetSize * pageSize;
+    statistics.numberOfMinorPageFaults = minorFaults;
+    statistics.numberOfMajorPageFaults = majorFaults;
+    return true;
+}
+
+bool ProcessStatisticsReader::parseStatus(const char* content, ProcessStatistics& statistics) noexcept
+{
+    // the leading newline distinguishes 'voluntary_ctxt_switches' from 'nonvoluntary_ctxt_switches'
+    // NOLINTJUSTIFICATION string literals for strstr whose length is known at compile time
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    constexpr const char VOLUNTARY_KEY[]{"\nvoluntary_ctxt_switches:"};
+    constexpr const char INVOLUNTARY_KEY[]{"\nnonvoluntary_ctxt_switches:"};
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+
+    const char* voluntary = std::strstr(content, VOLUNTARY_KEY);
+    const char* involuntary = std::strstr(content, INVOLUNTARY_KEY);
+    if (voluntary == nullptr || involuntary == nullptr)
+    {
+        return false;
+    }
+
+    uint64_t numberOfVoluntarySwitches{0U};
+    uint64_t numberOfInvoluntarySwitches{0U};
+    if (!parseUnsigned(voluntary + sizeof(VOLUNTARY_KEY) - 1U, numberOfVoluntarySwitches)
+        || !parseUnsigned(involuntary + sizeof(INVOLUNTARY_KEY) - 1U, numberOfInvoluntarySwitches))
+    {
+        return false;
+    }
+
+    statistics.numberOfVoluntaryContextSwitches = numberOfVoluntarySwitches;
+    statistics.numberOfInvoluntaryContextSwitches = numberOfInvoluntarySwitches;
+    return true;
+}
+
+} // namespace roudi
+} // namespace iox
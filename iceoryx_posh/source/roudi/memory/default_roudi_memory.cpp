@@ -54,6 +54,8 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const uint32_t
         {align(sizeof(roudi::MemPoolIntrospectionInfoContainer), ALIGNMENT), chunkCount});
     mempoolConfig.m_mempoolConfig.push_back(
         {align(sizeof(roudi::ProcessIntrospectionFieldTopic), ALIGNMENT), chunkCount});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(sizeof(roudi::ProcessStatisticsIntrospectionTopic), ALIGNMENT), chunkCount});
     mempoolConfig.m_mempoolConfig.push_back({align(sizeof(roudi::PortIntrospectionFieldTopic), ALIGNMENT), chunkCount});
     mempoolConfig.m_mempoolConfig.push_back(
         {align(sizeof(roudi::PortThroughputIntrospectionFieldTopic), ALIGNMENT), chunkCount});
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -30,6 +31,22 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief Resets the discovery notifier of the queued data and passes the data to the handler; entries of data which
+/// was already removed from the port pool are ignored
+template <typename Container, typename Handler>
+void handleQueuedData(Container& container, const uint64_t index, const Handler& handler) noexcept
+{
+    auto data = container.iter_from_index(static_cast<typename Container::IndexType>(index));
+    if (data != container.end())
+    {
+        data->m_discoveryNotifier.reset();
+        handler(*data);
+    }
+}
+} // namespace
+
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
 {
     auto result = convert::from_string<int32_t>(str.c_str());
@@ -49,6 +66,77 @@ capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
     return static_cast<capro::Interfaces>(i);
 }
 
+PortManager::SubscriberPortIndex::SubscriberPortIndex() noexcept
+{
+    for (uint32_t node = 0U; node < CAPACITY; ++node)
+    {
+        m_subscriberPorts[node] = nullptr;
+        m_nextNodes[node] = node + 1U;
+    }
+    for (auto& head : m_bucketHeads)
+    {
+        head = NO_NODE;
+    }
+}
+
+void PortManager::SubscriberPortIndex::insert(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    // the index has the capacity of the subscriber port list and can therefore not run out of nodes
+    IOX_ENFORCE(m_freeNodes != NO_NODE, "The subscriber port index has more entries than subscriber ports exist");
+
+    const auto node = m_freeNodes;
+    m_freeNodes = m_nextNodes[node];
+    m_subscriberPorts[node] = subscriberPortData;
+    m_nextNodes[node] = NO_NODE;
+
+    auto* link = &m_bucketHeads[bucketOf(subscriberPortData->m_serviceDescription)];
+    while (*link != NO_NODE)
+    {
+        link = &m_nextNodes[*link];
+    }
+    *link = node;
+}
+
+void PortManager::SubscriberPortIndex::remove(const SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    auto* link = &m_bucketHeads[bucketOf(subscriberPortData->m_serviceDescription)];
+    while (*link != NO_NODE)
+    {
+        const auto node = *link;
+        if (m_subscriberPorts[node] == subscriberPortData)
+        {
+            *link = m_nextNodes[node];
+            m_subscriberPorts[node] = nullptr;
+            m_nextNodes[node] = m_freeNodes;
+            m_freeNodes = node;
+            return;
+        }
+        link = &m_nextNodes[node];
+    }
+}
+
+void PortManager::SubscriberPortIndex::forEachInBucket(
+    const capro::ServiceDescription& serviceDescription,
+    function_ref<void(SubscriberPortType::MemberType_t&)> callable) const noexcept
+{
+    // the next node is read before the callable is applied, hence the callable is allowed to remove the current port
+    auto node = m_bucketHeads[bucketOf(serviceDescription)];
+    while (node != NO_NODE)
+    {
+        const auto nextNode = m_nextNodes[node];
+        callable(*m_subscriberPorts[node]);
+        node = nextNode;
+    }
+}
+
+uint32_t PortManager::SubscriberPortIndex::bucketOf(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return internal::hashOf(serviceDescription.getServiceIDString(),
+                            serviceDescription.getInstanceIDString(),
+                            serviceDescription.getEventIDString())
+           & (NUMBER_OF_BUCKETS - 1U);
+}
+
 PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
 {
     m_roudiMemoryInterface = roudiMemoryInterface;
@@ -116,6 +204,11 @@ void PortManager::stopPortIntrospection() noexcept
     m_portIntrospection.stop();
 }
 
+void PortManager::setPortIntrospectionInterval(const units::Duration interval) noexcept
+{
+    m_portIntrospection.setSendInterval(interval);
+}
+
 void PortManager::doDiscovery() noexcept
 {
     handlePublisherPorts();
@@ -133,6 +226,72 @@ void PortManager::doDiscovery() noexcept
     publishServiceRegistry();
 }
 
+void PortManager::doDiscoveryForChangedPorts() noexcept
+{
+    auto& queue = discoveryQueue();
+    // taken before the queue is processed to not miss a request which is made while the queue is processed
+    const bool isFullDiscoveryRequested = queue.takeFullDiscoveryRequest();
+
+    bool hasInterfaceChanges{false};
+    for (auto entry = queue.pop(); entry.has_value(); entry = queue.pop())
+    {
+        const auto index = entry->index;
+        switch (entry->portType)
+        {
+        case popo::DiscoveryPortType::PUBLISHER:
+            handleQueuedData(m_portPool->getPublisherPortDataList(), index, [this](auto& portData) {
+                this->handlePublisherPort(&portData);
+            });
+            break;
+        case popo::DiscoveryPortType::SUBSCRIBER:
+            handleQueuedData(m_portPool->getSubscriberPortDataList(), index, [this](auto& portData) {
+                this->handleSubscriberPort(&portData);
+            });
+            break;
+        case popo::DiscoveryPortType::SERVER:
+            handleQueuedData(m_portPool->getServerPortDataList(), index, [this](auto& portData) {
+                this->handleServerPort(portData);
+            });
+            break;
+        case popo::DiscoveryPortType::CLIENT:
+            handleQueuedData(m_portPool->getClientPortDataList(), index, [this](auto& portData) {
+                this->handleClientPort(portData);
+            });
+            break;
+        case popo::DiscoveryPortType::INTERFACE:
+            // there are only a few interface ports and new ones need the offers of all ports, therefore all interface
+            // ports are handled at once
+            handleQueuedData(m_portPool->getInterfacePortDataList(), index, [&hasInterfaceChanges](auto&) {
+                hasInterfaceChanges = true;
+            });
+            break;
+        }
+    }
+
+    if (isFullDiscoveryRequested)
+    {
+        doDiscovery();
+        return;
+    }
+
+    if (hasInterfaceChanges)
+    {
+        handleInterfaces();
+    }
+
+    publishServiceRegistry();
+}
+
+popo::DiscoveryQueue& PortManager::discoveryQueue() noexcept
+{
+    return m_portPool->getDiscoveryQueue();
+}
+
+void PortManager::detachDiscoveryQueue() noexcept
+{
+    m_portPool->detachDiscoveryNotifiers();
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
@@ -141,15 +300,20 @@ void PortManager::handlePublisherPorts() noexcept
     while (port != publisherPorts.end())
     {
         auto currentPort = port++;
-        PublisherPortRouDiType publisherPort(currentPort.to_ptr());
+        handlePublisherPort(currentPort.to_ptr());
+    }
+}
 
-        doDiscoveryForPublisherPort(publisherPort);
+void PortManager::handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    PublisherPortRouDiType publisherPort(publisherPortData);
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
-        {
-            destroyPublisherPort(currentPort.to_ptr());
-        }
+    doDiscoveryForPublisherPort(publisherPort);
+
+    // check if we have to destroy this publisher port
+    if (publisherPort.toBeDestroyed())
+    {
+        destroyPublisherPort(publisherPortData);
     }
 }
 
@@ -190,15 +354,20 @@ void PortManager::handleSubscriberPorts() noexcept
     while (port != subscriberPorts.end())
     {
         auto currentPort = port++;
-        SubscriberPortType subscriberPort(currentPort.to_ptr());
+        handleSubscriberPort(currentPort.to_ptr());
+    }
+}
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+void PortManager::handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    SubscriberPortType subscriberPort(subscriberPortData);
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
-        {
-            destroySubscriberPort(currentPort.to_ptr());
-        }
+    doDiscoveryForSubscriberPort(subscriberPort);
+
+    // check if we have to destroy this subscriber port
+    if (subscriberPort.toBeDestroyed())
+    {
+        destroySubscriberPort(subscriberPortData);
     }
 }
 
@@ -222,6 +391,7 @@ void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPor
                     IOX_PANIC("Expected no response on NACK messages");
                 });
             }
+            m_portIntrospection.reportSubscriberStateChange();
         }
         else
         {
@@ -274,15 +444,20 @@ void PortManager::handleClientPorts() noexcept
     while (port != clientPorts.end())
     {
         auto currentPort = port++;
-        popo::ClientPortRouDi clientPort(*currentPort);
+        handleClientPort(*currentPort);
+    }
+}
 
-        doDiscoveryForClientPort(clientPort);
+void PortManager::handleClientPort(popo::ClientPortData& clientPortData) noexcept
+{
+    popo::ClientPortRouDi clientPort(clientPortData);
 
-        // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
-        {
-            destroyClientPort(currentPort.to_ptr());
-        }
+    doDiscoveryForClientPort(clientPort);
+
+    // check if we have to destroy this clinet port
+    if (clientPort.toBeDestroyed())
+    {
+        destroyClientPort(&clientPortData);
     }
 }
 
@@ -372,15 +547,20 @@ void PortManager::handleServerPorts() noexcept
     while (port != serverPorts.end())
     {
         auto currentPort = port++;
-        popo::ServerPortRouDi serverPort(*currentPort);
+        handleServerPort(*currentPort);
+    }
+}
 
-        doDiscoveryForServerPort(serverPort);
+void PortManager::handleServerPort(popo::ServerPortData& serverPortData) noexcept
+{
+    popo::ServerPortRouDi serverPort(serverPortData);
 
-        // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
-        {
-            destroyServerPort(currentPort.to_ptr());
-        }
+    doDiscoveryForServerPort(serverPort);
+
+    // check if we have to destroy this server port
+    if (serverPort.toBeDestroyed())
+    {
+        destroyServerPort(&serverPortData);
     }
 }
 
@@ -495,11 +675,16 @@ void PortManager::handleConditionVariables() noexcept
     while (condVar != condVars.end())
     {
         auto currentCondVar = condVar++;
-        if (currentCondVar->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(Debug, "Destroy ConditionVariableData from runtime '" << currentCondVar->m_runtimeName << "'");
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
-        }
+        handleConditionVariable(currentCondVar.to_ptr());
+    }
+}
+
+void PortManager::handleConditionVariable(popo::ConditionVariableData* const conditionVariableData) noexcept
+{
+    if (conditionVariableData->m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        IOX_LOG(Debug, "Destroy ConditionVariableData from runtime '" << conditionVariableData->m_runtimeName << "'");
+        m_portPool->removeConditionVariableData(conditionVariableData);
     }
 }
 
@@ -555,6 +740,12 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                     });
 
                 m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+
+                if (message.m_type == capro::CaproMessageType::SUB
+                    && publisherResponse->m_type == capro::CaproMessageType::ACK)
+                {
+                    connectLatencyHistogram(publisherPort, message, subscriberSource.getUniqueID());
+                }
             }
             publisherFound = true;
         }
@@ -565,8 +756,9 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
+    bool hasDispatchedToSubscribers{false};
+    // only the subscriber ports with the same service description can match; the index yields them without a scan
+    m_subscriberPortIndex.forEachInBucket(message.m_serviceDescription, [&](auto& subscriberPortData) {
         SubscriberPortType subscriberPort(&subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -577,12 +769,13 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
             // iox-#1908
-            continue;
+            return;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
         {
             auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
+            hasDispatchedToSubscribers = true;
 
             // if the subscribers react on the change, process it immediately on publisher side
             if (subscriberResponse.has_value())
@@ -605,12 +798,64 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                         });
 
                     m_portIntrospection.reportMessage(publisherResponse.value());
+
+                    if (subscriberResponse->m_type == capro::CaproMessageType::SUB
+                        && publisherResponse->m_type == capro::CaproMessageType::ACK)
+                    {
+                        connectLatencyHistogram(
+                            publisherSource, subscriberResponse.value(), subscriberPort.getUniqueID());
+                    }
                 }
             }
         }
+    });
+
+    if (hasDispatchedToSubscribers)
+    {
+        m_portIntrospection.reportSubscriberStateChange();
+    }
+}
+
+void PortManager::connectLatencyHistogram(const PublisherPortRouDiType& publisher,
+                                          const capro::CaproMessage& subscription,
+                                          const popo::UniquePortId& subscriberId) noexcept
+{
+    if (!publisher.getOptions().measureLatency || subscription.m_chunkQueueData == nullptr)
+    {
+        return;
+    }
+
+    auto* receiverData =
+        static_cast<SubscriberPortType::MemberType_t::ChunkReceiverData_t*>(subscription.m_chunkQueueData);
+    const auto publisherId = publisher.getUniqueID();
+    // samples which were sent before this point in time, i.e. the history, are not measured
+    auto* histogram = receiverData->m_latencyConnections.connect(
+        static_cast<uint64_t>(publisherId), mepoo::steadyClockTimestamp(), [&]() -> popo::LatencyHistogram* {
+            return m_portPool->acquireLatencyHistogram().value_or(nullptr);
+        });
+    if (histogram != nullptr)
+    {
+        m_portIntrospection.addLatencyConnection(subscriberId, publisherId, *histogram);
     }
 }
 
+void PortManager::disconnectLatencyHistograms(const PublisherPortRouDiType& publisher) noexcept
+{
+    if (!publisher.getOptions().measureLatency)
+    {
+        return;
+    }
+
+    const auto publisherId = static_cast<uint64_t>(publisher.getUniqueID());
+    m_subscriberPortIndex.forEachInBucket(publisher.getCaProServiceDescription(), [&](auto& subscriberPortData) {
+        auto* histogram = subscriberPortData.m_chunkReceiverData.m_latencyConnections.disconnect(publisherId);
+        if (histogram != nullptr)
+        {
+            m_portIntrospection.removeLatencyConnection(*histogram);
+        }
+    });
+}
+
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
                                            const popo::ClientPortRouDi& client) const noexcept
 {
@@ -851,6 +1096,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
 
     publisherPortRoudi.releaseAllChunks();
 
+    disconnectLatencyHistograms(publisherPortRoudi);
     m_portIntrospection.removePublisher(publisherPortUser);
 
     IOX_LOG(Debug,
@@ -879,6 +1125,10 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
 
     subscriberPortRoudi.releaseAllChunks();
 
+    subscriberPortData->m_chunkReceiverData.m_latencyConnections.releaseHistograms([this](auto& histogram) {
+        m_portIntrospection.removeLatencyConnection(histogram);
+        m_portPool->releaseLatencyHistogram(&histogram);
+    });
     m_portIntrospection.removeSubscriber(subscriberPortUser);
 
     IOX_LOG(Debug,
@@ -886,6 +1136,7 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
                                                      << "' and with service description '"
                                                      << subscriberPortData->m_serviceDescription << "'");
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberPortIndex.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
@@ -998,6 +1249,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         if (subscriberPortData)
         {
             m_portIntrospection.addSubscriber(*subscriberPortData);
+            m_subscriberPortIndex.insert(subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
             SubscriberPortType subscriberPort(subscriberPortData);
@@ -1150,6 +1402,12 @@ void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescriptio
 expected<popo::ConditionVariableData*, PortPoolError>
 PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
+    // the destroy requests of the condition variables are not queued for the discovery since they only release the
+    // slot; the slots are reclaimed when they are needed, with the full discovery or when the process is removed
+    if (m_portPool->getConditionVariableDataList().full())
+    {
+        handleConditionVariables();
+    }
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
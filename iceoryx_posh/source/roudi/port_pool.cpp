@@ -38,6 +38,33 @@ PortPoolData::CondVarContainer& PortPool::getConditionVariableDataList() noexcep
     return m_portPoolData->m_conditionVariableMembers;
 }
 
+popo::DiscoveryQueue& PortPool::getDiscoveryQueue() noexcept
+{
+    return m_portPoolData->m_discoveryQueue;
+}
+
+void PortPool::detachDiscoveryNotifiers() noexcept
+{
+    auto detach = [](auto& container) {
+        for (auto& data : container)
+        {
+            data.m_discoveryNotifier.detach();
+        }
+    };
+    detach(getPublisherPortDataList());
+    detach(getSubscriberPortDataList());
+    detach(getServerPortDataList());
+    detach(getClientPortDataList());
+    detach(getInterfacePortDataList());
+}
+
+void PortPool::initDiscoveryNotifier(popo::DiscoveryNotifier& notifier,
+                                     const popo::DiscoveryPortType portType,
+                                     const uint64_t index) noexcept
+{
+    notifier.init(m_portPoolData->m_discoveryQueue, portType, index);
+}
+
 expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces commInterface) noexcept
 {
@@ -49,6 +76,10 @@ PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interf
         IOX_REPORT(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    initDiscoveryNotifier(
+        interfacePortData->m_discoveryNotifier, popo::DiscoveryPortType::INTERFACE, interfacePortData.to_index());
+    // the new interface needs the initial offer forwarding with the next discovery run
+    interfacePortData->m_discoveryNotifier.notify();
     return ok(interfacePortData.to_ptr());
 }
 
@@ -75,6 +106,22 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+expected<popo::LatencyHistogram*, PortPoolError> PortPool::acquireLatencyHistogram() noexcept
+{
+    auto latencyHistogram = m_portPoolData->m_latencyHistograms.emplace();
+    if (latencyHistogram == m_portPoolData->m_latencyHistograms.end())
+    {
+        IOX_LOG(Warn, "Out of latency histograms! The latency of further connections is not measured");
+        return err(PortPoolError::LATENCY_HISTOGRAM_LIST_FULL);
+    }
+    return ok(latencyHistogram.to_ptr());
+}
+
+void PortPool::releaseLatencyHistogram(const popo::LatencyHistogram* const latencyHistogram) noexcept
+{
+    m_portPoolData->m_latencyHistograms.erase(latencyHistogram);
+}
+
 PortPoolData::PublisherContainer& PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers;
@@ -102,6 +149,8 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    initDiscoveryNotifier(
+        publisherPortData->m_discoveryNotifier, popo::DiscoveryPortType::PUBLISHER, publisherPortData.to_index());
     return ok(publisherPortData.to_ptr());
 }
 
@@ -151,6 +200,8 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    initDiscoveryNotifier(
+        clientPortData->m_discoveryNotifier, popo::DiscoveryPortType::CLIENT, clientPortData.to_index());
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,6 +222,8 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    initDiscoveryNotifier(
+        serverPortData->m_discoveryNotifier, popo::DiscoveryPortType::SERVER, serverPortData.to_index());
     return ok(serverPortData.to_ptr());
 }
 
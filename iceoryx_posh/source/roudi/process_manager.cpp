@@ -461,7 +461,11 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
 {
     findProcess(name)
         .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+            const auto numaNode = (publisherOptions.numaNode == popo::PublisherOptions::ANY_NUMA_NODE)
+                                      ? nullopt
+                                      : optional<uint32_t>(publisherOptions.numaNode);
+            auto segmentInfo =
+                m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser(), numaNode);
 
             if (!segmentInfo.m_memoryManager.has_value())
             {
@@ -747,7 +751,7 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
-    m_portManager.doDiscovery();
+    m_portManager.doDiscoveryForChangedPorts();
 }
 
 } // namespace roudi
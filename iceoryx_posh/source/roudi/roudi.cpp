@@ -17,8 +17,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/detail/convert.hpp"
@@ -54,9 +55,16 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     {
         IOX_LOG(Warn, "Runnning RouDi on 32-bit architectures is experimental! Use at your own risk!");
     }
-    m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
+    // the process manager is locked until the end of the full expression, hence the ports are acquired one by one
+    auto* processPortData = m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService);
+    auto* processStatisticsPortData = m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessStatisticsService);
+    m_processIntrospection.registerPublisherPort(PublisherPortUserType(processPortData),
+                                                 PublisherPortUserType(processStatisticsPortData));
     m_prcMgr->initIntrospection(&m_processIntrospection);
+    m_processIntrospection.setSendInterval(m_roudiConfig.introspectionInterval);
+    m_processIntrospection.setStatisticsSamplesPerInterval(m_roudiConfig.processStatisticsSamplesPerInterval);
+    m_mempoolIntrospection.setSendInterval(m_roudiConfig.introspectionInterval);
+    m_portManager->setPortIntrospectionInterval(m_roudiConfig.introspectionInterval);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -96,7 +104,7 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -167,6 +175,11 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(Debug, "...'IPC-msg-process' thread joined.");
     }
+
+    // neither the discovery nor new ports are processed anymore; the ports must not access the discovery queue while
+    // they are destroyed since the relative pointers can already be unregistered, e.g. by another RouDi in the same
+    // process
+    m_portManager->detachDiscoveryQueue();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -189,7 +202,8 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    m_portManager->discoveryQueue().requestFullDiscovery();
+    triggerDiscoveryLoop();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(Error,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -198,22 +212,20 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
     });
 }
 
+void RouDi::triggerDiscoveryLoop() noexcept
+{
+    popo::ConditionNotifier(m_portManager->discoveryQueue().conditionVariableData(),
+                            popo::DiscoveryQueue::TRIGGER_NOTIFICATION_INDEX)
+        .notify();
+}
+
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the ports notify the condition variable of the discovery queue when their state changes; the timeout is only
+    // needed for the monitoring of the processes
+    popo::ConditionListener discoveryLoopListener(m_portManager->discoveryQueue().conditionVariableData());
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
@@ -222,6 +234,8 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 
         cyclicUpdateHook();
 
+        log::RateLimiter::flushSuppressedOccurrences();
+
         if (manuallyTriggered)
         {
             m_discoveryFinishedSemaphore->post().or_else([](const auto& error) {
@@ -232,9 +246,9 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        for (const auto notificationIndex : discoveryLoopListener.timedWait(DISCOVERY_INTERVAL))
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex == popo::DiscoveryQueue::TRIGGER_NOTIFICATION_INDEX)
             {
                 manuallyTriggered = true;
                 break;
@@ -260,8 +274,8 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
         runtime::IpcMessage message;
         if (roudiIpc.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            auto cmd = runtime::ipcMessageTypeAtIndex(message, 0U);
+            auto runtimeName = message.getStringAtIndex<RuntimeName_t::capacity()>(1U);
 
             processMessage(message, cmd, runtimeName);
         }
@@ -273,14 +287,10 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
                                                  iox_uid_t& userId,
                                                  int64_t& transmissionTimestamp) noexcept
 {
-    convert::from_string<uint32_t>(message.getElementAtIndex(2).c_str()).and_then([&pid](const auto value) {
-        pid = value;
-    });
-    convert::from_string<uint32_t>(message.getElementAtIndex(3).c_str()).and_then([&userId](const auto value) {
-        userId = value;
-    });
-    convert::from_string<int64_t>(message.getElementAtIndex(4).c_str())
-        .and_then([&transmissionTimestamp](const auto value) { transmissionTimestamp = value; });
+    message.getIntegerAtIndex<uint32_t>(2U).and_then([&pid](const auto value) { pid = value; });
+    message.getIntegerAtIndex<uint32_t>(3U).and_then([&userId](const auto value) { userId = value; });
+    message.getIntegerAtIndex<int64_t>(4U).and_then(
+        [&transmissionTimestamp](const auto value) { transmissionTimestamp = value; });
 
     Serialization serializationVersionInfo(message.getElementAtIndex(5));
     return serializationVersionInfo;
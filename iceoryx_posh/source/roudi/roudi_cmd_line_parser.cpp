@@ -39,10 +39,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"introspection-interval", required_argument, nullptr, 'i'},
+                                       {"process-statistics", required_argument, nullptr, 'p'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:i:p:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -92,6 +94,18 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-i, --introspection-interval <UINT>" << std::endl;
+            std::cout << "                                  Sets the interval in milliseconds in which" << std::endl;
+            std::cout << "                                  RouDi publishes the introspection data." << std::endl;
+            std::cout << "                                  0 disables the periodic publishing." << std::endl;
+            std::cout << "                                  default = '1000'" << std::endl;
+            std::cout << "-p, --process-statistics <UINT>   Sets the maximum number of processes whose" << std::endl;
+            std::cout << "                                  CPU, memory and context switch statistics" << std::endl;
+            std::cout << "                                  are sampled per introspection interval." << std::endl;
+            std::cout << "                                  <UINT> 0..MAX_PROCESS_NUMBER" << std::endl;
+            std::cout << "                                  0 disables the sampling." << std::endl;
+            std::cout << "                                  default = '"
+                      << roudi::PROCESS_STATISTICS_DEFAULT_SAMPLES_PER_INTERVAL << "'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -220,6 +234,35 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'i':
+        {
+            constexpr uint64_t MAX_INTROSPECTION_INTERVAL = std::numeric_limits<uint32_t>::max();
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value())
+            {
+                IOX_LOG(Error,
+                        "The introspection interval must be in the range of [0, " << MAX_INTROSPECTION_INTERVAL
+                                                                                  << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.introspectionInterval = units::Duration::fromMilliseconds(maybeValue.value());
+            break;
+        }
+        case 'p':
+        {
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value() || maybeValue.value() > MAX_PROCESS_NUMBER)
+            {
+                IOX_LOG(Error,
+                        "The number of process statistics samples must be in the range of [0, " << MAX_PROCESS_NUMBER
+                                                                                                << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.processStatisticsSamplesPerInterval = maybeValue.value();
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
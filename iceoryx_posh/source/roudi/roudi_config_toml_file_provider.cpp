@@ -148,6 +148,28 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+        auto allocationPolicy = segment->get_as<std::string>("allocation-policy").value_or("best-fit");
+        if (allocationPolicy == "spill-over")
+        {
+            mempoolConfig.setAllocationPolicy(iox::mepoo::AllocationPolicy::SPILL_OVER_TO_LARGER_MEMPOOLS);
+        }
+        else if (allocationPolicy != "best-fit")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_ALLOCATION_POLICY);
+        }
+
+        iox::mepoo::SegmentMemoryOptions memoryOptions;
+        memoryOptions.useHugePages = segment->get_as<bool>("huge-pages").value_or(false);
+        memoryOptions.lockMemory = segment->get_as<bool>("lock-memory").value_or(false);
+        memoryOptions.prefaultMemory = segment->get_as<bool>("prefault").value_or(false);
+        memoryOptions.initializationThreads =
+            segment->get_as<uint32_t>("initialization-threads").value_or(memoryOptions.initializationThreads);
+        auto numaNode = segment->get_as<uint32_t>("numa-node");
+        if (numaNode)
+        {
+            memoryOptions.numaNode.emplace(*numaNode);
+        }
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -173,10 +195,24 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             }
             mempoolConfig.addMemPool({*chunkSize, *chunkCount});
         }
+
+        const auto writerGroup = PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size());
+        for (const auto& existingSegment : parsedConfig.m_sharedMemorySegments)
+        {
+            if (existingSegment.m_writerGroup == writerGroup
+                && existingSegment.m_memoryOptions.numaNode == memoryOptions.numaNode)
+            {
+                return iox::err(
+                    iox::roudi::RouDiConfigFileParseError::DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE);
+            }
+        }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
-             PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             writerGroup,
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             memoryOptions});
     }
 
     return iox::ok(parsedConfig);
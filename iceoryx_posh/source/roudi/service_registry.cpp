@@ -21,11 +21,59 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+// 32 bit FNV-1a
+constexpr uint32_t FNV_OFFSET_BASIS{2166136261U};
+constexpr uint32_t FNV_PRIME{16777619U};
+} // namespace
+
+namespace internal
+{
+uint32_t hashOf(const capro::IdString_t& id) noexcept
+{
+    uint32_t hash{FNV_OFFSET_BASIS};
+    const auto* const characters = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(characters[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t hashOf(const capro::IdString_t& service,
+                const capro::IdString_t& instance,
+                const capro::IdString_t& event) noexcept
+{
+    uint32_t hash{hashOf(service)};
+    hash = (hash ^ hashOf(instance)) * FNV_PRIME;
+    hash = (hash ^ hashOf(event)) * FNV_PRIME;
+    return hash;
+}
+} // namespace internal
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+ServiceRegistry::ServiceRegistry() noexcept
+{
+    for (auto& index : m_indices)
+    {
+        for (auto& bucketHead : index.bucketHeads)
+        {
+            bucketHead = NO_INDEX;
+        }
+        for (uint32_t i = 0U; i < CAPACITY; ++i)
+        {
+            index.nextSlots[i] = NO_INDEX;
+            index.previousSlots[i] = NO_INDEX;
+        }
+    }
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                             ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -47,22 +95,17 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
     // prefer to fill entries close to the front
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
+        emplaceEntry(m_freeIndex, serviceDescription, count);
         m_freeIndex = NO_INDEX;
         return ok();
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t i = 0U; i < m_serviceDescriptions.size(); ++i)
     {
-        if (!entry)
+        if (!m_serviceDescriptions[i])
         {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
+            emplaceEntry(i, serviceDescription, count);
             return ok();
         }
     }
@@ -70,16 +113,33 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
     // append new entry at the end (the size only grows up to capacity)
     if (m_serviceDescriptions.emplace_back())
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
+        emplaceEntry(static_cast<uint32_t>(m_serviceDescriptions.size() - 1U), serviceDescription, count);
         return ok();
     }
 
     return err(Error::SERVICE_REGISTRY_FULL);
 }
 
+void ServiceRegistry::emplaceEntry(const uint32_t slot,
+                                   const capro::ServiceDescription& serviceDescription,
+                                   ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept
+{
+    auto& entry = m_serviceDescriptions[slot];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    insertIntoIndices(slot);
+    m_dataChanged = true;
+}
+
+void ServiceRegistry::resetEntry(const uint32_t slot) noexcept
+{
+    removeFromIndices(slot);
+    m_serviceDescriptions[slot].reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = slot;
+    m_dataChanged = true;
+}
+
 expected<void, ServiceRegistry::Error>
 ServiceRegistry::addPublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
@@ -103,10 +163,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                resetEntry(index);
             }
         }
     }
@@ -123,10 +180,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                resetEntry(index);
             }
         }
     }
@@ -137,11 +191,7 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        resetEntry(index);
     }
 }
 
@@ -150,33 +200,152 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    auto applyIfMatching = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            callable(entry);
+        }
+    };
+
+    if (service && instance && event)
     {
-        if (entry)
+        forEachInBucket(IndexKey::SERVICE_DESCRIPTION, internal::hashOf(*service, *instance, *event), applyIfMatching);
+    }
+    else if (service)
+    {
+        forEachInBucket(IndexKey::SERVICE, internal::hashOf(*service), applyIfMatching);
+    }
+    else if (instance)
+    {
+        forEachInBucket(IndexKey::INSTANCE, internal::hashOf(*instance), applyIfMatching);
+    }
+    else if (event)
+    {
+        forEachInBucket(IndexKey::EVENT, internal::hashOf(*event), applyIfMatching);
+    }
+    else
+    {
+        forEach(callable);
+    }
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    const auto& index = m_indices[static_cast<uint32_t>(IndexKey::SERVICE_DESCRIPTION)];
+    const auto head = index.bucketHeads[bucketOf(hashOf(IndexKey::SERVICE_DESCRIPTION, serviceDescription))];
+    if (head == NO_INDEX)
+    {
+        return NO_INDEX;
+    }
+
+    auto slot = head;
+    do
+    {
+        if (m_serviceDescriptions[slot]->serviceDescription == serviceDescription)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            return slot;
+        }
+        slot = index.nextSlots[slot];
+    } while (slot != head);
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    return NO_INDEX;
+}
+
+uint32_t ServiceRegistry::hashOf(const IndexKey key, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    switch (key)
+    {
+    case IndexKey::SERVICE_DESCRIPTION:
+        return internal::hashOf(serviceDescription.getServiceIDString(),
+                                serviceDescription.getInstanceIDString(),
+                                serviceDescription.getEventIDString());
+    case IndexKey::SERVICE:
+        return internal::hashOf(serviceDescription.getServiceIDString());
+    case IndexKey::INSTANCE:
+        return internal::hashOf(serviceDescription.getInstanceIDString());
+    case IndexKey::EVENT:
+        return internal::hashOf(serviceDescription.getEventIDString());
+    }
+    return 0U;
+}
+
+uint32_t ServiceRegistry::bucketOf(const uint32_t hash) noexcept
+{
+    return hash & (NUMBER_OF_BUCKETS - 1U);
+}
+
+void ServiceRegistry::forEachInBucket(const IndexKey key,
+                                      const uint32_t hash,
+                                      function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    const auto& index = m_indices[static_cast<uint32_t>(key)];
+    const auto head = index.bucketHeads[bucketOf(hash)];
+    if (head == NO_INDEX)
+    {
+        return;
+    }
+
+    auto slot = head;
+    do
+    {
+        callable(*m_serviceDescriptions[slot]);
+        slot = index.nextSlots[slot];
+    } while (slot != head);
+}
+
+void ServiceRegistry::insertIntoIndices(const uint32_t slot) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[slot]->serviceDescription;
+    for (uint32_t key = 0U; key < NUMBER_OF_INDEX_KEYS; ++key)
+    {
+        auto& index = m_indices[key];
+        auto& head = index.bucketHeads[bucketOf(hashOf(static_cast<IndexKey>(key), serviceDescription))];
+        if (head == NO_INDEX)
+        {
+            head = slot;
+            index.nextSlots[slot] = slot;
+            index.previousSlots[slot] = slot;
+            continue;
         }
+
+        // append to keep the insertion order
+        const auto tail = index.previousSlots[head];
+        index.nextSlots[tail] = slot;
+        index.previousSlots[slot] = tail;
+        index.nextSlots[slot] = head;
+        index.previousSlots[head] = slot;
     }
 }
 
-uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
+void ServiceRegistry::removeFromIndices(const uint32_t slot) noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto& serviceDescription = m_serviceDescriptions[slot]->serviceDescription;
+    for (uint32_t key = 0U; key < NUMBER_OF_INDEX_KEYS; ++key)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        auto& index = m_indices[key];
+        auto& head = index.bucketHeads[bucketOf(hashOf(static_cast<IndexKey>(key), serviceDescription))];
+        const auto next = index.nextSlots[slot];
+        const auto previous = index.previousSlots[slot];
+        if (next == slot)
         {
-            return i;
+            head = NO_INDEX;
         }
+        else
+        {
+            index.nextSlots[previous] = next;
+            index.previousSlots[next] = previous;
+            if (head == slot)
+            {
+                head = next;
+            }
+        }
+        index.nextSlots[slot] = NO_INDEX;
+        index.previousSlots[slot] = NO_INDEX;
     }
-    return NO_INDEX;
 }
 
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
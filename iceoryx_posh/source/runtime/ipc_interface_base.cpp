@@ -27,18 +27,18 @@ namespace iox
 {
 namespace runtime
 {
-IpcMessageType stringToIpcMessageType(const char* str) noexcept
+namespace
+{
+IpcMessageType toIpcMessageType(const optional<std::underlying_type<IpcMessageType>::type>& value) noexcept
 {
     using UnderlyingType = std::underlying_type<IpcMessageType>::type;
-    UnderlyingType msg;
-    auto result = convert::from_string<UnderlyingType>(str);
 
-    if (!result.has_value())
+    if (!value.has_value())
     {
         return IpcMessageType::NOTYPE;
     }
 
-    msg = result.value();
+    const auto msg = value.value();
 
     if (static_cast<UnderlyingType>(IpcMessageType::BEGIN) >= msg
         || static_cast<UnderlyingType>(IpcMessageType::END) <= msg)
@@ -48,6 +48,19 @@ IpcMessageType stringToIpcMessageType(const char* str) noexcept
 
     return static_cast<IpcMessageType>(msg);
 }
+} // namespace
+
+IpcMessageType stringToIpcMessageType(const char* str) noexcept
+{
+    using UnderlyingType = std::underlying_type<IpcMessageType>::type;
+    return toIpcMessageType(convert::from_string<UnderlyingType>(str));
+}
+
+IpcMessageType ipcMessageTypeAtIndex(const IpcMessage& message, const uint32_t index) noexcept
+{
+    using UnderlyingType = std::underlying_type<IpcMessageType>::type;
+    return toIpcMessageType(message.getIntegerAtIndex<UnderlyingType>(index));
+}
 
 std::string IpcMessageTypeToString(const IpcMessageType msg) noexcept
 {
@@ -127,13 +140,13 @@ bool IpcInterface<IpcChannelType>::receive(IpcMessage& answer) const noexcept
         return false;
     }
 
-    auto message = m_ipcChannel->receive();
-    if (message.has_error())
+    ReceiveBuffer_t message;
+    if (m_ipcChannel->receive(message).has_error())
     {
         return false;
     }
 
-    return IpcInterface<IpcChannelType>::setMessageFromString(message.value().c_str(), answer);
+    return IpcInterface<IpcChannelType>::setMessageFromString(message.c_str(), answer);
 }
 
 template <typename IpcChannelType>
@@ -146,8 +159,9 @@ bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, I
         return false;
     }
 
-    return !m_ipcChannel->timedReceive(timeout)
-                .and_then([&answer](auto& message) {
+    ReceiveBuffer_t message;
+    return !m_ipcChannel->timedReceive(message, timeout)
+                .and_then([&answer, &message] {
                     IpcInterface<IpcChannelType>::setMessageFromString(message.c_str(), answer);
                 })
                 .has_error()
@@ -186,11 +200,12 @@ bool IpcInterface<IpcChannelType>::send(const IpcMessage& msg) const noexcept
     auto logLengthError = [&msg](PosixIpcChannelError& error) {
         if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
         {
-            const uint64_t messageSize = msg.getMessage().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            const uint64_t messageSize =
+                msg.getMessageBuffer().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
             IOX_LOG(Error, "msg size of " << messageSize << " bigger than configured max message size");
         }
     };
-    return !m_ipcChannel->send(msg.getMessage()).or_else(logLengthError).has_error();
+    return !m_ipcChannel->send(msg.getMessageBuffer()).or_else(logLengthError).has_error();
 }
 
 template <typename IpcChannelType>
@@ -213,11 +228,12 @@ bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Durat
     auto logLengthError = [&msg](PosixIpcChannelError& error) {
         if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
         {
-            const uint64_t messageSize = msg.getMessage().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            const uint64_t messageSize =
+                msg.getMessageBuffer().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
             IOX_LOG(Error, "msg size of " << messageSize << " bigger than configured max message size");
         }
     };
-    return !m_ipcChannel->timedSend(msg.getMessage(), timeout).or_else(logLengthError).has_error();
+    return !m_ipcChannel->timedSend(msg.getMessageBuffer(), timeout).or_else(logLengthError).has_error();
 }
 
 template <typename IpcChannelType>
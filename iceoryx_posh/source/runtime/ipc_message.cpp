@@ -17,7 +17,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 
-#include <algorithm>
+#include <cstring>
 
 namespace iox
 {
@@ -45,22 +45,43 @@ uint32_t IpcMessage::getNumberOfElements() const noexcept
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
-    size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    const char* element{nullptr};
+    uint64_t size{0U};
+    if (!findElement(index, element, size))
+    {
+        return std::string();
+    }
+    return std::string(element, size);
+}
+
+bool IpcMessage::findElement(const uint32_t index, const char*& element, uint64_t& size) const noexcept
+{
+    const char* const message = m_msg.c_str();
+    const uint64_t messageSize = m_msg.size();
+    uint64_t startPos = 0U;
 
-    for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
+    for (uint32_t counter = 0U; startPos < messageSize; ++counter)
     {
+        const auto* const separator = static_cast<const char*>(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) startPos is always inside of the message
+            std::memchr(&message[startPos], m_separator, messageSize - startPos));
+        if (separator == nullptr)
+        {
+            break;
+        }
+
+        const auto endPos = static_cast<uint64_t>(separator - message);
         if (counter == index)
         {
-            return messageRemainder.substr(startPos, endPos - startPos);
+            element = &message[startPos];
+            size = endPos - startPos;
+            return true;
         }
 
-        startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+        startPos = endPos + 1U;
     }
 
-    return std::string();
+    return false;
 }
 
 bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
@@ -78,26 +99,92 @@ bool IpcMessage::isValid() const noexcept
 }
 
 std::string IpcMessage::getMessage() const noexcept
+{
+    return std::string(m_msg.c_str(), m_msg.size());
+}
+
+const IpcMessage::MessageBuffer_t& IpcMessage::getMessageBuffer() const noexcept
 {
     return m_msg;
 }
 
 void IpcMessage::setMessage(const std::string& msg) noexcept
+{
+    setMessage(msg.c_str(), msg.size());
+}
+
+void IpcMessage::setMessage(const char* const msg) noexcept
+{
+    // one more than the capacity to detect messages which are too large
+    setMessage(msg, strnlen(msg, MAX_MESSAGE_SIZE + 1U));
+}
+
+void IpcMessage::setMessage(const char* const msg, const uint64_t size) noexcept
 {
     clearMessage();
 
-    m_msg = msg;
-    if (!m_msg.empty() && m_msg.back() != m_separator)
+    if (size > MAX_MESSAGE_SIZE)
+    {
+        IOX_LOG(Error, "The message with a size of " << size << " exceeds the maximum size of " << MAX_MESSAGE_SIZE);
+        m_isValid = false;
+        return;
+    }
+
+    m_msg.unsafe_raw_access([&](char* str, const auto) -> uint64_t {
+        std::memcpy(str, msg, size);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) size is at most the capacity
+        str[size] = '\0';
+        return size;
+    });
+
+    if (size != 0U && m_msg[size - 1U] != m_separator)
     {
         m_isValid = false;
     }
     else
     {
-        m_numberOfElements =
-            static_cast<uint32_t>(std::count_if(m_msg.begin(), m_msg.end(), [&](char c) { return c == m_separator; }));
+        for (uint64_t i = 0U; i < size; ++i)
+        {
+            if (m_msg[i] == m_separator)
+            {
+                ++m_numberOfElements;
+            }
+        }
     }
 }
 
+void IpcMessage::appendEntry(const char* const entry, const uint64_t size) noexcept
+{
+    if (std::memchr(entry, m_separator, size) != nullptr)
+    {
+        IOX_LOG(Error, "\'" << std::string(entry, size).c_str() << "\' is an invalid IPC channel entry");
+        m_isValid = false;
+        return;
+    }
+
+    if (m_msg.size() + size + 1U > MAX_MESSAGE_SIZE)
+    {
+        IOX_LOG(Error,
+                "The IPC channel entry with a size of " << size << " exceeds the maximum message size of "
+                                                        << MAX_MESSAGE_SIZE);
+        m_isValid = false;
+        return;
+    }
+
+    m_msg.unsafe_raw_access([&](char* str, const auto info) -> uint64_t {
+        // the size was checked above
+        const uint64_t newSize = info.used_size + size + 1U;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(&str[info.used_size], entry, size);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        str[newSize - 1U] = m_separator;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        str[newSize] = '\0';
+        return newSize;
+    });
+    ++m_numberOfElements;
+}
+
 void IpcMessage::clearMessage() noexcept
 {
     m_msg.clear();
@@ -107,7 +194,7 @@ void IpcMessage::clearMessage() noexcept
 
 bool IpcMessage::operator==(const IpcMessage& rhs) const noexcept
 {
-    return this->getMessage() == rhs.getMessage();
+    return m_msg == rhs.m_msg;
 }
 
 } // namespace runtime
@@ -243,9 +243,7 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
         // wait for IpcMessageType::REG_ACK from RouDi for 1 seconds
         if (appIpcInterface.timedReceive(1_s, receiveBuffer))
         {
-            std::string cmd = receiveBuffer.getElementAtIndex(0U);
-
-            if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
+            if (ipcMessageTypeAtIndex(receiveBuffer, 0U) == IpcMessageType::REG_ACK)
             {
                 constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
@@ -258,16 +256,11 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
                 UntypedRelativePointer::offset_t heartbeatOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
                 int64_t receivedTimestamp{0U};
 
-                auto topic_size_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(1U).c_str());
-                auto segment_manager_offset_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(2U).c_str());
-                auto recv_timestamp_result =
-                    iox::convert::from_string<int64_t>(receiveBuffer.getElementAtIndex(3U).c_str());
-                auto segment_id_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(4U).c_str());
-                auto heartbeat_offset_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(5U).c_str());
+                auto topic_size_result = receiveBuffer.getIntegerAtIndex<uint64_t>(1U);
+                auto segment_manager_offset_result = receiveBuffer.getIntegerAtIndex<uint64_t>(2U);
+                auto recv_timestamp_result = receiveBuffer.getIntegerAtIndex<int64_t>(3U);
+                auto segment_id_result = receiveBuffer.getIntegerAtIndex<uint64_t>(4U);
+                auto heartbeat_offset_result = receiveBuffer.getIntegerAtIndex<uint64_t>(5U);
 
                 // validate conversion results
                 if (!topic_size_result.has_value() || !segment_manager_offset_result.has_value()
@@ -738,6 +738,10 @@ void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
     m_heartbeat.and_then([](auto& heartbeat) { heartbeat->beat(); });
 
+    // reports the suppressed rate limited logs of this process, e.g. of failed chunk allocations, when their call site
+    // is not hit again
+    log::RateLimiter::flushSuppressedOccurrences();
+
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
     // usually set; luckily the runtime already has a thread running and therefore this thread is used to unblock the
     // application shutdown from a potentially blocking publisher with the
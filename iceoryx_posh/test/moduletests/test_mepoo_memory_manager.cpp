@@ -377,6 +377,56 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolWithSpillOverPolicyResultsInAcquiringChunksFromLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a76e4512-d437-4f17-8b21-f28929aad860");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::AllocationPolicy::SPILL_OVER_TO_LARGER_MEMPOOLS);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(3U * CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spillAllocations, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spillAllocations, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_spillAllocations, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_spillAllocations, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillOverPolicyFailsWhenAllLargerMemPoolsAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "181fc83c-7fe0-4af2-9fe0-b9b4a0952d2b");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::AllocationPolicy::SPILL_OVER_TO_LARGER_MEMPOOLS);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_64);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spillAllocations, Eq(0U));
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
@@ -419,6 +469,138 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
 }
 
+TEST_F(MemoryManager_test, getChunkWithMultipleMemPoolsPerSizeClassAcquiresChunkFromBestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a6fa617-443a-4ce6-9f83-0a02f8447377");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint64_t CHUNK_SIZE_INCREMENT{8U};
+    constexpr uint64_t NUMBER_OF_MEMPOOLS{24U};
+
+    // this results in several mempools per size class as well as mempools crossing a power of two
+    for (uint64_t i = 1U; i <= NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({i * CHUNK_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint64_t userPayloadSize = 1U; userPayloadSize <= NUMBER_OF_MEMPOOLS * CHUNK_SIZE_INCREMENT; ++userPayloadSize)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        const uint64_t expectedChunkSize =
+            ((userPayloadSize + CHUNK_SIZE_INCREMENT - 1U) / CHUNK_SIZE_INCREMENT) * CHUNK_SIZE_INCREMENT
+            + sizeof(ChunkHeader);
+        sut->getChunk(chunkSettings)
+            .and_then([&](auto& chunk) { EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(expectedChunkSize)); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheAcquiresBatchOfChunksFromMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d0f5a8e-3c51-4f0e-9a3b-52f4b1c8e6d1");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t BATCH_SIZE{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{BATCH_SIZE};
+    auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+    ASSERT_FALSE(chunk.has_error());
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(BATCH_SIZE));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(chunkCache.getNumberOfCachedChunks(0U), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(chunkCache.getNumberOfCachedChunks(iox::mepoo::ChunkCache::CHUNK_MANAGEMENT_POOL_INDEX),
+                Eq(BATCH_SIZE - 1U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheCanAcquireAllChunksOfMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1e0b2a4-58d6-4f73-8e0b-9a6d2f4c3b17");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t BATCH_SIZE{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{BATCH_SIZE};
+    ChunkStore chunkStore;
+    for (uint32_t i = 0; i < CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettings_32, chunkCache)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(chunkCache.getNumberOfCachedChunks(0U), Eq(0U));
+
+    auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.error(), Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, getChunkFailsAndReturnsDataChunkWhenChunkCachesHoldAllChunkManagements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a6a0eea-0900-4d95-b0a9-82c1dd103ab9");
+    constexpr uint32_t CHUNK_COUNT_32{10U};
+    constexpr uint32_t CHUNK_COUNT_64{2U};
+    constexpr uint32_t BATCH_SIZE{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT_32});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT_64});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    // each cache acquires a batch of chunk managements, which drains the chunk management pool
+    iox::mepoo::ChunkCache chunkCache1{BATCH_SIZE};
+    iox::mepoo::ChunkCache chunkCache2{BATCH_SIZE};
+    iox::mepoo::ChunkCache chunkCache3{BATCH_SIZE};
+    ChunkStore chunkStore;
+    for (auto* chunkCache : {&chunkCache1, &chunkCache2})
+    {
+        sut->getChunk(chunkSettings_32, *chunkCache)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+    sut->getChunk(chunkSettings_64, chunkCache3)
+        .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+        .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    const auto usedChunksBefore = sut->getMemPoolInfo(0).m_usedChunks;
+    ASSERT_THAT(usedChunksBefore, Lt(CHUNK_COUNT_32));
+
+    auto chunk = sut->getChunk(chunkSettings_32);
+
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.error(), Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(usedChunksBefore));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, drainingChunkCacheReturnsCachedChunksToMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b8e2f61-0a9c-4d3e-b7f4-e1c2a6d90f38");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t BATCH_SIZE{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache{BATCH_SIZE};
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+        ASSERT_FALSE(chunk.has_error());
+
+        chunkCache.drain();
+
+        EXPECT_THAT(chunkCache.getNumberOfCachedChunks(0U), Eq(0U));
+        EXPECT_THAT(chunkCache.getNumberOfCachedChunks(iox::mepoo::ChunkCache::CHUNK_MANAGEMENT_POOL_INDEX), Eq(0U));
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9fbfe1ff-9d59-449b-b164-433bbb031125");
@@ -87,7 +87,22 @@ class MePooSegment_test : public Test
             return &memory[0];
         }
 
+        uint64_t getPageSize() const
+        {
+            return m_pageSize;
+        }
+
+        iox::optional<uint32_t> getNumaNode() const
+        {
+            return m_numaNode;
+        }
+
+        static constexpr uint64_t REGULAR_PAGE_SIZE{4096U};
+        static constexpr uint64_t HUGE_PAGE_SIZE{2U * 1024U * 1024U};
+
         uint64_t m_memorySizeInBytes{0};
+        uint64_t m_pageSize{REGULAR_PAGE_SIZE};
+        iox::optional<uint32_t> m_numaNode;
         void* m_baseAddressHint{nullptr};
         static constexpr int MEM_SIZE = 100000;
         alignas(8) char memory[MEM_SIZE];
@@ -109,15 +124,29 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, useHugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+        IOX_BUILDER_PARAMETER(bool, prefaultMemory, false)
+
+        IOX_BUILDER_PARAMETER(uint32_t, initializationThreads, 1U)
+
+        IOX_BUILDER_PARAMETER(iox::optional<uint32_t>, numaNode, iox::nullopt)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
-            return iox::ok(SharedMemoryObject_MOCK(m_name,
-                                                   m_memorySizeInBytes,
-                                                   m_accessMode,
-                                                   m_openMode,
-                                                   (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
-                                                   m_permissions));
+            SharedMemoryObject_MOCK sharedMemoryObject(m_name,
+                                                       m_memorySizeInBytes,
+                                                       m_accessMode,
+                                                       m_openMode,
+                                                       (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
+                                                       m_permissions);
+            sharedMemoryObject.m_pageSize = (m_useHugePages) ? SharedMemoryObject_MOCK::HUGE_PAGE_SIZE
+                                                             : SharedMemoryObject_MOCK::REGULAR_PAGE_SIZE;
+            sharedMemoryObject.m_numaNode = m_numaNode;
+            return iox::ok(sharedMemoryObject);
         }
     };
 
@@ -187,6 +216,71 @@ TEST_F(MePooSegment_test, GetSegmentSize)
     EXPECT_THAT(sut->getSegmentSize(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
 }
 
+TEST_F(MePooSegment_test, GetPageSizeReflectsHugePageOption)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4345fa2e-0ee4-48a0-99f0-fdad2fbe0616");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    auto sut = createSut();
+    EXPECT_THAT(sut->getPageSize(), Eq(SharedMemoryObject_MOCK::REGULAR_PAGE_SIZE));
+
+    SegmentMemoryOptions memoryOptions;
+    memoryOptions.useHugePages = true;
+    SUT sutWithHugePages{mepooConfig,
+                         DEFAULT_DOMAIN_ID,
+                         m_managementAllocator,
+                         PosixGroup{"iox_roudi_test1"},
+                         PosixGroup{"iox_roudi_test2"},
+                         MemoryInfo(),
+                         memoryOptions};
+    EXPECT_THAT(sutWithHugePages.getPageSize(), Eq(SharedMemoryObject_MOCK::HUGE_PAGE_SIZE));
+}
+
+TEST_F(MePooSegment_test, NumaNodeSegmentHasNodeSpecificSharedMemoryName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e2f4c71-9a3d-4b56-a0c8-1d7e5f3b9a24");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [](const detail::PosixSharedMemory::Name_t name,
+                                                                       const uint64_t,
+                                                                       const iox::AccessMode,
+                                                                       const iox::OpenMode,
+                                                                       const void*,
+                                                                       const iox::access_rights) {
+        EXPECT_THAT(name,
+                    Eq(detail::PosixSharedMemory::Name_t(
+                        concatenate(iceoryxResourcePrefix(DEFAULT_DOMAIN_ID, ResourceType::USER_DEFINED),
+                                    "iox_roudi_test2_numa1"))));
+    };
+    SegmentMemoryOptions memoryOptions;
+    memoryOptions.numaNode.emplace(1U);
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            memoryOptions};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(sut.getSharedMemoryName(), Eq(ShmName_t("iox_roudi_test2_numa1")));
+    ASSERT_TRUE(sut.getNumaNode().has_value());
+    EXPECT_THAT(sut.getNumaNode().value(), Eq(1U));
+    EXPECT_TRUE(sut.isBoundToNumaNode());
+}
+
+TEST_F(MePooSegment_test, SegmentWithoutNumaNodeIsNotBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b9d6e2a-7c41-4f08-b5e3-9a2c8d1f6e57");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    auto sut = createSut();
+    EXPECT_THAT(sut->getSharedMemoryName(), Eq(ShmName_t("iox_roudi_test2")));
+    EXPECT_FALSE(sut->getNumaNode().has_value());
+    EXPECT_FALSE(sut->isBoundToNumaNode());
+}
+
 TEST_F(MePooSegment_test, GetReaderGroup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ad3fd360-3765-45ae-8285-fe4ae60c91ae");
@@ -45,7 +45,8 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
                      const PosixGroup& readerGroup [[maybe_unused]],
                      const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const SegmentMemoryOptions& memoryOptions [[maybe_unused]]) noexcept
     {
     }
 };
@@ -85,12 +86,44 @@ class SegmentManager_test : public Test
         return config;
     }
 
+    SegmentConfig getSegmentConfigWithNumaNodeSegments()
+    {
+        SegmentMemoryOptions memoryOptionsNode0;
+        memoryOptionsNode0.numaNode.emplace(0U);
+        SegmentMemoryOptions memoryOptionsNode1;
+        memoryOptionsNode1.numaNode.emplace(1U);
+
+        SegmentConfig config;
+        config.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test2", mepooConfig});
+        config.m_sharedMemorySegments.push_back(
+            {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryOptionsNode0});
+        config.m_sharedMemorySegments.push_back(
+            {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryOptionsNode1});
+        return config;
+    }
+
+    SegmentConfig getSegmentConfigWithNumaNodeSegmentBeforeDefaultSegment()
+    {
+        SegmentMemoryOptions memoryOptionsNode0;
+        memoryOptionsNode0.numaNode.emplace(0U);
+
+        SegmentConfig config;
+        config.m_sharedMemorySegments.push_back(
+            {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryOptionsNode0});
+        config.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test2", mepooConfig});
+        return config;
+    }
+
     SegmentConfig getSegmentConfigWithMaximumNumberOfSegements()
     {
         SegmentConfig config;
-        for (uint64_t i = 0U; i < iox::MAX_SHM_SEGMENTS; ++i)
+        config.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test1", mepooConfig});
+        for (uint32_t i = 1U; i < iox::MAX_SHM_SEGMENTS; ++i)
         {
-            config.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test1", mepooConfig});
+            SegmentMemoryOptions memoryOptions;
+            memoryOptions.numaNode.emplace(i);
+            config.m_sharedMemorySegments.push_back(
+                {"iox_roudi_test1", "iox_roudi_test1", mepooConfig, MemoryInfo(), memoryOptions});
         }
         return config;
     }
@@ -185,17 +218,15 @@ TEST_F(SegmentManager_test, getMemoryManagerForUserFailWithNonExistingUser)
     EXPECT_FALSE(sut->getSegmentInformationWithWriteAccessForUser(PosixUser{"no_user"}).m_memoryManager.has_value());
 }
 
-TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupFails)
+TEST_F(SegmentManager_test, addingMoreThanOneSegmentWithoutNumaNodeForWriterGroupFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3fa29560-7341-43bf-a22e-2d3550b49e4e");
     GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
 
     SegmentConfig segmentConfig = getInvalidSegmentConfig();
-    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
-
 
-    IOX_EXPECT_FATAL_FAILURE([&] { sut.getSegmentMappings(PosixUser("iox_roudi_test1")); },
-                             iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
+    IOX_EXPECT_FATAL_FAILURE([&] { SUT sut(segmentConfig, DEFAULT_DOMAIN_ID, &allocator); },
+                             iox::PoshError::MEPOO__SEGMENT_WITH_DUPLICATE_WRITER_GROUP_AND_NUMA_NODE);
 }
 
 TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
@@ -207,4 +238,106 @@ TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
     SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
 }
 
+TEST_F(SegmentManager_test, getSegmentMappingsContainsAllNumaNodeSegmentsOfWriterGroupAsWritable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5a1e8d3-2f7b-4906-8e4c-b3d9a7f12e68");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodeSegments();
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(3u));
+    for (const auto& segment : mapping)
+    {
+        EXPECT_TRUE(segment.m_isWritable);
+    }
+    EXPECT_THAT(mapping[0].m_sharedMemoryName, Eq(ShmName_t("iox_roudi_test2")));
+    EXPECT_THAT(mapping[1].m_sharedMemoryName, Eq(ShmName_t("iox_roudi_test2_numa0")));
+    EXPECT_THAT(mapping[2].m_sharedMemoryName, Eq(ShmName_t("iox_roudi_test2_numa1")));
+}
+
+TEST_F(SegmentManager_test, getMemoryManagerForUserPrefersSegmentOnRequestedNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f4b2d9e-1a6c-4e83-9d05-c8e3b6a4f721");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodeSegments();
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(3u));
+
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}).m_segmentID,
+                Eq(mapping[0].m_segmentId));
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}, 1U).m_segmentID,
+                Eq(mapping[2].m_segmentId));
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}, 0U).m_segmentID,
+                Eq(mapping[1].m_segmentId));
+}
+
+TEST_F(SegmentManager_test, getMemoryManagerForUserFallsBackToDefaultSegmentForUnknownNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2c8a5f1-4b9d-4a17-86e3-5d1f7c9b3a08");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodeSegments();
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(3u));
+
+    auto segmentInfo = sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}, 7U);
+    ASSERT_TRUE(segmentInfo.m_memoryManager.has_value());
+    EXPECT_THAT(segmentInfo.m_segmentID, Eq(mapping[0].m_segmentId));
+}
+
+TEST_F(SegmentManager_test, getSegmentMappingsAcceptsNumaNodeSegmentBeforeDefaultSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04084750-8f01-4bd7-8124-1589a18f9784");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodeSegmentBeforeDefaultSegment();
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2u));
+    EXPECT_TRUE(mapping[0].m_isWritable);
+    EXPECT_TRUE(mapping[1].m_isWritable);
+}
+
+TEST_F(SegmentManager_test, getMemoryManagerForUserWithoutNumaNodeReturnsDefaultSegmentIndependentOfOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "394eaca9-c6fc-4f42-8906-d61b4d65ad6e");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentConfig segmentConfig = getSegmentConfigWithNumaNodeSegmentBeforeDefaultSegment();
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2u));
+
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}).m_segmentID,
+                Eq(mapping[1].m_segmentId));
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}, 7U).m_segmentID,
+                Eq(mapping[1].m_segmentId));
+    EXPECT_THAT(sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}, 0U).m_segmentID,
+                Eq(mapping[0].m_segmentId));
+}
+
+TEST_F(SegmentManager_test, addingTwoSegmentsWithSameWriterGroupAndNumaNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e89400e-492a-47f2-ad16-347bce1b4ca0");
+
+    SegmentMemoryOptions memoryOptionsNode1;
+    memoryOptionsNode1.numaNode.emplace(1U);
+    SegmentConfig segmentConfig;
+    segmentConfig.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test2", mepooConfig});
+    segmentConfig.m_sharedMemorySegments.push_back(
+        {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryOptionsNode1});
+    segmentConfig.m_sharedMemorySegments.push_back(
+        {"iox_roudi_test3", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryOptionsNode1});
+
+    IOX_EXPECT_FATAL_FAILURE(
+        [&] { SegmentManager<MePooSegmentMock> sut(segmentConfig, DEFAULT_DOMAIN_ID, &allocator); },
+        iox::PoshError::MEPOO__SEGMENT_WITH_DUPLICATE_WRITER_GROUP_AND_NUMA_NODE);
+}
+
 } // namespace
@@ -20,6 +20,9 @@
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "test.hpp"
 
+#include <limits>
+#include <string>
+
 namespace
 {
 using namespace ::testing;
@@ -452,5 +455,70 @@ TEST_F(IpcMessage_test, setMessage)
     EXPECT_THAT(message1.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, AddEntryWithIntegersStoresTheirDecimalRepresentation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ac3ed130-db47-4616-ae5b-1aa95c0318fa");
+    IpcMessage message;
+
+    message.addEntry(std::numeric_limits<uint64_t>::max());
+    message.addEntry(std::numeric_limits<int64_t>::min());
+    message.addEntry(static_cast<uint16_t>(0U));
+
+    EXPECT_THAT(message.isValid(), Eq(true));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(3U));
+    EXPECT_THAT(message.getMessage(), Eq("18446744073709551615,-9223372036854775808,0,"));
+}
+
+TEST_F(IpcMessage_test, AddEntryExceedingMaxMessageSizeInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ceb20428-c7cf-41d3-a18d-1e7eadc5452c");
+    IpcMessage message({"first"});
+    const std::string tooLongEntry(IpcMessage::MAX_MESSAGE_SIZE, 'x');
+
+    message.addEntry(tooLongEntry);
+
+    EXPECT_THAT(message.isValid(), Eq(false));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(1U));
+    EXPECT_THAT(message.getMessage(), Eq("first,"));
+}
+
+TEST_F(IpcMessage_test, SetMessageExceedingMaxMessageSizeInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89496af5-4802-478d-ae6b-95e216a37ced");
+    IpcMessage message;
+    std::string tooLongMessage(IpcMessage::MAX_MESSAGE_SIZE, 'x');
+    tooLongMessage.push_back(',');
+
+    message.setMessage(tooLongMessage);
+
+    EXPECT_THAT(message.isValid(), Eq(false));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(0U));
+}
+
+TEST_F(IpcMessage_test, GetIntegerAtIndexConvertsNumericEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcdab801-e4f7-4419-ae53-c0836bf91953");
+    IpcMessage message({"42", "-13", "abc", "12x", "70000"});
+
+    EXPECT_THAT(message.getIntegerAtIndex<uint32_t>(0U).value_or(0U), Eq(42U));
+    EXPECT_THAT(message.getIntegerAtIndex<int64_t>(1U).value_or(0), Eq(-13));
+    EXPECT_THAT(message.getIntegerAtIndex<uint32_t>(1U).has_value(), Eq(false));
+    EXPECT_THAT(message.getIntegerAtIndex<uint32_t>(2U).has_value(), Eq(false));
+    EXPECT_THAT(message.getIntegerAtIndex<uint32_t>(3U).has_value(), Eq(false));
+    EXPECT_THAT(message.getIntegerAtIndex<uint16_t>(4U).has_value(), Eq(false));
+    EXPECT_THAT(message.getIntegerAtIndex<uint32_t>(5U).has_value(), Eq(false));
+}
+
+TEST_F(IpcMessage_test, GetStringAtIndexCopiesEntryIntoFixedSizeString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65f3466e-fd91-4962-93ed-476570395bc9");
+    IpcMessage message({"fuu", "", "barbaz"});
+
+    EXPECT_THAT(message.getStringAtIndex<10U>(0U), Eq(iox::string<10U>("fuu")));
+    EXPECT_THAT(message.getStringAtIndex<10U>(1U).empty(), Eq(true));
+    EXPECT_THAT(message.getStringAtIndex<3U>(2U), Eq(iox::string<3U>("bar")));
+    EXPECT_THAT(message.getStringAtIndex<10U>(3U).empty(), Eq(true));
+}
+
 } // namespace
 #endif
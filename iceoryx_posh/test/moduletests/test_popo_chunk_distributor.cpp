@@ -35,6 +35,8 @@
 #include "test.hpp"
 
 #include <memory>
+#include <sys/wait.h>
+#include <unistd.h>
 
 namespace
 {
@@ -695,6 +697,35 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithExactAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddAfterTheHistoryWrappedAround)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f19b8492-c635-4ff1-b4a0-5d6649e32964");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const auto historyCapacity = sut.getHistoryCapacity();
+    constexpr uint64_t NUMBER_OF_REPLACED_CHUNKS{2U};
+    for (uint64_t i = 1U; i <= historyCapacity + NUMBER_OF_REPLACED_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(historyCapacity));
+
+    // the oldest chunks were replaced and the remaining ones must be delivered in the order oldest to newest
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), historyCapacity).has_error());
+
+    EXPECT_THAT(queue.size(), Eq(historyCapacity));
+    for (uint64_t i = NUMBER_OF_REPLACED_CHUNKS + 1U; i <= historyCapacity + NUMBER_OF_REPLACED_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "64f48f9a-f100-4944-a855-24317a36a97e");
@@ -822,4 +853,242 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, BlockedDeliverySleepsUntilTheConsumerPopsAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1bcfd627-41f4-482b-af88-9825840e461a");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(8813U));
+
+    iox::concurrent::Atomic<bool> wasChunkDelivered{false};
+    std::thread t1([&] {
+        sut.deliverToAllStoredQueues(this->allocateChunk(8814U));
+        wasChunkDelivered = true;
+    });
+
+    // the blocked producer registers itself at the queue before it sleeps on the semaphore
+    while (queueData->m_numberOfWaitingProducers.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(8813U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queueData->m_numberOfWaitingProducers.load(), Eq(0U));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(8814U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryDoesNotWaitForThePostOfATerminatedConsumer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d979648-ba50-45f6-8652-f9c05bdf32eb");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(3301U));
+
+    std::thread t1([&] { sut.deliverToAllStoredQueues(this->allocateChunk(3302U)); });
+
+    // a consumer claims the registration of the blocked producer and is terminated before it posts the semaphore
+    bool isRegistrationClaimed{false};
+    while (!isRegistrationClaimed)
+    {
+        auto numberOfWaitingProducers = queueData->m_numberOfWaitingProducers.load();
+        isRegistrationClaimed = numberOfWaitingProducers > 0U
+                                && queueData->m_numberOfWaitingProducers.compare_exchange_strong(
+                                    numberOfWaitingProducers, numberOfWaitingProducers - 1U);
+        std::this_thread::yield();
+    }
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3301U));
+
+    t1.join();
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3302U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliveryWithoutHistoryIsNotBlockedByLockedQueueModification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c2b9e71-6a0d-4f38-b5e2-91d7c3a0f6e8");
+    constexpr uint64_t NO_HISTORY{0U};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, NO_HISTORY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    // the lock is held by another thread like RouDi does while modifying the queues
+    Barrier isLocked(1U);
+    Barrier isDeliveryDone(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLocked.notify();
+        isDeliveryDone.wait();
+        sutData->unlock();
+    });
+
+    isLocked.wait();
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4451U)), Eq(1U));
+    isDeliveryDone.notify();
+    t1.join();
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4451U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliveryWithHistoryIsNotBlockedByLockedQueueModification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dc604d93-a454-4768-ab38-c62e122a189b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    // the lock is held by another thread like RouDi does while modifying the queues
+    Barrier isLocked(1U);
+    Barrier isDeliveryDone(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLocked.notify();
+        isDeliveryDone.wait();
+        sutData->unlock();
+    });
+
+    isLocked.wait();
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4452U)), Eq(1U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+    isDeliveryDone.notify();
+    t1.join();
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4452U));
+}
+
+TYPED_TEST(ChunkDistributor_test, TimingTest_QueueModificationWaitsOnlyOnceForAbortedDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e81f5d02-3b79-4c6a-a0d4-72e9b8c15f3d");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    // a sender which was terminated while delivering a chunk never finishes its delivery epoch
+    const auto terminatedProcessId = fork();
+    ASSERT_THAT(terminatedProcessId, Ge(0));
+    if (terminatedProcessId == 0)
+    {
+        _exit(0);
+    }
+    ASSERT_THAT(waitpid(terminatedProcessId, nullptr, 0), Eq(terminatedProcessId));
+    sutData->m_deliveringProcessId.store(static_cast<uint32_t>(terminatedProcessId));
+    sutData->m_deliveryEpoch.fetch_add(1U);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    auto firstModificationDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    auto secondModificationDuration = std::chrono::steady_clock::now() - start;
+
+    const auto gracePeriodTimeout =
+        std::chrono::milliseconds(TestFixture::ChunkDistributorData_t::DELIVERY_GRACE_PERIOD_TIMEOUT.toMilliseconds());
+    EXPECT_THAT(firstModificationDuration, Ge(gracePeriodTimeout));
+    EXPECT_THAT(secondModificationDuration, Lt(gracePeriodTimeout));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, TimingTest_QueueModificationWaitsForSlowDeliveryOfRunningProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee07c55f-9985-4303-b010-210bd3c77dcb");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    // a delivery of a running process which takes longer than the grace period
+    const auto slowDeliveryDuration =
+        std::chrono::milliseconds(TestFixture::ChunkDistributorData_t::DELIVERY_GRACE_PERIOD_TIMEOUT.toMilliseconds())
+        + std::chrono::milliseconds(500);
+    sutData->m_deliveringProcessId.store(static_cast<uint32_t>(getpid()));
+    sutData->m_deliveryEpoch.fetch_add(1U);
+    auto start = std::chrono::steady_clock::now();
+    std::thread slowDelivery([&] {
+        std::this_thread::sleep_for(slowDeliveryDuration);
+        sutData->m_deliveryEpoch.fetch_add(1U);
+    });
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    auto modificationDuration = std::chrono::steady_clock::now() - start;
+    slowDelivery.join();
+
+    EXPECT_THAT(modificationDuration, Ge(slowDeliveryDuration));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, TimingTest_QueueModificationStopsWaitingForStalledDeliveryOfRunningProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed82b3e9-dcb7-479c-b09d-e735d67674ad");
+    const auto stalledSenderTimeout =
+        std::chrono::milliseconds(TestFixture::ChunkDistributorData_t::STALLED_SENDER_TIMEOUT.toMilliseconds());
+    this->deadlockWatchdog.reset();
+    Watchdog stalledSenderWatchdog{TestFixture::ChunkDistributorData_t::STALLED_SENDER_TIMEOUT
+                                   + TestFixture::DEADLOCK_TIMEOUT};
+    stalledSenderWatchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    // a delivery of a running process which never finishes, e.g. since the process was stopped
+    sutData->m_deliveringProcessId.store(static_cast<uint32_t>(getpid()));
+    sutData->m_deliveryEpoch.fetch_add(1U);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    auto firstModificationDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    auto secondModificationDuration = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(firstModificationDuration, Ge(stalledSenderTimeout));
+    EXPECT_THAT(secondModificationDuration, Lt(stalledSenderTimeout));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+}
+
 } // namespace
@@ -161,6 +161,25 @@ TYPED_TEST(ChunkQueue_test, PopOneChunk)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, HighWaterMarkIsTheMaximumNumberOfQueuedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fce4488b-9f00-4a3c-a558-5434a8821982");
+    EXPECT_THAT(this->m_chunkData.m_highWaterMark.load(), Eq(0U));
+
+    for (auto i = 0U; i < 3U; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        this->m_pusher.push(chunk);
+    }
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(this->m_chunkData.m_highWaterMark.load(), Eq(3U));
+    EXPECT_THAT(this->m_chunkData.m_numberOfDiscardedChunks.load(), Eq(0U));
+}
+
 TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6cbc1535-aea1-4d85-ae0a-a20e4fce3032");
@@ -259,6 +278,76 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, ProducerSemaphoreIsOnlyCreatedForBlockingProducerPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f764dd6-b566-4ce7-95bb-10850681553f");
+    using ChunkQueueData_t = typename ChunkQueue_test<TypeParam>::ChunkQueueData_t;
+
+    ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+
+    EXPECT_THAT(this->m_chunkData.m_producerSemaphore.has_value(), Eq(false));
+    EXPECT_THAT(blockingChunkData.m_producerSemaphore.has_value(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PopWakesUpWaitingProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7dc35c5-8438-4ad6-8d39-6535f8b93e2f");
+    using ChunkQueueData_t = typename ChunkQueue_test<TypeParam>::ChunkQueueData_t;
+
+    ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&blockingChunkData};
+    pusher.push(this->allocateChunk());
+
+    blockingChunkData.m_numberOfWaitingProducers.fetch_add(1U);
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    auto waitState = blockingChunkData.m_producerSemaphore->tryWait();
+    ASSERT_FALSE(waitState.has_error());
+    EXPECT_THAT(waitState.value(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, MultiplePopsPostProducerSemaphoreOnlyOncePerWaitingProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36f9bb91-be53-411d-bdfb-bb48a258e511");
+    using ChunkQueueData_t = typename ChunkQueue_test<TypeParam>::ChunkQueueData_t;
+
+    ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&blockingChunkData};
+    pusher.push(this->allocateChunk());
+    pusher.push(this->allocateChunk());
+
+    blockingChunkData.m_numberOfWaitingProducers.fetch_add(1U);
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+    EXPECT_THAT(blockingChunkData.m_numberOfWaitingProducers.load(), Eq(0U));
+
+    auto waitState = blockingChunkData.m_producerSemaphore->tryWait();
+    ASSERT_FALSE(waitState.has_error());
+    EXPECT_THAT(waitState.value(), Eq(true));
+    waitState = blockingChunkData.m_producerSemaphore->tryWait();
+    ASSERT_FALSE(waitState.has_error());
+    EXPECT_THAT(waitState.value(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, PopDoesNotPostProducerSemaphoreWithoutWaitingProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "18ee6ea4-2c5d-420e-a5b8-55434c16f391");
+    using ChunkQueueData_t = typename ChunkQueue_test<TypeParam>::ChunkQueueData_t;
+
+    ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&blockingChunkData};
+    pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    auto waitState = blockingChunkData.m_producerSemaphore->tryWait();
+    ASSERT_FALSE(waitState.has_error());
+    EXPECT_THAT(waitState.value(), Eq(false));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -388,6 +477,22 @@ TYPED_TEST(ChunkQueueSoFi_test, PushFull)
 }
 
 
+TYPED_TEST(ChunkQueueSoFi_test, PushFullCountsDiscardedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "086634d2-8e2d-4a0c-af34-37d9351f2573");
+    constexpr uint64_t NUMBER_OF_DISCARDED_CHUNKS{2U};
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY + NUMBER_OF_DISCARDED_CHUNKS; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        this->m_pusher.push(chunk);
+    }
+
+    EXPECT_THAT(this->m_chunkData.m_numberOfDiscardedChunks.load(), Eq(NUMBER_OF_DISCARDED_CHUNKS));
+    EXPECT_THAT(this->m_chunkData.m_highWaterMark.load(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+
+    this->m_popper.clear();
+}
+
 TYPED_TEST(ChunkQueueSoFi_test, InitialNoLostChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "cf7298e9-fd5b-4b7e-8688-37580713050f");
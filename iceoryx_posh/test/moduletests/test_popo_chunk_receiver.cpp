@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -36,6 +37,7 @@
 namespace
 {
 using namespace ::testing;
+using iox::popo::UniquePortId;
 
 struct DummySample
 {
@@ -49,6 +51,8 @@ class ChunkReceiver_test : public Test
     {
         m_mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
         m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+        m_chunkSender.tryAddQueue(&m_chunkReceiverData).expect("Adding the queue");
+        m_stampingChunkSender.tryAddQueue(&m_chunkReceiverData).expect("Adding the queue");
     }
 
     ~ChunkReceiver_test()
@@ -72,6 +76,23 @@ class ChunkReceiver_test : public Test
         return m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
     }
 
+    template <typename ChunkSender>
+    void sendChunk(ChunkSender& chunkSender, const UniquePortId publisherId)
+    {
+        auto chunkHeader = chunkSender.tryAllocate(publisherId, sizeof(DummySample), alignof(DummySample), 0U, 1U)
+                               .expect("Allocating chunk");
+        chunkSender.send(chunkHeader);
+    }
+
+    void connectLatencyHistogram(const UniquePortId publisherId, const uint64_t connectionTimestamp)
+    {
+        ASSERT_THAT(m_chunkReceiverData.m_latencyConnections.connect(
+                        static_cast<uint64_t>(publisherId),
+                        connectionTimestamp,
+                        [&]() -> iox::popo::LatencyHistogram* { return m_latencyHistogram.get(); }),
+                    Eq(m_latencyHistogram.get()));
+    }
+
     static constexpr size_t MEGABYTE = 1 << 20;
     static constexpr size_t MEMORY_SIZE = 4 * MEGABYTE;
     std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
@@ -93,6 +114,23 @@ class ChunkReceiver_test : public Test
     iox::popo::ChunkReceiver<ChunkReceiverData_t> m_chunkReceiver{&m_chunkReceiverData};
 
     iox::popo::ChunkQueuePusher<ChunkReceiverData_t> m_chunkQueuePusher{&m_chunkReceiverData};
+
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    ChunkSenderData_t m_chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
+    ChunkSenderData_t m_stampingChunkSenderData{&m_memoryManager,
+                                                iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                0U,
+                                                iox::mepoo::MemoryInfo(),
+                                                0U,
+                                                true};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_stampingChunkSender{&m_stampingChunkSenderData};
+    std::unique_ptr<iox::popo::LatencyHistogram> m_latencyHistogram{new iox::popo::LatencyHistogram};
 };
 
 TEST_F(ChunkReceiver_test, getNoChunkFromEmptyQueue)
@@ -123,6 +161,66 @@ TEST_F(ChunkReceiver_test, getAndReleaseOneChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getChunkWithoutSendTimestampRecordsNoLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a8dec52-c044-4d70-b291-7b8469887791");
+    const UniquePortId publisherId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    connectLatencyHistogram(publisherId, 0U);
+    sendChunk(m_chunkSender, publisherId);
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_latencyHistogram->takeStatistics().numberOfSamples, Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, getChunkWithSendTimestampRecordsLatencyOfTheConnection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25925034-1eeb-4dd2-a809-a083e9813ad9");
+    const UniquePortId publisherId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    const auto connectionTimestamp = iox::mepoo::steadyClockTimestamp();
+    connectLatencyHistogram(publisherId, connectionTimestamp);
+    sendChunk(m_stampingChunkSender, publisherId);
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    const auto latencyUpperLimit = iox::mepoo::steadyClockTimestamp() - connectionTimestamp;
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    const auto statistics = m_latencyHistogram->takeStatistics();
+    EXPECT_THAT(statistics.numberOfSamples, Eq(1U));
+    EXPECT_THAT(statistics.maxInNanoseconds, Le(latencyUpperLimit));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, getChunkWhichWasSentBeforeTheConnectionRecordsNoLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "603fd22f-ae8d-4524-8df7-b532f8172d96");
+    const UniquePortId publisherId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    sendChunk(m_stampingChunkSender, publisherId);
+    // e.g. the history which is delivered when a subscriber joins late
+    connectLatencyHistogram(publisherId, iox::mepoo::steadyClockTimestamp() + 1U);
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_latencyHistogram->takeStatistics().numberOfSamples, Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, getChunkOfAnotherPublisherRecordsNoLatencyInTheConnection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1629bbaa-8207-455a-bfae-9e2dd6c38f29");
+    connectLatencyHistogram(UniquePortId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID}, 0U);
+    sendChunk(m_stampingChunkSender, UniquePortId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID});
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_latencyHistogram->takeStatistics().numberOfSamples, Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
 TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "32bfe8a5-8d17-4912-9591-c4f29bdd390e");
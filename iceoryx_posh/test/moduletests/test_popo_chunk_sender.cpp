@@ -397,6 +397,56 @@ TEST_F(ChunkSender_test, sendOneWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendDoesNotStampTheSendTimeByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbc97184-bad5-4490-8171-2d4fef7c1c1d");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getSendTimestamp(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendStampsTheSendTimeWhenEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "54ec3a06-7518-4151-a30c-28ab06d63707");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      0U,
+                                      true};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                            sizeof(DummySample),
+                                            alignof(DummySample),
+                                            USER_HEADER_SIZE,
+                                            USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    const auto timeBeforeSend = iox::mepoo::steadyClockTimestamp();
+    sut.send(*maybeChunkHeader);
+    const auto timeAfterSend = iox::mepoo::steadyClockTimestamp();
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getSendTimestamp(), Ge(timeBeforeSend));
+    EXPECT_THAT(popRet->getSendTimestamp(), Le(timeAfterSend));
+
+    sut.releaseAll();
+}
+
 TEST_F(ChunkSender_test, sendMultipleWithReceiver)
 {
     ::testing::Test::RecordProperty("TEST_ID", "07e6a360-f5ae-4cd9-9bee-54b3c31c3390");
@@ -805,6 +855,30 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, ReleaseAllReturnsChunksOfChunkCacheToMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4a7c3d2-91b6-4e05-8f1a-3d6b0c2e7a95");
+    constexpr uint32_t CHUNK_CACHE_SIZE{4U};
+    ChunkSenderData_t chunkSenderDataWithCache{&m_memoryManager,
+                                               iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                               0U,
+                                               iox::mepoo::MemoryInfo(),
+                                               CHUNK_CACHE_SIZE};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderDataWithCache};
+
+    auto maybeChunkHeader = sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                            SMALL_CHUNK,
+                                            USER_PAYLOAD_ALIGNMENT,
+                                            USER_HEADER_SIZE,
+                                            USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_CACHE_SIZE));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
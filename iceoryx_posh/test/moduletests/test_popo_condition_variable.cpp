@@ -25,9 +25,11 @@
 #include "iox/atomic.hpp"
 #include "test.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -135,9 +137,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (auto& notificationWord : sut.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notificationWord.load(), Eq(0U));
     }
 }
 
@@ -150,9 +152,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (auto& notificationWord : m_condVarData.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notificationWord.load(), Eq(0U));
     }
 }
 
@@ -166,11 +168,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -233,6 +235,40 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
     }
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAroundNotificationWordBoundaries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98e1ae19-549c-43bc-938c-1d7ee0132820");
+    constexpr uint64_t BITS_PER_WORD = ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    ConditionListener sut(m_condVarData);
+    std::vector<uint64_t> expectedIndices;
+    for (uint64_t i : {uint64_t{0U}, BITS_PER_WORD - 1U, BITS_PER_WORD, BITS_PER_WORD + 1U, 3U * BITS_PER_WORD - 1U})
+    {
+        if (i < iox::MAX_NUMBER_OF_NOTIFIERS)
+        {
+            expectedIndices.emplace_back(i);
+        }
+    }
+    expectedIndices.emplace_back(iox::MAX_NUMBER_OF_NOTIFIERS - 1U);
+    expectedIndices.erase(std::unique(expectedIndices.begin(), expectedIndices.end()), expectedIndices.end());
+
+    for (auto i = expectedIndices.rbegin(); i != expectedIndices.rend(); ++i)
+    {
+        ConditionNotifier(m_condVarData, *i).notify();
+    }
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(expectedIndices.size()));
+    for (uint64_t i = 0U; i < expectedIndices.size(); ++i)
+    {
+        EXPECT_THAT(indices[i], Eq(expectedIndices[i]));
+    }
+    for (const auto& notificationWord : m_condVarData.m_activeNotifications)
+    {
+        EXPECT_THAT(notificationWord.load(), Eq(0U));
+    }
+}
+
 TIMING_TEST_F(ConditionVariable_test, TimedWaitBlocksUntilTimeout, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "c755aec9-43c3-4bf4-bec4-5672c76561ef");
     ConditionListener listener(m_condVarData);
@@ -420,9 +456,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (const auto& notificationWord : m_condVarData.m_activeNotifications)
         {
-            EXPECT_THAT(notification.load(), Eq(false));
+            EXPECT_THAT(notificationWord.load(), Eq(0U));
         }
     });
 
@@ -494,4 +530,64 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, SpinningListenerIsNotifiedWithoutSemaphorePost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5dc698e4-b965-4e25-b414-2e64c906001f");
+    constexpr uint64_t NOTIFICATION_INDEX{7U};
+    ConditionListener sut{m_condVarData, m_timeToWait};
+    ConditionNotifier notifier{m_condVarData, NOTIFICATION_INDEX};
+
+    std::thread t([&] {
+        while (!m_condVarData.m_isListenerSpinning.load())
+        {
+            std::this_thread::yield();
+        }
+        notifier.notify();
+    });
+
+    auto notifications = sut.wait();
+    t.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(NOTIFICATION_INDEX));
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, SpinningListenerFallsBackToSleepWhenSpinDurationExpired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4f16d84-5ee8-4547-aa3d-7ab388d11f62");
+    ConditionListener sut{m_condVarData, 1_ms};
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> hasWaited{false};
+
+    std::thread t([&] {
+        isThreadStarted.notify();
+        auto notifications = sut.wait();
+        hasWaited = true;
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_THAT(notifications[0], Eq(0U));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    EXPECT_FALSE(hasWaited.load());
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+
+    m_signaler.notify();
+    t.join();
+    EXPECT_TRUE(hasWaited.load());
+}
+
+TEST_F(ConditionVariable_test, SpinningTimedWaitReturnsEmptyListAfterTimeToWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d712999-8f8d-47c4-a4b9-564623cd769f");
+    ConditionListener sut{m_condVarData, m_timeToWait};
+
+    auto notifications = sut.timedWait(1_ms);
+
+    EXPECT_TRUE(notifications.empty());
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+}
+
 } // namespace
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_queue.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DiscoveryQueue_test : public Test
+{
+  public:
+    // the queue is too large for the stack
+    std::unique_ptr<DiscoveryQueue> m_sut{new DiscoveryQueue()};
+    ConditionListener m_listener{m_sut->conditionVariableData()};
+};
+
+TEST_F(DiscoveryQueue_test, PushedEntryCanBePoppedAndNotifiesListener)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "316c7f23-05a8-4ef9-bac1-0a6f35f852f2");
+    EXPECT_TRUE(m_sut->push({DiscoveryPortType::SUBSCRIBER, 42U}));
+
+    const auto notifications = m_listener.timedWait(1_ms);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(DiscoveryQueue::PORT_CHANGE_NOTIFICATION_INDEX));
+
+    const auto entry = m_sut->pop();
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_THAT(entry->portType, Eq(DiscoveryPortType::SUBSCRIBER));
+    EXPECT_THAT(entry->index, Eq(42U));
+    EXPECT_FALSE(m_sut->pop().has_value());
+}
+
+TEST_F(DiscoveryQueue_test, FullQueueRequestsFullDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e336a57-895c-4299-9168-66915900334f");
+    for (uint64_t i = 0U; i < DiscoveryQueue::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut->push({DiscoveryPortType::PUBLISHER, i}));
+    }
+    EXPECT_FALSE(m_sut->takeFullDiscoveryRequest());
+
+    EXPECT_FALSE(m_sut->push({DiscoveryPortType::PUBLISHER, DiscoveryQueue::CAPACITY}));
+
+    EXPECT_TRUE(m_sut->takeFullDiscoveryRequest());
+}
+
+TEST_F(DiscoveryQueue_test, TakingFullDiscoveryRequestResetsRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db49ad47-fc1b-4f20-abd9-69992aa42c20");
+    m_sut->requestFullDiscovery();
+
+    EXPECT_TRUE(m_sut->takeFullDiscoveryRequest());
+    EXPECT_FALSE(m_sut->takeFullDiscoveryRequest());
+}
+
+TEST_F(DiscoveryQueue_test, NotifierQueuesDataOnlyOnceUntilReset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "384465c9-3438-43f3-b5be-708d62cf34cd");
+    DiscoveryNotifier sut;
+    sut.init(*m_sut, DiscoveryPortType::CLIENT, 13U);
+
+    sut.notify();
+    sut.notify();
+
+    auto entry = m_sut->pop();
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_THAT(entry->portType, Eq(DiscoveryPortType::CLIENT));
+    EXPECT_THAT(entry->index, Eq(13U));
+    EXPECT_FALSE(m_sut->pop().has_value());
+
+    sut.reset();
+    sut.notify();
+
+    entry = m_sut->pop();
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_THAT(entry->index, Eq(13U));
+}
+
+TEST_F(DiscoveryQueue_test, NotifierWithoutQueueDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2bf6ed16-42cd-4085-a40e-cf6f152dc6aa");
+    DiscoveryNotifier sut;
+
+    sut.notify();
+
+    EXPECT_FALSE(m_listener.wasNotified());
+    EXPECT_FALSE(m_sut->pop().has_value());
+}
+
+TEST_F(DiscoveryQueue_test, DetachedNotifierDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d699be9-ab6d-4fdd-ac8b-562b90e8d27d");
+    DiscoveryNotifier sut;
+    sut.init(*m_sut, DiscoveryPortType::PUBLISHER, 7U);
+
+    sut.detach();
+    sut.notify();
+
+    EXPECT_FALSE(m_listener.wasNotified());
+    EXPECT_FALSE(m_sut->pop().has_value());
+}
+
+} // namespace
@@ -0,0 +1,221 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::popo::LatencyConnections;
+using iox::popo::LatencyHistogram;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    std::unique_ptr<LatencyHistogram> sut{new LatencyHistogram};
+};
+
+TEST_F(LatencyHistogram_test, InitiallyEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65f0aabf-9da5-4a19-891d-e49409794d00");
+    const auto statistics = sut->takeStatistics();
+    EXPECT_THAT(statistics.numberOfSamples, Eq(0U));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(0U));
+    EXPECT_THAT(statistics.p50InNanoseconds, Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, SmallLatenciesAreCountedExactly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "481835fd-d1ef-4190-b320-84340a67750d");
+    for (uint64_t latency = 0U; latency < 2U * LatencyHistogram::NUMBER_OF_SUB_BUCKETS; ++latency)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(latency), Eq(latency));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(latency), Eq(latency));
+    }
+}
+
+TEST_F(LatencyHistogram_test, EveryLatencyIsInTheRangeOfItsBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b680772-16dd-4fa2-a3c7-f704453373fb");
+    for (uint64_t latency = 1U; latency < (uint64_t{1U} << (LatencyHistogram::MAX_EXPONENT + 1U)); latency *= 3U)
+    {
+        const auto index = LatencyHistogram::bucketIndex(latency);
+        ASSERT_THAT(index, Lt(LatencyHistogram::NUMBER_OF_BUCKETS));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(index), Ge(latency));
+        if (index > 0U)
+        {
+            EXPECT_THAT(LatencyHistogram::bucketUpperBound(index - 1U), Lt(latency));
+        }
+        // the relative error is limited by the number of sub-buckets
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(index) - latency,
+                    Le(latency / LatencyHistogram::NUMBER_OF_SUB_BUCKETS));
+    }
+}
+
+TEST_F(LatencyHistogram_test, LatenciesBeyondTheRangeAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dfb2e681-8289-4c98-8f3d-58f5b8f7b8ca");
+    constexpr uint64_t LARGE_LATENCY{std::numeric_limits<uint64_t>::max()};
+    EXPECT_THAT(LatencyHistogram::bucketIndex(LARGE_LATENCY), Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+
+    sut->record(LARGE_LATENCY);
+
+    const auto statistics = sut->takeStatistics();
+    EXPECT_THAT(statistics.numberOfSamples, Eq(1U));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(LARGE_LATENCY));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreEstimatedWithinTheBucketResolution)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "76498201-29c4-4c0f-a2b1-0b4d858e50d5");
+    constexpr uint64_t NUMBER_OF_SAMPLES{10000U};
+    for (uint64_t latency = 1U; latency <= NUMBER_OF_SAMPLES; ++latency)
+    {
+        sut->record(latency * 1000U);
+    }
+
+    const auto statistics = sut->takeStatistics();
+    EXPECT_THAT(statistics.numberOfSamples, Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(NUMBER_OF_SAMPLES * 1000U));
+
+    auto expectPercentileNear = [&](const uint64_t estimate, const uint64_t expected) {
+        EXPECT_THAT(estimate, Ge(expected));
+        EXPECT_THAT(estimate, Le(expected + expected / LatencyHistogram::NUMBER_OF_SUB_BUCKETS));
+    };
+    expectPercentileNear(statistics.p50InNanoseconds, 5000000U);
+    expectPercentileNear(statistics.p99InNanoseconds, 9900000U);
+    expectPercentileNear(statistics.p999InNanoseconds, 9990000U);
+}
+
+TEST_F(LatencyHistogram_test, PercentilesOfASingleSampleAreLimitedByTheMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26a31916-304d-4d83-9c47-84ffb9a91351");
+    constexpr uint64_t LATENCY{12345U};
+    sut->record(LATENCY);
+
+    const auto statistics = sut->takeStatistics();
+    EXPECT_THAT(statistics.p50InNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(statistics.p99InNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(statistics.p999InNanoseconds, Eq(LATENCY));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(LATENCY));
+}
+
+TEST_F(LatencyHistogram_test, StatisticsContainOnlyTheLatenciesSinceTheyWereTakenTheLastTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96eeb17e-982f-4b1e-ba6b-a9824e252747");
+    sut->record(1000000U);
+    sut->takeStatistics();
+    sut->record(100U);
+    sut->record(200U);
+
+    const auto statistics = sut->takeStatistics();
+    EXPECT_THAT(statistics.numberOfSamples, Eq(2U));
+    EXPECT_THAT(statistics.maxInNanoseconds, Eq(200U));
+    EXPECT_THAT(sut->takeStatistics().numberOfSamples, Eq(0U));
+}
+
+class LatencyConnections_test : public Test
+{
+  public:
+    LatencyHistogram* acquireHistogram()
+    {
+        if (numberOfAcquiredHistograms == NUMBER_OF_HISTOGRAMS)
+        {
+            return nullptr;
+        }
+        return &histograms[numberOfAcquiredHistograms++];
+    }
+
+    static constexpr uint32_t NUMBER_OF_HISTOGRAMS{LatencyConnections::CAPACITY + 1U};
+    std::unique_ptr<LatencyHistogram[]> histograms{new LatencyHistogram[NUMBER_OF_HISTOGRAMS]};
+    uint32_t numberOfAcquiredHistograms{0U};
+    std::unique_ptr<LatencyConnections> sut{new LatencyConnections};
+    std::function<LatencyHistogram*()> acquire{[this] { return acquireHistogram(); }};
+};
+
+TEST_F(LatencyConnections_test, LatenciesAreRecordedPerPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3637790-467d-4f11-925f-f949397bba43");
+    auto* histogram1 = sut->connect(1U, 0U, acquire);
+    auto* histogram2 = sut->connect(2U, 0U, acquire);
+    ASSERT_THAT(histogram1, Ne(nullptr));
+    ASSERT_THAT(histogram2, Ne(histogram1));
+
+    sut->record(1U, 100U, 150U);
+    sut->record(2U, 100U, 300U);
+    sut->record(2U, 100U, 400U);
+    sut->record(3U, 100U, 500U);
+
+    EXPECT_THAT(histogram1->takeStatistics().maxInNanoseconds, Eq(50U));
+    const auto statistics2 = histogram2->takeStatistics();
+    EXPECT_THAT(statistics2.numberOfSamples, Eq(2U));
+    EXPECT_THAT(statistics2.maxInNanoseconds, Eq(300U));
+}
+
+TEST_F(LatencyConnections_test, SamplesSentBeforeTheConnectionAreNotRecorded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fb3672bd-edad-43fb-95cf-4b2c331dd03c");
+    auto* histogram = sut->connect(1U, 1000U, acquire);
+    ASSERT_THAT(histogram, Ne(nullptr));
+
+    sut->record(1U, 999U, 2000U);
+    sut->record(1U, 1000U, 2000U);
+
+    EXPECT_THAT(histogram->takeStatistics().numberOfSamples, Eq(1U));
+
+    // a reconnect restarts the measurement without a new histogram
+    EXPECT_THAT(sut->connect(1U, 3000U, acquire), Eq(nullptr));
+    sut->record(1U, 2000U, 4000U);
+    EXPECT_THAT(histogram->takeStatistics().numberOfSamples, Eq(0U));
+    EXPECT_THAT(numberOfAcquiredHistograms, Eq(1U));
+}
+
+TEST_F(LatencyConnections_test, HistogramOfADisconnectedPublisherIsReusedForTheNextConnection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44d92f35-2b92-4359-9d33-0da03fbe86d0");
+    auto* histogram = sut->connect(1U, 0U, acquire);
+    sut->record(1U, 100U, 200U);
+    EXPECT_THAT(sut->disconnect(1U), Eq(histogram));
+    EXPECT_THAT(sut->disconnect(1U), Eq(nullptr));
+
+    EXPECT_THAT(sut->connect(2U, 0U, acquire), Eq(histogram));
+    EXPECT_THAT(numberOfAcquiredHistograms, Eq(1U));
+    // the latencies of the previous publisher are discarded
+    EXPECT_THAT(histogram->takeStatistics().numberOfSamples, Eq(0U));
+}
+
+TEST_F(LatencyConnections_test, ConnectionsBeyondTheCapacityAreNotMeasured)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23d4a24e-abc3-4dab-8e4c-6b759738aa93");
+    for (uint64_t publisherId = 1U; publisherId <= LatencyConnections::CAPACITY; ++publisherId)
+    {
+        EXPECT_THAT(sut->connect(publisherId, 0U, acquire), Ne(nullptr));
+    }
+    EXPECT_THAT(sut->connect(LatencyConnections::CAPACITY + 1U, 0U, acquire), Eq(nullptr));
+
+    std::vector<LatencyHistogram*> releasedHistograms;
+    sut->releaseHistograms([&](auto& histogram) { releasedHistograms.push_back(&histogram); });
+    EXPECT_THAT(releasedHistograms.size(), Eq(LatencyConnections::CAPACITY));
+    sut->record(1U, 100U, 200U);
+}
+
+} // namespace
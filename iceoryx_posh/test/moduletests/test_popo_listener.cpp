@@ -137,6 +137,11 @@ class TestListener : public Listener
         : Listener(data)
     {
     }
+
+    TestListener(ConditionVariableData& data, const ListenerOptions& options) noexcept
+        : Listener(data, options)
+    {
+    }
 };
 
 struct EventAndSutPair_t
@@ -173,6 +178,27 @@ class Listener_test : public Test
         std::this_thread::sleep_for(std::chrono::milliseconds(g_triggerCallbackRuntimeInMs));
     }
 
+    struct CallbackConcurrency
+    {
+        iox::concurrent::Atomic<uint64_t> numberOfExecutions{0U};
+        iox::concurrent::Atomic<uint64_t> numberOfActiveExecutions{0U};
+        iox::concurrent::Atomic<uint64_t> maxNumberOfActiveExecutions{0U};
+    };
+
+    static void countingCallback(SimpleEventClass* const, CallbackConcurrency* concurrency) noexcept
+    {
+        const auto activeExecutions = ++concurrency->numberOfActiveExecutions;
+        auto maxActiveExecutions = concurrency->maxNumberOfActiveExecutions.load();
+        while (activeExecutions > maxActiveExecutions
+               && !concurrency->maxNumberOfActiveExecutions.compare_exchange_weak(maxActiveExecutions,
+                                                                                  activeExecutions))
+        {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        --concurrency->numberOfActiveExecutions;
+        ++concurrency->numberOfExecutions;
+    }
+
     static void triggerCallbackWithUserType(SimpleEventClass* const event, uint64_t* userType) noexcept
     {
         g_triggerCallbackArg[0].m_source = event;
@@ -668,6 +694,25 @@ TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotify, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
 })
 
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyWhenListenerSpins, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "5a30fd51-3aeb-498f-9640-4a4ece147a70");
+    ListenerOptions options;
+    options.spinDuration = 1_s;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+})
+
 TIMING_TEST_F(Listener_test, CallbackWithEventAndUserTypeIsCalledAfterNotify, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "6df97139-8c2e-42b1-bd9a-8770c295bf2e");
     m_sut.emplace(m_condVarData);
@@ -1237,4 +1282,102 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN worker threads
+//////////////////////////////////
+TEST_F(Listener_test, SlowCallbackDoesNotDelayOtherEventsWithWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae5b1cb5-e182-4dca-9e6b-947cc1846181");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+    activateTriggerCallbackBlocker();
+
+    SimpleEventClass slowEvent;
+    SimpleEventClass fastEvent;
+    CallbackConcurrency fastConcurrency;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(slowEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fastEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::countingCallback, fastConcurrency))
+                     .has_error());
+
+    slowEvent.triggerStoepsel();
+    while (g_triggerCallbackArg[0U].m_count.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    // the watchdog terminates the test when the fast callback waits for the blocked slow callback
+    fastEvent.triggerStoepsel();
+    while (fastConcurrency.numberOfExecutions.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+    unblockTriggerCallback(1U);
+}
+
+TEST_F(Listener_test, CallbacksOfTheSameEventAreNotExecutedConcurrentlyWithWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c67b9d4d-8624-49d9-a5f7-6987d19cd075");
+    constexpr uint64_t NUMBER_OF_TRIGGERS{100U};
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 4U;
+    m_sut.emplace(m_condVarData, options);
+
+    SimpleEventClass event;
+    CallbackConcurrency concurrency;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(event,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::countingCallback, concurrency))
+                     .has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_TRIGGERS; ++i)
+    {
+        event.triggerStoepsel();
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    m_sut.reset();
+
+    EXPECT_THAT(concurrency.numberOfExecutions.load(), Ge(1U));
+    EXPECT_THAT(concurrency.numberOfExecutions.load(), Le(NUMBER_OF_TRIGGERS));
+    EXPECT_THAT(concurrency.maxNumberOfActiveExecutions.load(), Eq(1U));
+}
+
+TEST_F(Listener_test, CallbackIsExecutedByWorkerThreadWithCpuAffinity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7dd9813-5573-4108-a5df-ea2efa171baa");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 1U;
+    options.workerCpuAffinity.emplace_back(0U);
+    m_sut.emplace(m_condVarData, options);
+
+    SimpleEventClass event;
+    CallbackConcurrency concurrency;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(event,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::countingCallback, concurrency))
+                     .has_error());
+
+    event.triggerStoepsel();
+    while (concurrency.numberOfExecutions.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_THAT(concurrency.numberOfExecutions.load(), Eq(1U));
+}
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
@@ -32,6 +32,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.chunkCacheSize = 4;
+    testOptions.numaNode = 1;
+    testOptions.measureLatency = true;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +49,15 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.chunkCacheSize, Ne(defaultOptions.chunkCacheSize));
+            EXPECT_THAT(roundTripOptions.chunkCacheSize, Eq(testOptions.chunkCacheSize));
+
+            EXPECT_THAT(roundTripOptions.numaNode, Ne(defaultOptions.numaNode));
+            EXPECT_THAT(roundTripOptions.numaNode, Eq(testOptions.numaNode));
+
+            EXPECT_THAT(roundTripOptions.measureLatency, Ne(defaultOptions.measureLatency));
+            EXPECT_THAT(roundTripOptions.measureLatency, Eq(testOptions.measureLatency));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
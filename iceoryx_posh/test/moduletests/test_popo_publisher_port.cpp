@@ -339,6 +339,44 @@ TEST_F(PublisherPort_test, allocateAndSendMultipleChunksWithoutSubscriberHoldsOn
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(PublisherPort_test, sendingChunksAndFailingToAllocateChunksIsCountedInTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35d9bcc4-f866-4463-b10b-561829356621");
+    const auto& statistics = m_publisherPortDataNoOfferOnCreate.m_statistics;
+    m_sutNoOfferOnCreateUserSide.offer();
+    uint64_t lastChunkSize{0U};
+    for (uint64_t userPayloadSize : {10U, 20U})
+    {
+        auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+            userPayloadSize, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        lastChunkSize = maybeChunkHeader.value()->chunkSize();
+        m_sutNoOfferOnCreateUserSide.sendChunk(maybeChunkHeader.value());
+    }
+    auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+        2U * BIG_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(statistics.m_numberOfSentSamples.load(), Eq(2U));
+    EXPECT_THAT(statistics.m_numberOfSentBytes.load(), Eq(30U));
+    EXPECT_THAT(statistics.m_numberOfLoanFailures.load(), Eq(1U));
+    EXPECT_THAT(statistics.m_lastChunkSize.load(), Eq(lastChunkSize));
+}
+
+TEST_F(PublisherPort_test, sendingChunksWhenNotOfferedIsNotCountedInTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "466fd8d5-8bbd-4c1b-8b0e-3ec0638d592d");
+    const auto& statistics = m_publisherPortDataNoOfferOnCreate.m_statistics;
+    auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+        10U, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_sutNoOfferOnCreateUserSide.sendChunk(maybeChunkHeader.value());
+
+    EXPECT_THAT(statistics.m_numberOfSentSamples.load(), Eq(0U));
+    EXPECT_THAT(statistics.m_numberOfSentBytes.load(), Eq(0U));
+}
+
 TEST_F(PublisherPort_test, subscribeWhenNotOfferedReturnsNACK)
 {
     ::testing::Test::RecordProperty("TEST_ID", "71148938-58f1-4189-8461-8bab912e32c6");
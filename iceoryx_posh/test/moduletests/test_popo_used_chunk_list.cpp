@@ -231,6 +231,41 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, FullUsedChunkListCanBeRefilledAfterRemovalInScrambledOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a6d9d7e-4c1b-4b8e-9f5e-3d2a7c8b1e64");
+    constexpr uint32_t NUMBER_OF_ROUNDS{3U};
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        std::vector<ChunkHeader*> chunkHeaderInUse;
+        createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+            chunkHeaderInUse.push_back(chunk.getChunkHeader());
+            EXPECT_TRUE(sut.insert(chunk));
+        });
+
+        // remove every third chunk first and then the remaining ones from the back to shuffle the occupied slots
+        for (uint32_t i = round; i < USED_CHUNK_LIST_CAPACITY; i += 3U)
+        {
+            SharedChunk removedChunk;
+            EXPECT_TRUE(sut.remove(chunkHeaderInUse[i], removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunkHeaderInUse[i]));
+            chunkHeaderInUse[i] = nullptr;
+        }
+        for (auto it = chunkHeaderInUse.rbegin(); it != chunkHeaderInUse.rend(); ++it)
+        {
+            if (*it == nullptr)
+            {
+                continue;
+            }
+            SharedChunk removedChunk;
+            EXPECT_TRUE(sut.remove(*it, removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(*it));
+        }
+    }
+
+    checkIfEmpty();
+}
+
 TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2c4a64d1-07cc-4334-89bf-dd58ad291af5");
@@ -270,6 +270,10 @@ class WaitSetTest : public iox::popo::WaitSet<>
         : WaitSet(condVarData)
     {
     }
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData, const iox::units::Duration spinDuration) noexcept
+        : WaitSet(condVarData, spinDuration)
+    {
+    }
 };
 
 enum class SimpleEvent1 : iox::popo::EventEnumIdentifier
@@ -1161,6 +1165,28 @@ TEST_F(WaitSet_test, WaitBlocksWhenNothingTriggered)
     t.join();
 }
 
+TEST_F(WaitSet_test, SpinningWaitReturnsWhenTriggeredWhileSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2056cbdb-5c94-489f-a91a-413d0ae0995e");
+    ConditionVariableData condVarData{"Spinnerle"};
+    WaitSetTest sut{condVarData, 2_s};
+    ASSERT_FALSE(sut.attachEvent(m_simpleEvents[0], 13U).has_error());
+
+    std::thread t([&] {
+        while (!condVarData.m_isListenerSpinning.load())
+        {
+            std::this_thread::yield();
+        }
+        m_simpleEvents[0].trigger();
+    });
+
+    auto triggerVector = sut.wait();
+    t.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(doesNotificationInfoVectorContain(triggerVector, 13U, m_simpleEvents[0]));
+}
+
 TEST_F(WaitSet_test, TimedWaitReturnsNothingWhenNothingTriggered)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bf1a8c00-e9c9-43e1-813e-64fd12d4e055");
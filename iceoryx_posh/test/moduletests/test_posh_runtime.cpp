@@ -356,6 +356,7 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
     internalServices.push_back(iox::roudi::IntrospectionProcessService);
+    internalServices.push_back(iox::roudi::IntrospectionProcessStatisticsService);
 
     for (auto& service : internalServices)
     {
@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/roudi/roudi_cmd_line_parser.hpp"
 
+#include <string>
+
 using namespace ::testing;
 
 using namespace iox::roudi;
@@ -39,6 +41,9 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
            && (lhs.roudiConfig.compatibilityCheckLevel == rhs.roudiConfig.compatibilityCheckLevel)
            && (lhs.roudiConfig.processTerminationDelay == rhs.roudiConfig.processTerminationDelay)
            && (lhs.roudiConfig.processKillDelay == rhs.roudiConfig.processKillDelay)
+           && (lhs.roudiConfig.introspectionInterval == rhs.roudiConfig.introspectionInterval)
+           && (lhs.roudiConfig.processStatisticsSamplesPerInterval
+               == rhs.roudiConfig.processStatisticsSamplesPerInterval)
            && (lhs.roudiConfig.domainId == rhs.roudiConfig.domainId)
            && (lhs.roudiConfig.uniqueRouDiId == rhs.roudiConfig.uniqueRouDiId) && (lhs.run == rhs.run)
            && (lhs.configFilePath == rhs.configFilePath);
@@ -350,6 +355,104 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, IntrospectionIntervalLongOptionLeadsToCorrectInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b35d632c-056b-47d1-a3e1-5d21d5e2fcc9");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--introspection-interval";
+    char value[] = "50";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.introspectionInterval, Duration::fromMilliseconds(50));
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, IntrospectionIntervalShortOptionAcceptsZeroToDisableThePublishing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9312f807-b699-453c-ae0d-88dbadd2c326");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-i";
+    char value[] = "0";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.introspectionInterval, Duration::fromMilliseconds(0));
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, IntrospectionIntervalOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b530a2ac-cdbd-4f15-842d-1dd6037db92c");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--introspection-interval";
+    char value[] = "4294967296"; // MAX_INTROSPECTION_INTERVAL + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
+TEST_F(CmdLineParser_test, ProcessStatisticsLongOptionLeadsToCorrectNumberOfSamples)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2093e775-82d2-4498-bd21-155775055a08");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--process-statistics";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.processStatisticsSamplesPerInterval, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, ProcessStatisticsOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee42607f-7e52-4fa1-9567-a002daea2f7d");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-p";
+    std::string value = std::to_string(iox::MAX_PROCESS_NUMBER + 1U);
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
 TEST_F(CmdLineParser_test, TerminationDelayLongOptionLeadsToCorrectDelay)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9125f775-93b6-4560-a535-f8ecf77671b5");
@@ -181,6 +181,37 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_ALLOCATION_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    allocation-policy = "worst-fit"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-node = 1
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+
+    [[segment]]
+    numa-node = 1
+
+    [[segment.mempool]]
+    size = 256
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +231,11 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_ALLOCATION_POLICY,
+                                 CONFIG_INVALID_ALLOCATION_POLICY},
+           ParseErrorInputFile_t{
+               iox::roudi::RouDiConfigFileParseError::DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE,
+               CONFIG_DUPLICATE_SEGMENT_FOR_WRITER_GROUP_AND_NUMA_NODE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -218,4 +254,47 @@ TEST_P(RoudiConfigTomlFileProvider_test, ParseMalformedInputFileCausesError)
     EXPECT_EQ(expectedErrorCode, result.error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseSegmentMemoryOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cebf388e-0b5d-4fad-bb88-3392ff9437f5");
+    std::istringstream stream(R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-pages = true
+    lock-memory = true
+    prefault = true
+    initialization-threads = 4
+    numa-node = 1
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 1024
+    count = 100
+)");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_TRUE(segments[0].m_memoryOptions.useHugePages);
+    EXPECT_TRUE(segments[0].m_memoryOptions.lockMemory);
+    EXPECT_TRUE(segments[0].m_memoryOptions.prefaultMemory);
+    EXPECT_THAT(segments[0].m_memoryOptions.initializationThreads, Eq(4U));
+    ASSERT_TRUE(segments[0].m_memoryOptions.numaNode.has_value());
+    EXPECT_THAT(segments[0].m_memoryOptions.numaNode.value(), Eq(1U));
+    EXPECT_FALSE(segments[1].m_memoryOptions.useHugePages);
+    EXPECT_FALSE(segments[1].m_memoryOptions.lockMemory);
+    EXPECT_FALSE(segments[1].m_memoryOptions.prefaultMemory);
+    EXPECT_THAT(segments[1].m_memoryOptions.initializationThreads, Eq(1U));
+    EXPECT_FALSE(segments[1].m_memoryOptions.numaNode.has_value());
+}
+
 } // namespace
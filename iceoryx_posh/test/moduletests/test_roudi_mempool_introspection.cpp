@@ -72,6 +72,21 @@ class SegmentMock
         return iox::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    uint64_t getPageSize() const
+    {
+        return 4096U;
+    }
+
+    iox::optional<uint32_t> getNumaNode() const
+    {
+        return iox::nullopt;
+    }
+
+    bool isBoundToNumaNode() const
+    {
+        return false;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
 };
@@ -135,6 +150,7 @@ class MemPoolIntrospection_test : public Test
         info.m_minFreeChunks = index * 100 + 45;
         info.m_numChunks = index * 100 + 50;
         info.m_usedChunks = index * 100 + 3;
+        info.m_spillAllocations = index * 100 + 7;
     }
 
     // initializes the mempool info with a defined pattern
@@ -171,6 +187,10 @@ class MemPoolIntrospection_test : public Test
             {
                 return false;
             }
+            if (info.m_spillAllocations != second[index].m_spillAllocations)
+            {
+                return false;
+            }
             index++;
         }
 
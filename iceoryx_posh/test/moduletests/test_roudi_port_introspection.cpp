@@ -35,6 +35,7 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData;
 
     void sendThroughputData()
     {
@@ -48,6 +49,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -438,6 +443,411 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsCountersOfPublisherAndSubscriberPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3fa7e55e-1a81-463e-91d3-6bdb4a132a2a");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, publisherOptions);
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(true));
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+    auto latencyHistogram = std::unique_ptr<iox::popo::LatencyHistogram>(new iox::popo::LatencyHistogram);
+    ASSERT_THAT(m_introspectionAccess.addLatencyConnection(
+                    subscriberPortData.m_uniqueId, publisherPortData.m_uniqueId, *latencyHistogram),
+                Eq(true));
+
+    publisherPortData.m_statistics.addSentSample(100U, 256U);
+    publisherPortData.m_statistics.addSentSample(200U, 384U);
+    publisherPortData.m_statistics.addLoanFailure();
+    subscriberPortData.m_statistics.addReceivedSample(100U);
+    subscriberPortData.m_chunkReceiverData.m_numberOfDiscardedChunks.store(3U);
+    subscriberPortData.m_chunkReceiverData.m_highWaterMark.store(7U);
+    latencyHistogram->record(5U);
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunk.get()->chunkHeader()))));
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunkWasSent, Eq(true));
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    const auto& publisherThroughput = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(publisherThroughput.m_publisherPortID, Eq(static_cast<uint64_t>(publisherPortData.m_uniqueId)));
+    EXPECT_THAT(publisherThroughput.m_numberOfSentSamples, Eq(2U));
+    EXPECT_THAT(publisherThroughput.m_numberOfSentBytes, Eq(300U));
+    EXPECT_THAT(publisherThroughput.m_numberOfLoanFailures, Eq(1U));
+    EXPECT_THAT(publisherThroughput.m_sampleSize, Eq(150U));
+    EXPECT_THAT(publisherThroughput.m_chunkSize, Eq(384U));
+    EXPECT_THAT(publisherThroughput.m_isField, Eq(true));
+    EXPECT_THAT(publisherThroughput.m_chunksPerMinute, Gt(0.0));
+    EXPECT_THAT(publisherThroughput.m_sentBytesPerSecond, Gt(0.0));
+    EXPECT_THAT(publisherThroughput.m_lastSendIntervalInNanoseconds, Gt(0U));
+
+    ASSERT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(1U));
+    const auto& subscriberThroughput = chunk->sample()->m_subscriberThroughputList[0];
+    EXPECT_THAT(subscriberThroughput.m_subscriberPortID, Eq(static_cast<uint64_t>(subscriberPortData.m_uniqueId)));
+    EXPECT_THAT(subscriberThroughput.m_numberOfReceivedSamples, Eq(1U));
+    EXPECT_THAT(subscriberThroughput.m_numberOfReceivedBytes, Eq(100U));
+    EXPECT_THAT(subscriberThroughput.m_receivedSamplesPerSecond, Gt(0.0));
+    EXPECT_THAT(subscriberThroughput.m_numberOfDiscardedSamples, Eq(3U));
+    EXPECT_THAT(subscriberThroughput.m_queueHighWaterMark, Eq(7U));
+    EXPECT_THAT(subscriberThroughput.m_queueCapacity, Eq(subscriberPortData.m_chunkReceiverData.m_queue.capacity()));
+
+    ASSERT_THAT(chunk->sample()->m_connectionLatencyList.size(), Eq(1U));
+    const auto& connectionLatency = chunk->sample()->m_connectionLatencyList[0];
+    EXPECT_THAT(connectionLatency.m_subscriberPortID, Eq(static_cast<uint64_t>(subscriberPortData.m_uniqueId)));
+    EXPECT_THAT(connectionLatency.m_publisherPortID, Eq(static_cast<uint64_t>(publisherPortData.m_uniqueId)));
+    EXPECT_THAT(connectionLatency.m_numberOfSamples, Eq(1U));
+    EXPECT_THAT(connectionLatency.m_p50InNanoseconds, Eq(5U));
+    EXPECT_THAT(connectionLatency.m_p99InNanoseconds, Eq(5U));
+    EXPECT_THAT(connectionLatency.m_p999InNanoseconds, Eq(5U));
+    EXPECT_THAT(connectionLatency.m_maxInNanoseconds, Eq(5U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataContainsOnlyTheLatenciesOfTheLastInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec67f02c-efe2-484a-93d1-ceecdd49fa78");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::popo::UniquePortId subscriberId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID);
+    const iox::popo::UniquePortId publisherId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID);
+    auto latencyHistogram = std::unique_ptr<iox::popo::LatencyHistogram>(new iox::popo::LatencyHistogram);
+    ASSERT_THAT(m_introspectionAccess.addLatencyConnection(subscriberId, publisherId, *latencyHistogram), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addLatencyConnection(subscriberId, publisherId, *latencyHistogram), Eq(false));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(3);
+
+    latencyHistogram->record(1000U);
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunk->sample()->m_connectionLatencyList.size(), Eq(1U));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    latencyHistogram->record(10U);
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunk->sample()->m_connectionLatencyList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_connectionLatencyList[0].m_numberOfSamples, Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_connectionLatencyList[0].m_maxInNanoseconds, Eq(10U));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    // connections without samples in the interval and removed connections are left out
+    EXPECT_THAT(m_introspectionAccess.removeLatencyConnection(*latencyHistogram), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.removeLatencyConnection(*latencyHistogram), Eq(false));
+    latencyHistogram->record(10U);
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_connectionLatencyList.size(), Eq(0U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataComputesRatesOnlyFromSamplesOfTheLastInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fb775165-3da2-43f8-a2a5-ba4abdfa64ef");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(2);
+
+    publisherPortData.m_statistics.addSentSample(42U, 128U);
+    m_introspectionAccess.sendThroughputData();
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    // a loan failure is a change without sent samples
+    publisherPortData.m_statistics.addLoanFailure();
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    const auto& publisherThroughput = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(publisherThroughput.m_numberOfSentSamples, Eq(1U));
+    EXPECT_THAT(publisherThroughput.m_numberOfLoanFailures, Eq(1U));
+    EXPECT_THAT(publisherThroughput.m_sampleSize, Eq(42U));
+    EXPECT_THAT(publisherThroughput.m_isField, Eq(false));
+    EXPECT_THAT(publisherThroughput.m_chunksPerMinute, Eq(0.0));
+    EXPECT_THAT(publisherThroughput.m_sentBytesPerSecond, Eq(0.0));
+    EXPECT_THAT(publisherThroughput.m_lastSendIntervalInNanoseconds, Eq(0U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataContainsOnlyPortsWithChangedCounters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a04326d-b586-40fa-8d1d-ca0de5c8ce56");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(true));
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(3);
+
+    // ports without any samples are left out from the start
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_throughputList.size(), Eq(0U));
+    EXPECT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(0U));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    publisherPortData.m_statistics.addSentSample(42U, 128U);
+    subscriberPortData.m_chunkReceiverData.m_highWaterMark.store(1U);
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(1U));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    subscriberPortData.m_statistics.addReceivedSample(42U);
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_throughputList.size(), Eq(0U));
+    ASSERT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_subscriberThroughputList[0].m_numberOfReceivedSamples, Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_subscriberThroughputList[0].m_queueHighWaterMark, Eq(1U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataContainsAllPortsWhenASubscriberConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "72163e75-688d-4b87-a63f-3920694c6f5d");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(3);
+
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_isKeyframe, Eq(false));
+    EXPECT_THAT(chunk->sample()->m_throughputList.size(), Eq(0U));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    // an ACK of another service does not request a keyframe
+    m_introspectionAccess.reportMessage(iox::capro::CaproMessage(iox::capro::CaproMessageType::ACK, service));
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_isKeyframe, Eq(false));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    m_introspectionAccess.reportMessage(iox::capro::CaproMessage(iox::capro::CaproMessageType::ACK,
+                                                                 iox::roudi::IntrospectionPortThroughputService));
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(chunk->sample()->m_isKeyframe, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_publisherPortID,
+                Eq(static_cast<uint64_t>(publisherPortData.m_uniqueId)));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_chunksPerMinute, Eq(0.0));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataSendsAKeyframePeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6178b8f9-d216-4003-8624-308515e00864");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .Times(static_cast<int>(2U * iox::roudi::INTROSPECTION_THROUGHPUT_KEYFRAME_INTERVAL));
+
+    constexpr uint64_t KEYFRAME_INTERVAL{iox::roudi::INTROSPECTION_THROUGHPUT_KEYFRAME_INTERVAL};
+    for (uint64_t round = 0U; round < 2U; ++round)
+    {
+        for (uint64_t sample = 1U; sample <= KEYFRAME_INTERVAL; ++sample)
+        {
+            m_introspectionAccess.sendThroughputData();
+            EXPECT_THAT(chunk->sample()->m_isKeyframe, Eq(sample == KEYFRAME_INTERVAL));
+            chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+        }
+    }
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataStartsWithNewCountersWhenTheSlotOfARemovedPortIsReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7bde3566-f90d-48fc-bf8c-c0ad577340b7");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData1(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    iox::popo::PublisherPortData publisherPortData2(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData1), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(2);
+
+    publisherPortData1.m_statistics.addSentSample(42U, 128U);
+    publisherPortData1.m_statistics.addSentSample(42U, 128U);
+    m_introspectionAccess.sendThroughputData();
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    MockPublisherPortUser port1;
+    EXPECT_CALL(port1, getUniqueID()).WillRepeatedly(Return(publisherPortData1.m_uniqueId));
+    EXPECT_CALL(port1, getServiceDescription()).WillRepeatedly(Return(publisherPortData1.m_serviceDescription));
+    ASSERT_THAT(m_introspectionAccess.removePublisher(port1), Eq(true));
+    ASSERT_THAT(m_introspectionAccess.addPublisher(publisherPortData2), Eq(true));
+
+    publisherPortData2.m_statistics.addSentSample(21U, 64U);
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    const auto& publisherThroughput = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(publisherThroughput.m_publisherPortID, Eq(static_cast<uint64_t>(publisherPortData2.m_uniqueId)));
+    EXPECT_THAT(publisherThroughput.m_numberOfSentSamples, Eq(1U));
+    EXPECT_THAT(publisherThroughput.m_sampleSize, Eq(21U));
+    EXPECT_THAT(publisherThroughput.m_sentBytesPerSecond, Gt(0.0));
+    EXPECT_THAT(publisherThroughput.m_lastSendIntervalInNanoseconds, Gt(0U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendSubscriberPortsDataIsSkippedWithoutChanges)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db935b3c-fa7b-4a6a-b7ce-e9521aff846a");
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .Times(3)
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_)).Times(3);
+
+    // the initial sample is always sent
+    m_introspectionAccess.sendSubscriberPortsData();
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(0U));
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+    m_introspectionAccess.sendSubscriberPortsData();
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(1U));
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    MockSubscriberPortUser port;
+    EXPECT_CALL(port, getUniqueID()).WillRepeatedly(Return(subscriberPortData.m_uniqueId));
+    EXPECT_CALL(port, getServiceDescription()).WillRepeatedly(Return(subscriberPortData.m_serviceDescription));
+    ASSERT_THAT(m_introspectionAccess.removeSubscriber(port), Eq(true));
+    m_introspectionAccess.sendSubscriberPortsData();
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(0U));
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+    m_introspectionAccess.sendSubscriberPortsData();
+}
+
+TEST_F(PortIntrospection_test, sendSubscriberPortsDataIsSentAgainAfterAReportedSubscriberStateChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a6df7c3-0a35-4af9-9a8b-ef2ca92ee584");
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_)).Times(2);
+
+    m_introspectionAccess.sendSubscriberPortsData();
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+
+    // the subscription state is not polled; the topic is only sent again after a state change was reported
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    m_introspectionAccess.reportSubscriberStateChange();
+    m_introspectionAccess.sendSubscriberPortsData();
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(1U));
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
@@ -154,6 +154,143 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryForChangedPortsConnectsOfferedPublisherAndSubscribedSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d79c8ae5-ddb5-47dc-8667-6a663828a872");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    subscriber.subscribe();
+
+    m_portManager->doDiscoveryForChangedPorts();
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    publisher.offer();
+
+    m_portManager->doDiscoveryForChangedPorts();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    EXPECT_FALSE(m_portManager->discoveryQueue().pop().has_value());
+}
+
+TEST_F(PortManager_test, DoDiscoveryForChangedPortsProcessesPortAgainAfterNextStateChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ce60e9c-cfc2-4f5a-a7c4-30be001b9d29");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    publisher.offer();
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    subscriber.subscribe();
+    m_portManager->doDiscoveryForChangedPorts();
+    ASSERT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+
+    subscriber.unsubscribe();
+    m_portManager->doDiscoveryForChangedPorts();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::NOT_SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, OfferReachesOnlyExistingSubscribersWithSameServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da509cda-54b4-47e5-af97-6c7ff8f7cac4");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    const ServiceDescription image{"Radar", "FrontLeft", "Image"};
+    const ServiceDescription points{"Radar", "FrontLeft", "Points"};
+
+    auto destroyedSubscriberPortData =
+        m_portManager->acquireSubscriberPortData(image, subscriberOptions, "schlomo", PortConfigInfo()).value();
+    SubscriberPortUser(destroyedSubscriberPortData).subscribe();
+    SubscriberPortUser otherSubscriber(
+        m_portManager->acquireSubscriberPortData(points, subscriberOptions, "schlomo", PortConfigInfo()).value());
+    otherSubscriber.subscribe();
+    m_portManager->doDiscovery();
+    destroyedSubscriberPortData->m_toBeDestroyed = true;
+    m_portManager->doDiscovery();
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                image, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    publisher.offer();
+    m_portManager->doDiscoveryForChangedPorts();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+
+    publisher.stopOffer();
+    m_portManager->doDiscoveryForChangedPorts();
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData(image, subscriberOptions, "schlomo", PortConfigInfo()).value());
+    subscriber.subscribe();
+    m_portManager->doDiscoveryForChangedPorts();
+    publisher.offer();
+    m_portManager->doDiscoveryForChangedPorts();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, OnlyConnectionsToPublishersWhichMeasureTheLatencyHaveALatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ac16dcd-5211-440e-9495-fecfbf3e9e3f");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    PublisherOptions measuringPublisherOptions{1U, iox::NodeName_t("node"), false};
+    measuringPublisherOptions.measureLatency = true;
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    const ServiceDescription service{"Radar", "FrontLeft", "Image"};
+
+    auto acquirePublisher = [&](const PublisherOptions& options) {
+        auto publisherPortData =
+            m_portManager
+                ->acquirePublisherPortData(
+                    service, options, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+                .value();
+        PublisherPortUser(publisherPortData).offer();
+        return publisherPortData;
+    };
+    auto publisherPortData = acquirePublisher(publisherOptions);
+    auto measuringPublisherPortData = acquirePublisher(measuringPublisherOptions);
+    auto subscriberPortData =
+        m_portManager->acquireSubscriberPortData(service, subscriberOptions, "schlomo", PortConfigInfo()).value();
+    SubscriberPortUser(subscriberPortData).subscribe();
+    m_portManager->doDiscovery();
+    ASSERT_TRUE(PublisherPortUser(measuringPublisherPortData).hasSubscribers());
+    const auto destroyedPublisherId = static_cast<uint64_t>(measuringPublisherPortData->m_uniqueId);
+
+    // the histogram of a destroyed publisher is reused for the next one
+    measuringPublisherPortData->m_toBeDestroyed = true;
+    m_portManager->doDiscovery();
+    auto nextMeasuringPublisherPortData = acquirePublisher(measuringPublisherOptions);
+    m_portManager->doDiscovery();
+
+    auto& latencyConnections = subscriberPortData->m_chunkReceiverData.m_latencyConnections;
+    EXPECT_THAT(latencyConnections.disconnect(static_cast<uint64_t>(publisherPortData->m_uniqueId)), Eq(nullptr));
+    EXPECT_THAT(latencyConnections.disconnect(destroyedPublisherId), Eq(nullptr));
+    EXPECT_THAT(latencyConnections.disconnect(static_cast<uint64_t>(nextMeasuringPublisherPortData->m_uniqueId)),
+                Ne(nullptr));
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -668,6 +805,21 @@ TEST_F(PortManager_test, AcquireConditionVariablesDataAfterDestroyingPreviouslyA
     acquireMaxNumberOfConditionVariables(runtimeName);
 }
 
+TEST_F(PortManager_test, AcquireConditionVariableDataReclaimsDestroyedOnesWhenThePoolIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b24971e-495a-4b24-bc01-174df407fed7");
+    std::vector<iox::popo::ConditionVariableData*> condVarContainer;
+
+    std::string runtimeName = "HypnoToadForEver";
+
+    acquireMaxNumberOfConditionVariables(runtimeName, [&](auto condVar) { condVarContainer.push_back(condVar); });
+
+    // no discovery run in between; the destroyed condition variables are reclaimed when the pool is full
+    setDestroyFlagAndClearContainer(condVarContainer);
+
+    acquireMaxNumberOfConditionVariables(runtimeName);
+}
+
 TEST_F(PortManager_test, UnblockRouDiShutdownMakesAllPublisherStopOffer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "aa0cd25c-4e9d-476a-a8a6-d5c650fb9fff");
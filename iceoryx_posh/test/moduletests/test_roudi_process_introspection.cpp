@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/timing_test.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
@@ -36,12 +37,18 @@ class ProcessIntrospectionAccess : public iox::roudi::ProcessIntrospection<MockP
     {
         return this->m_publisherPort;
     }
+
+    iox::optional<MockPublisherPortUser>& getStatisticsPublisherPort()
+    {
+        return this->m_statisticsPublisherPort;
+    }
 };
 
 class ProcessIntrospection_test : public Test
 {
   public:
     using Topic = iox::roudi::ProcessIntrospectionFieldTopic;
+    using StatisticsTopic = iox::roudi::ProcessStatisticsIntrospectionTopic;
 
     ProcessIntrospection_test()
     {
@@ -74,8 +81,30 @@ class ProcessIntrospection_test : public Test
         return chunkWasSent ? m_chunk.get() : nullptr;
     }
 
+    /// @brief the process list is ignored, it is sent on the first call
+    ChunkMock<StatisticsTopic>* createStatisticsChunkAndSend(ProcessIntrospectionAccess& sut)
+    {
+        iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+            iox::ok(m_chunk.get()->chunkHeader());
+        EXPECT_CALL(sut.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+            .WillRepeatedly(Return(tryAllocateChunkResult));
+        EXPECT_CALL(sut.getPublisherPort().value(), sendChunk(_)).WillRepeatedly(Return());
+        EXPECT_CALL(sut.getStatisticsPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+            .WillOnce(Return(ByMove(iox::ok(m_statisticsChunk.get()->chunkHeader()))));
+
+        bool chunkWasSent = false;
+        EXPECT_CALL(sut.getStatisticsPublisherPort().value(), sendChunk(_))
+            .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+        sut.send();
+
+        return chunkWasSent ? m_statisticsChunk.get() : nullptr;
+    }
+
     std::unique_ptr<ChunkMock<Topic>> m_chunk{new ChunkMock<Topic>()};
+    std::unique_ptr<ChunkMock<StatisticsTopic>> m_statisticsChunk{new ChunkMock<StatisticsTopic>()};
     MockPublisherPortUser m_mockPublisherPortUserIntrospection;
+    MockPublisherPortUser m_mockStatisticsPublisherPortUserIntrospection;
 };
 
 TEST_F(ProcessIntrospection_test, CTOR)
@@ -92,8 +121,10 @@ TEST_F(ProcessIntrospection_test, registerPublisherPort)
     ::testing::Test::RecordProperty("TEST_ID", "fcacaa4a-7883-43d6-850f-04b78558e45b");
     {
         std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
-        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection));
+        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                   std::move(m_mockStatisticsPublisherPortUserIntrospection));
         EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).Times(1);
+        EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).Times(1);
     }
 }
 
@@ -102,7 +133,8 @@ TEST_F(ProcessIntrospection_test, send)
     ::testing::Test::RecordProperty("TEST_ID", "7faf7880-c9be-4893-8f68-15cc77a4583c");
     {
         std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
-        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection));
+        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                   std::move(m_mockStatisticsPublisherPortUserIntrospection));
 
         auto chunk = createMemoryChunkAndSend(*introspectionAccess);
         ASSERT_THAT(chunk, Ne(nullptr));
@@ -116,7 +148,11 @@ TEST_F(ProcessIntrospection_test, addRemoveProcess)
     ::testing::Test::RecordProperty("TEST_ID", "50d5090f-c89e-400f-b400-313df15d4193");
     {
         std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
-        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection));
+        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                   std::move(m_mockStatisticsPublisherPortUserIntrospection));
+
+        // the statistics of the process are not relevant for the process list
+        introspectionAccess->setStatisticsSamplesPerInterval(0U);
 
         const int PID = 42;
         const char PROCESS_NAME[] = "/chuck_norris";
@@ -157,7 +193,8 @@ TEST_F(ProcessIntrospection_test, thread)
 
         std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
 
-        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection));
+        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                   std::move(m_mockStatisticsPublisherPortUserIntrospection));
 
         iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
             iox::ok(m_chunk.get()->chunkHeader());
@@ -167,6 +204,11 @@ TEST_F(ProcessIntrospection_test, thread)
         EXPECT_CALL(introspectionAccess->getPublisherPort().value(), offer()).Times(1);
         EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).WillRepeatedly(Return());
         EXPECT_CALL(introspectionAccess->getPublisherPort().value(), sendChunk(_)).Times(Between(2, 8));
+        EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+            .WillRepeatedly(Return(tryAllocateChunkResult));
+        EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), offer()).Times(1);
+        EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).WillRepeatedly(Return());
+        EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), sendChunk(_)).Times(AnyNumber());
 
         using namespace iox::units::duration_literals;
         introspectionAccess->setSendInterval(10_ms);
@@ -194,4 +236,113 @@ TEST_F(ProcessIntrospection_test, thread)
     }
 }
 
+TEST_F(ProcessIntrospection_test, sendIntervalOfZeroSendsOnlyTheInitialSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9a04e95-ab8b-4715-95f1-c76b69c9d274");
+    const int PID = 42;
+    const char PROCESS_NAME[] = "/chuck_norris";
+
+    std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
+
+    introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                   std::move(m_mockStatisticsPublisherPortUserIntrospection));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(m_chunk.get()->chunkHeader());
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), offer()).Times(1);
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).WillRepeatedly(Return());
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), sendChunk(_)).Times(1);
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), offer()).Times(1);
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).WillRepeatedly(Return());
+
+    introspectionAccess->setSendInterval(iox::units::Duration::zero());
+    introspectionAccess->run();
+
+    introspectionAccess->addProcess(PID, iox::RuntimeName_t(PROCESS_NAME));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    introspectionAccess->stop();
+}
+
+TEST_F(ProcessIntrospection_test, statisticsOfAnExistingProcessAreSampled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ffdd059c-3fd7-47c6-b8d6-4170075ed8f1");
+#if !defined(__linux__)
+    GTEST_SKIP() << "The process statistics are only available on platforms with a proc filesystem";
+#endif
+    std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
+    introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                               std::move(m_mockStatisticsPublisherPortUserIntrospection));
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).Times(1);
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).Times(1);
+
+    // only one process is sampled per send, the processes are sampled round-robin
+    introspectionAccess->setStatisticsSamplesPerInterval(1U);
+    introspectionAccess->addProcess(getpid(), iox::RuntimeName_t("/own_process"));
+    introspectionAccess->addProcess(getppid(), iox::RuntimeName_t("/parent_process"));
+
+    auto chunk = createStatisticsChunkAndSend(*introspectionAccess);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    ASSERT_THAT(chunk->sample()->m_processStatisticsList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_processStatisticsList[0].m_pid, Eq(getpid()));
+    EXPECT_THAT(chunk->sample()->m_processStatisticsList[0].m_residentSetSizeInBytes, Gt(0U));
+    EXPECT_THAT(chunk->sample()->m_processStatisticsList[0].m_numberOfMinorPageFaults, Gt(0U));
+
+    chunk = createStatisticsChunkAndSend(*introspectionAccess);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    ASSERT_THAT(chunk->sample()->m_processStatisticsList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_processStatisticsList[0].m_pid, Eq(getppid()));
+    EXPECT_THAT(chunk->sample()->m_processStatisticsList[0].m_residentSetSizeInBytes, Gt(0U));
+}
+
+TEST_F(ProcessIntrospection_test, processListIsNotSentAgainWhenOnlyTheStatisticsChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b74346ea-8d51-4972-b17e-ee22793b684f");
+    std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
+    introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                               std::move(m_mockStatisticsPublisherPortUserIntrospection));
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(m_statisticsChunk.get()->chunkHeader());
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), sendChunk(_)).Times(AnyNumber());
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).Times(1);
+
+    introspectionAccess->addProcess(getpid(), iox::RuntimeName_t("/own_process"));
+
+    auto chunk = createMemoryChunkAndSend(*introspectionAccess);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    ASSERT_THAT(chunk->sample()->m_processList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_processList[0].m_pid, Eq(getpid()));
+
+    // the own process is sampled again, its statistics are sent on the statistics topic only
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), sendChunk(_)).Times(0);
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).Times(1);
+    introspectionAccess->send();
+}
+
+TEST_F(ProcessIntrospection_test, statisticsAreNotSentWhenTheSamplingIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c947d470-266f-4796-8bbd-5bc2a64e073f");
+    std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
+    introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                               std::move(m_mockStatisticsPublisherPortUserIntrospection));
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), sendChunk(_)).Times(0);
+    EXPECT_CALL(introspectionAccess->getStatisticsPublisherPort().value(), stopOffer()).Times(1);
+
+    introspectionAccess->setStatisticsSamplesPerInterval(0U);
+    introspectionAccess->addProcess(getpid(), iox::RuntimeName_t("/own_process"));
+
+    auto chunk = createMemoryChunkAndSend(*introspectionAccess);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    ASSERT_THAT(chunk->sample()->m_processList.size(), Eq(1U));
+
+    // without the sampling the unchanged list is not sent again
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), sendChunk(_)).Times(0);
+    EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).Times(1);
+    introspectionAccess->send();
+}
+
 } // namespace
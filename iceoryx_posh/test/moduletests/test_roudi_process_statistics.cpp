@@ -0,0 +1,123 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/process_statistics.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::ProcessStatistics;
+using iox::roudi::ProcessStatisticsReader;
+
+constexpr uint64_t CLOCK_TICKS_PER_SECOND{100U};
+constexpr uint64_t PAGE_SIZE{4096U};
+
+// the command name contains spaces and parentheses which must not confuse the parser
+constexpr const char STAT_CONTENT[]{"1234 (my (app) x) S 1 1234 1234 0 -1 4194304 81 2 5 0 250 130 0 0 20 0 1 0 "
+                                    "1913738 2703360 311 18446744073709551615 94822698942464 94822698962345\n"};
+
+constexpr const char STATUS_CONTENT[]{"Name:\tapp\n"
+                                      "State:\tS (sleeping)\n"
+                                      "Pid:\t1234\n"
+                                      "VmRSS:\t    1244 kB\n"
+                                      "voluntary_ctxt_switches:\t73\n"
+                                      "nonvoluntary_ctxt_switches:\t13\n"};
+
+TEST(ProcessStatistics_test, ParseStatReadsTheCpuTimePageFaultsAndResidentSetSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "719092aa-51dc-468d-a111-e33f688e60ea");
+    ProcessStatistics statistics;
+
+    ASSERT_TRUE(ProcessStatisticsReader::parseStat(STAT_CONTENT, CLOCK_TICKS_PER_SECOND, PAGE_SIZE, statistics));
+
+    EXPECT_THAT(statistics.userCpuTimeInNanoseconds, Eq(2500000000U));
+    EXPECT_THAT(statistics.systemCpuTimeInNanoseconds, Eq(1300000000U));
+    EXPECT_THAT(statistics.numberOfMinorPageFaults, Eq(81U));
+    EXPECT_THAT(statistics.numberOfMajorPageFaults, Eq(5U));
+    EXPECT_THAT(statistics.residentSetSizeInBytes, Eq(311U * PAGE_SIZE));
+}
+
+TEST(ProcessStatistics_test, ParseStatFailsForTruncatedOrMalformedContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3b22f7c-a7ec-48df-83fe-59cc97879126");
+    ProcessStatistics statistics;
+
+    EXPECT_FALSE(ProcessStatisticsReader::parseStat("", CLOCK_TICKS_PER_SECOND, PAGE_SIZE, statistics));
+    EXPECT_FALSE(ProcessStatisticsReader::parseStat(
+        "1234 S 1 1234 1234 0 -1 4194304 81 2 5 0 250 130", CLOCK_TICKS_PER_SECOND, PAGE_SIZE, statistics));
+    EXPECT_FALSE(ProcessStatisticsReader::parseStat(
+        "1234 (app) S 1 1234 1234 0 -1 4194304 81 2 5 0 250 130", CLOCK_TICKS_PER_SECOND, PAGE_SIZE, statistics));
+    EXPECT_FALSE(ProcessStatisticsReader::parseStat(
+        "1234 (app) S 1 1234 1234 0 -1 4194304 x 2 5 0 250 130 0 0 20 0 1 0 1 2 3",
+        CLOCK_TICKS_PER_SECOND,
+        PAGE_SIZE,
+        statistics));
+    EXPECT_FALSE(ProcessStatisticsReader::parseStat(STAT_CONTENT, 0U, PAGE_SIZE, statistics));
+
+    EXPECT_THAT(statistics.userCpuTimeInNanoseconds, Eq(0U));
+    EXPECT_THAT(statistics.residentSetSizeInBytes, Eq(0U));
+}
+
+TEST(ProcessStatistics_test, ParseStatusReadsTheContextSwitches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a0aa116-1835-4b04-b124-f48047097096");
+    ProcessStatistics statistics;
+
+    ASSERT_TRUE(ProcessStatisticsReader::parseStatus(STATUS_CONTENT, statistics));
+
+    EXPECT_THAT(statistics.numberOfVoluntaryContextSwitches, Eq(73U));
+    EXPECT_THAT(statistics.numberOfInvoluntaryContextSwitches, Eq(13U));
+}
+
+TEST(ProcessStatistics_test, ParseStatusFailsWithoutContextSwitches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc75e931-2edd-44e5-a231-f0df8b970d6c");
+    ProcessStatistics statistics;
+
+    EXPECT_FALSE(ProcessStatisticsReader::parseStatus("Name:\tapp\nvoluntary_ctxt_switches:\t73\n", statistics));
+
+    EXPECT_THAT(statistics.numberOfVoluntaryContextSwitches, Eq(0U));
+    EXPECT_THAT(statistics.numberOfInvoluntaryContextSwitches, Eq(0U));
+}
+
+TEST(ProcessStatistics_test, ReadOfTheOwnProcessReturnsStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ba7afa0-ef34-42be-8d44-3cce5289c7d5");
+#if !defined(__linux__)
+    GTEST_SKIP() << "The process statistics are only available on platforms with a proc filesystem";
+#endif
+    ProcessStatisticsReader sut;
+
+    auto statistics = sut.read(getpid());
+
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_THAT(statistics->residentSetSizeInBytes, Gt(0U));
+    EXPECT_THAT(statistics->numberOfMinorPageFaults, Gt(0U));
+    EXPECT_THAT(statistics->numberOfVoluntaryContextSwitches + statistics->numberOfInvoluntaryContextSwitches,
+                Gt(0U));
+}
+
+TEST(ProcessStatistics_test, ReadOfANonExistingProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47a78c7a-ebf6-42d7-93e7-f1f01f769972");
+    ProcessStatisticsReader sut;
+
+    EXPECT_FALSE(sut.read(-1).has_value());
+}
+
+} // namespace
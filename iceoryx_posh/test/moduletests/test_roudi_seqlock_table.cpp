@@ -0,0 +1,144 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/seqlock_table.hpp"
+#include "iox/atomic.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::SeqLockTable;
+
+struct Entry
+{
+    uint64_t value{0U};
+    uint64_t copyOfValue{0U};
+};
+
+constexpr uint64_t CAPACITY{4U};
+
+class SeqLockTable_test : public Test
+{
+  public:
+    SeqLockTable<Entry, CAPACITY> sut;
+};
+
+TEST_F(SeqLockTable_test, InitiallyAllSlotsAreFree)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "113c96c9-6f59-4c9c-9c63-5f098632cc8d");
+    for (uint64_t index = 0U; index < CAPACITY; ++index)
+    {
+        EXPECT_FALSE(sut.isUsed(index));
+        EXPECT_FALSE(sut.read(index, [](const Entry&) { GTEST_FAIL() << "free slots must not be read"; }));
+    }
+}
+
+TEST_F(SeqLockTable_test, InsertedEntryCanBeRead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d4843ec-4ec5-4a35-ac70-579cb2d32d4b");
+    auto index = sut.insert({42U, 42U});
+    ASSERT_TRUE(index.has_value());
+
+    EXPECT_TRUE(sut.isUsed(index.value()));
+    EXPECT_THAT(sut.entry(index.value()).value, Eq(42U));
+
+    uint64_t value{0U};
+    EXPECT_TRUE(sut.read(index.value(), [&](const Entry& entry) { value = entry.value; }));
+    EXPECT_THAT(value, Eq(42U));
+}
+
+TEST_F(SeqLockTable_test, InsertFailsWhenTheTableIsFullAndErasedSlotsAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c38749f-96a5-444c-9b7c-8217d8c88833");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut.insert({i, i}).value(), Eq(i));
+    }
+    EXPECT_FALSE(sut.insert({CAPACITY, CAPACITY}).has_value());
+
+    sut.erase(1U);
+    EXPECT_FALSE(sut.isUsed(1U));
+    EXPECT_FALSE(sut.read(1U, [](const Entry&) {}));
+
+    EXPECT_THAT(sut.insert({CAPACITY, CAPACITY}).value(), Eq(1U));
+    EXPECT_THAT(sut.entry(1U).value, Eq(CAPACITY));
+}
+
+TEST_F(SeqLockTable_test, ConcurrentReaderOnlySeesCompleteEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ed34cdd-baf5-4155-8370-4506c2d879d0");
+    constexpr uint64_t NUMBER_OF_WRITES{100000U};
+    iox::concurrent::Atomic<bool> isWriterDone{false};
+
+    std::thread writer([&] {
+        for (uint64_t i = 1U; i <= NUMBER_OF_WRITES; ++i)
+        {
+            auto index = sut.insert({i, i});
+            ASSERT_TRUE(index.has_value());
+            sut.erase(index.value());
+        }
+        isWriterDone.store(true);
+    });
+
+    uint64_t numberOfInconsistentReads{0U};
+    while (!isWriterDone.load())
+    {
+        for (uint64_t index = 0U; index < CAPACITY; ++index)
+        {
+            Entry copy;
+            if (sut.read(index, [&](const Entry& entry) { copy = entry; }) && copy.value != copy.copyOfValue)
+            {
+                ++numberOfInconsistentReads;
+            }
+        }
+    }
+    writer.join();
+
+    EXPECT_THAT(numberOfInconsistentReads, Eq(0U));
+}
+
+TEST_F(SeqLockTable_test, EraseWaitsUntilTheReaderOfTheEntryIsFinished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e83bbb0-6374-40c7-a8ec-e488f0b87373");
+    auto index = sut.insert({42U, 42U});
+    ASSERT_TRUE(index.has_value());
+
+    iox::concurrent::Atomic<bool> isReaderStarted{false};
+    iox::concurrent::Atomic<bool> isReaderFinished{false};
+    std::thread reader([&] {
+        sut.read(index.value(), [&](const Entry&) {
+            isReaderStarted.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            isReaderFinished.store(true);
+        });
+    });
+
+    while (!isReaderStarted.load())
+    {
+        std::this_thread::yield();
+    }
+    sut.erase(index.value());
+
+    // data referenced by the entry can be freed after erase returned
+    EXPECT_TRUE(isReaderFinished.load());
+    reader.join();
+}
+
+} // namespace
@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -634,6 +635,57 @@ TYPED_TEST(ServiceRegistry_test, SearchInFullRegistryWorks)
     ASSERT_EQ(this->searchResult.size(), 1);
 }
 
+TYPED_TEST(ServiceRegistry_test, RemainingEntriesOfFullRegistryCanBeFoundAfterRemovingEveryOtherEntry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "501c4377-cf4b-4001-937a-4431b9e9ae69");
+    iox::vector<ServiceDescription, CAPACITY> services;
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        services.push_back(iox::capro::ServiceDescription(
+            "Foo",
+            iox::into<iox::lossy<iox::capro::IdString_t>>(iox::convert::toString(i % 2U)),
+            iox::into<iox::lossy<iox::capro::IdString_t>>(iox::convert::toString(i))));
+        ASSERT_FALSE(this->sut.add(services.back()).has_error());
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        this->sut.remove(services[i]);
+    }
+
+    this->find(IdString_t("Foo"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(CAPACITY / 2U));
+    this->find(iox::capro::Wildcard, IdString_t("0"), iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(0U));
+    this->find(iox::capro::Wildcard, IdString_t("1"), iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(CAPACITY / 2U));
+
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        this->find(services[i].getServiceIDString(), services[i].getInstanceIDString(), services[i].getEventIDString());
+        EXPECT_THAT(this->searchResult.size(), Eq(i % 2U));
+    }
+}
+
+TYPED_TEST(ServiceRegistry_test, CopiedRegistryFindsTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da58778d-ff37-468d-a77f-881735a3e1ef");
+    ServiceDescription service1("a", "b", "c");
+    ServiceDescription service2("a", "d", "e");
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(this->sut.registry)};
+    this->searchResult.clear();
+    copy->find(IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard, [&](const auto& entry) {
+        this->searchResult.push_back(entry);
+    });
+
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service2));
+}
+
 TYPED_TEST(ServiceRegistry_test, FunctionIsAppliedToAllEntriesInSearchResult)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b7828085-d879-43b7-9fee-e5e88cf36995");
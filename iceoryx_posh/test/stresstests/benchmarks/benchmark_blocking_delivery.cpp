@@ -0,0 +1,162 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_platform/time.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/atomic.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+namespace
+{
+constexpr uint64_t CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{64U};
+constexpr uint64_t QUEUE_CAPACITY{4U};
+
+using ChunkQueueData_t = iox::popo::ChunkQueueData<iox::DefaultChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                               iox::popo::ThreadSafePolicy,
+                                                               iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = iox::popo::ChunkDistributor<ChunkDistributorData_t>;
+
+struct FreeDeleter
+{
+    void operator()(void* ptr) const noexcept
+    {
+        free(ptr);
+    }
+};
+
+std::chrono::nanoseconds threadCpuTime() noexcept
+{
+    struct timespec cpuTime
+    {
+    };
+    if (iox_clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) != 0)
+    {
+        std::abort();
+    }
+    return std::chrono::seconds(cpuTime.tv_sec) + std::chrono::nanoseconds(cpuTime.tv_nsec);
+}
+
+/// @brief a publisher delivers to a queue with QueueFullPolicy::BLOCK_PRODUCER whose consumer takes a chunk only
+/// every 'consumerPeriod'; the publisher is blocked most of the time and its CPU usage shows whether it sleeps or spins
+void deliverToSlowConsumer(const std::chrono::microseconds consumerPeriod, const iox::units::Duration& duration)
+{
+    iox::mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+    auto managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolConfig);
+    auto chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    std::unique_ptr<void, FreeDeleter> managementMemory{malloc(managementMemorySize)};
+    std::unique_ptr<void, FreeDeleter> chunkMemory{malloc(chunkMemorySize)};
+    iox::BumpAllocator managementAllocator(managementMemory.get(), managementMemorySize);
+    iox::BumpAllocator chunkMemoryAllocator(chunkMemory.get(), chunkMemorySize);
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, chunkMemoryAllocator);
+    auto chunkSettings =
+        iox::mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    auto queueData = std::make_unique<ChunkQueueData_t>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER,
+                                                        iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> popper{queueData.get()};
+    popper.setCapacity(QUEUE_CAPACITY);
+
+    auto distributorData =
+        std::make_unique<ChunkDistributorData_t>(iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, 0U);
+    ChunkDistributor_t distributor{distributorData.get()};
+    distributor.tryAddQueue(queueData.get()).or_else([](auto) { std::abort(); });
+
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    iox::concurrent::Atomic<bool> isPublisherFinished{false};
+    uint64_t numberOfDeliveries{0U};
+    std::chrono::nanoseconds publisherCpuTime{0};
+    std::chrono::nanoseconds publisherWallTime{0};
+    std::thread publisher([&] {
+        const auto cpuTimeStart = threadCpuTime();
+        const auto wallTimeStart = std::chrono::steady_clock::now();
+        while (keepRunning)
+        {
+            auto chunk = memoryManager.getChunk(chunkSettings);
+            if (chunk.has_error())
+            {
+                std::abort();
+            }
+            distributor.deliverToAllStoredQueues(chunk.value());
+            ++numberOfDeliveries;
+        }
+        publisherCpuTime = threadCpuTime() - cpuTimeStart;
+        publisherWallTime = std::chrono::steady_clock::now() - wallTimeStart;
+        isPublisherFinished = true;
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(duration.toMilliseconds());
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(consumerPeriod);
+        popper.tryPop();
+    }
+
+    // the publisher might be blocked by the full queue and needs a free slot to see the stop request
+    keepRunning = false;
+    while (!isPublisherFinished)
+    {
+        popper.tryPop();
+        std::this_thread::yield();
+    }
+    publisher.join();
+    popper.clear();
+
+    const auto cpuUsageInPercent =
+        100.0 * static_cast<double>(publisherCpuTime.count()) / static_cast<double>(publisherWallTime.count());
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " consumer period: " << std::setw(5) << consumerPeriod.count()
+              << " (us) : " << std::setw(10) << numberOfDeliveries << " (deliveries), " << std::setw(6)
+              << std::fixed << std::setprecision(1) << cpuUsageInPercent << std::defaultfloat
+              << " (publisher CPU usage in %)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    for (const auto consumerPeriod :
+         {std::chrono::microseconds(10), std::chrono::microseconds(100), std::chrono::microseconds(1000)})
+    {
+        deliverToSlowConsumer(consumerPeriod, timeout);
+    }
+
+    return 0;
+}
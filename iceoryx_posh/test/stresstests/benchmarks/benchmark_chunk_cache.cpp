@@ -0,0 +1,135 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/atomic.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint32_t CHUNKS_PER_THREAD{64U};
+constexpr uint32_t MAX_NUMBER_OF_THREADS{16U};
+
+struct FreeDeleter
+{
+    void operator()(void* ptr) const noexcept
+    {
+        free(ptr);
+    }
+};
+
+/// @brief a memory manager with a single mempool which is shared by all loaning threads
+class SharedMemoryManager
+{
+  public:
+    SharedMemoryManager() noexcept
+    {
+        iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, CHUNKS_PER_THREAD * MAX_NUMBER_OF_THREADS});
+
+        auto managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolConfig);
+        auto chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolConfig);
+        m_managementMemory.reset(malloc(managementMemorySize));
+        m_chunkMemory.reset(malloc(chunkMemorySize));
+        iox::BumpAllocator managementAllocator(m_managementMemory.get(), managementMemorySize);
+        iox::BumpAllocator chunkMemoryAllocator(m_chunkMemory.get(), chunkMemorySize);
+        memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, chunkMemoryAllocator);
+    }
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::mepoo::ChunkSettings chunkSettings{
+        iox::mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value()};
+
+  private:
+    std::unique_ptr<void, FreeDeleter> m_managementMemory;
+    std::unique_ptr<void, FreeDeleter> m_chunkMemory;
+};
+
+/// @brief every thread repeatedly loans and releases a chunk from the same mempool; with a cache size larger than
+/// zero each thread owns a ChunkCache like a publisher port with 'PublisherOptions::chunkCacheSize' does
+void loanAndReleaseConcurrently(const uint32_t numberOfThreads,
+                                const uint32_t chunkCacheSize,
+                                const iox::units::Duration& duration)
+{
+    SharedMemoryManager sut;
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    std::vector<uint64_t> numberOfLoans(numberOfThreads, 0U);
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0U; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([&, i] {
+            iox::mepoo::ChunkCache chunkCache{chunkCacheSize};
+            uint64_t loans{0U};
+            while (keepRunning)
+            {
+                sut.memoryManager.getChunk(sut.chunkSettings, chunkCache).or_else([](auto&) { std::abort(); });
+                ++loans;
+            }
+            chunkCache.drain();
+            numberOfLoans[i] = loans;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    uint64_t totalNumberOfLoans{0U};
+    for (auto loans : numberOfLoans)
+    {
+        totalNumberOfLoans += loans;
+    }
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " threads: " << std::setw(2) << numberOfThreads
+              << " chunk cache size: " << std::setw(2) << chunkCacheSize << " : " << std::setw(12)
+              << totalNumberOfLoans * 1000U / duration.toMilliseconds() << " (loans/s)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    const auto hardwareConcurrency = std::max(1U, std::thread::hardware_concurrency());
+    const auto maxNumberOfThreads = std::min(MAX_NUMBER_OF_THREADS, hardwareConcurrency);
+    for (uint32_t numberOfThreads = 1U; numberOfThreads <= maxNumberOfThreads; ++numberOfThreads)
+    {
+        loanAndReleaseConcurrently(numberOfThreads, 0U, timeout);
+        loanAndReleaseConcurrently(numberOfThreads, iox::mepoo::ChunkCache::MAX_CHUNKS_PER_MEMPOOL, timeout);
+    }
+
+    return 0;
+}
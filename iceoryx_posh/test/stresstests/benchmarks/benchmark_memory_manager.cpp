@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+constexpr uint64_t SMALLEST_CHUNK_PAYLOAD_SIZE{32U};
+constexpr uint64_t CHUNK_PAYLOAD_SIZE_INCREMENT{64U};
+constexpr uint32_t CHUNK_COUNT{10U};
+
+/// @brief a memory manager with NumberOfMemPools mempools of increasing chunk-payload size
+template <uint32_t NumberOfMemPools>
+class MemoryManagerWithMemPools
+{
+  public:
+    static MemoryManagerWithMemPools& instance() noexcept
+    {
+        static MemoryManagerWithMemPools memoryManager;
+        return memoryManager;
+    }
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::mepoo::ChunkSettings smallestChunkSettings{
+        iox::mepoo::ChunkSettings::create(SMALLEST_CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+            .value()};
+    iox::mepoo::ChunkSettings largestChunkSettings{smallestChunkSettings};
+
+  private:
+    MemoryManagerWithMemPools() noexcept
+    {
+        static_assert(NumberOfMemPools <= iox::MAX_NUMBER_OF_MEMPOOLS, "Too many mempools requested");
+
+        iox::mepoo::MePooConfig mempoolConfig;
+        uint64_t chunkPayloadSize{SMALLEST_CHUNK_PAYLOAD_SIZE};
+        for (uint32_t i = 0U; i < NumberOfMemPools; ++i)
+        {
+            mempoolConfig.addMemPool({chunkPayloadSize, CHUNK_COUNT});
+            largestChunkSettings =
+                iox::mepoo::ChunkSettings::create(chunkPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+            chunkPayloadSize += CHUNK_PAYLOAD_SIZE_INCREMENT;
+        }
+
+        m_managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolConfig);
+        m_chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolConfig);
+        m_managementMemory.reset(malloc(m_managementMemorySize));
+        m_chunkMemory.reset(malloc(m_chunkMemorySize));
+        iox::BumpAllocator managementAllocator(m_managementMemory.get(), m_managementMemorySize);
+        iox::BumpAllocator chunkMemoryAllocator(m_chunkMemory.get(), m_chunkMemorySize);
+        memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, chunkMemoryAllocator);
+    }
+
+    struct FreeDeleter
+    {
+        void operator()(void* ptr) const noexcept
+        {
+            free(ptr);
+        }
+    };
+
+    uint64_t m_managementMemorySize{0U};
+    uint64_t m_chunkMemorySize{0U};
+    std::unique_ptr<void, FreeDeleter> m_managementMemory;
+    std::unique_ptr<void, FreeDeleter> m_chunkMemory;
+};
+
+template <uint32_t NumberOfMemPools>
+void loanAndReleaseFromSmallestMemPool()
+{
+    auto& sut = MemoryManagerWithMemPools<NumberOfMemPools>::instance();
+    sut.memoryManager.getChunk(sut.smallestChunkSettings).or_else([](auto&) { std::abort(); });
+}
+
+template <uint32_t NumberOfMemPools>
+void loanAndReleaseFromLargestMemPool()
+{
+    auto& sut = MemoryManagerWithMemPools<NumberOfMemPools>::instance();
+    sut.memoryManager.getChunk(sut.largestChunkSettings).or_else([](auto&) { std::abort(); });
+}
+
+template <uint32_t NumberOfMemPools>
+void performBenchmarks(const iox::units::Duration& timeout)
+{
+    MemoryManagerWithMemPools<NumberOfMemPools>::instance();
+    std::cout << "number of mempools: " << NumberOfMemPools << std::endl;
+    BENCHMARK(loanAndReleaseFromSmallestMemPool<NumberOfMemPools>, timeout);
+    BENCHMARK(loanAndReleaseFromLargestMemPool<NumberOfMemPools>, timeout);
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    performBenchmarks<1U>(timeout);
+    performBenchmarks<2U>(timeout);
+    performBenchmarks<4U>(timeout);
+    performBenchmarks<8U>(timeout);
+    performBenchmarks<16U>(timeout);
+    performBenchmarks<iox::MAX_NUMBER_OF_MEMPOOLS>(timeout);
+
+    return 0;
+}
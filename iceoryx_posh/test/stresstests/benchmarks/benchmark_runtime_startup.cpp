@@ -0,0 +1,111 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// @brief builds a CREATE_PUBLISHER request like the runtime does and parses it like RouDi does
+uint64_t buildAndParseCreatePublisherMessage()
+{
+    static const std::string service =
+        static_cast<iox::Serialization>(iox::capro::ServiceDescription{"Radar", "FrontLeft", "Objects"}).toString();
+    static const std::string publisherOptions = iox::popo::PublisherOptions{}.serialize().toString();
+    static const std::string portConfigInfo =
+        static_cast<iox::Serialization>(iox::runtime::PortConfigInfo{}).toString();
+    static const iox::RuntimeName_t runtimeName{"iox-bm-runtime-startup"};
+
+    iox::runtime::IpcMessage message;
+    message << iox::runtime::IpcMessageTypeToString(iox::runtime::IpcMessageType::CREATE_PUBLISHER) << runtimeName
+            << service << publisherOptions << portConfigInfo;
+
+    uint64_t parsedSize{0U};
+    for (uint32_t i = 0U; i < message.getNumberOfElements(); ++i)
+    {
+        parsedSize += message.getElementAtIndex(i).size();
+    }
+    return parsedSize;
+}
+
+/// @brief measures how long it takes until the given number of runtimes have registered at RouDi and each of them
+/// has created the given number of publishers; all requests go through the IPC channel of RouDi
+void registerRuntimesAndCreatePublishers(const uint64_t numberOfRuntimes, const uint64_t numberOfPublishers)
+{
+    iox::roudi_env::RouDiEnv roudiEnv;
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t runtimeIndex = 0U; runtimeIndex < numberOfRuntimes; ++runtimeIndex)
+    {
+        const auto runtimeName = "bm-runtime-" + std::to_string(runtimeIndex);
+        iox::runtime::PoshRuntime::initRuntime(iox::RuntimeName_t(iox::TruncateToCapacity, runtimeName.c_str()));
+        for (uint64_t publisherIndex = 0U; publisherIndex < numberOfPublishers; ++publisherIndex)
+        {
+            const auto instance = "Publisher" + std::to_string(publisherIndex);
+            publishers.emplace_back(std::make_unique<iox::popo::UntypedPublisher>(
+                iox::capro::ServiceDescription{iox::capro::IdString_t(iox::TruncateToCapacity, runtimeName.c_str()),
+                                               iox::capro::IdString_t(iox::TruncateToCapacity, instance.c_str()),
+                                               "Event"}));
+        }
+    }
+    const auto actualDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    publishers.clear();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " runtimes: " << std::setw(3) << numberOfRuntimes
+              << " publishers per runtime: " << std::setw(3) << numberOfPublishers << " : " << std::setw(8)
+              << static_cast<uint64_t>(actualDuration.count()) << " (us in total) : " << std::setw(6)
+              << static_cast<uint64_t>(actualDuration.count()) / (numberOfRuntimes * (numberOfPublishers + 1U))
+              << " (us per request)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    BENCHMARK(buildAndParseCreatePublisherMessage, timeout);
+
+    constexpr uint64_t NUMBER_OF_RUNTIMES{32U};
+    for (uint64_t numberOfPublishers = 1U; numberOfPublishers * NUMBER_OF_RUNTIMES <= iox::MAX_PUBLISHERS / 2U;
+         numberOfPublishers *= 2U)
+    {
+        registerRuntimesAndCreatePublishers(NUMBER_OF_RUNTIMES, numberOfPublishers);
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/logging.hpp"
+#include "iox/posix_shared_memory_object.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+namespace
+{
+constexpr uint64_t BYTES_PER_MEGABYTE{1024U * 1024U};
+constexpr uint64_t DEFAULT_SEGMENT_SIZE_IN_MEGABYTES{256U};
+
+/// @brief measures how long RouDi needs to create, zero and prefault a segment of the given size when the
+/// initialization is distributed over the given number of threads
+void createSegment(const uint64_t segmentSizeInBytes, const uint32_t initializationThreads)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto segment = iox::PosixSharedMemoryObjectBuilder()
+                       .name("iox-bm-segment-startup")
+                       .memorySizeInBytes(segmentSizeInBytes)
+                       .accessMode(iox::AccessMode::ReadWrite)
+                       .openMode(iox::OpenMode::PurgeAndCreate)
+                       .permissions(iox::perms::owner_all)
+                       .prefaultMemory(true)
+                       .initializationThreads(initializationThreads)
+                       .create();
+    const auto actualDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    if (segment.has_error())
+    {
+        std::cerr << "Unable to create a segment with " << segmentSizeInBytes << " bytes" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " segment size: " << std::setw(6)
+              << segmentSizeInBytes / BYTES_PER_MEGABYTE << " MiB initialization threads: " << std::setw(3)
+              << initializationThreads << " : " << std::setw(10) << static_cast<uint64_t>(actualDuration.count())
+              << " (us)" << std::endl;
+}
+} // namespace
+
+/// @brief the segment size in MiB can be passed as first argument; the default is 256 MiB
+int main(int argc, char* argv[])
+{
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    uint64_t segmentSizeInMegabytes{DEFAULT_SEGMENT_SIZE_IN_MEGABYTES};
+    if (argc > 1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) argv is provided by the OS
+        segmentSizeInMegabytes = std::stoull(argv[1]);
+    }
+
+    const uint32_t hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+    for (uint32_t initializationThreads = 1U; initializationThreads < hardwareThreads; initializationThreads *= 2U)
+    {
+        createSegment(segmentSizeInMegabytes * BYTES_PER_MEGABYTE, initializationThreads);
+    }
+    createSegment(segmentSizeInMegabytes * BYTES_PER_MEGABYTE, hardwareThreads);
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// @note the registry is filled up to its capacity of 'IOX_MAX_PUBLISHERS + IOX_MAX_SERVERS' services; to benchmark a
+/// larger system, iceoryx must be built with e.g. '-DIOX_MAX_PUBLISHERS=4096'
+constexpr uint32_t NUMBER_OF_SERVICES{iox::roudi::ServiceRegistry::CAPACITY};
+constexpr uint32_t NUMBER_OF_INSTANCES_PER_SERVICE{64U};
+
+iox::capro::IdString_t toIdString(const std::string& id)
+{
+    return iox::capro::IdString_t(iox::TruncateToCapacity, id.c_str());
+}
+
+/// @brief a registry filled like the one of a system with many publishers; the services are named 'Service<i>' and
+/// have 'NUMBER_OF_INSTANCES_PER_SERVICE' instances each
+class FilledServiceRegistry
+{
+  public:
+    static FilledServiceRegistry& instance() noexcept
+    {
+        static FilledServiceRegistry registry;
+        return registry;
+    }
+
+    /// @brief returns the service description of one of the registered services; every call returns the next one
+    const iox::capro::ServiceDescription& nextService() noexcept
+    {
+        m_serviceIndex = (m_serviceIndex + 1U) % NUMBER_OF_SERVICES;
+        return m_services[m_serviceIndex];
+    }
+
+    iox::roudi::ServiceRegistry& registry() noexcept
+    {
+        return *m_registry;
+    }
+
+  private:
+    FilledServiceRegistry() noexcept
+    {
+        for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+        {
+            m_services.emplace_back(toIdString("Service" + std::to_string(i / NUMBER_OF_INSTANCES_PER_SERVICE)),
+                                    toIdString("Instance" + std::to_string(i % NUMBER_OF_INSTANCES_PER_SERVICE)),
+                                    toIdString("Event"));
+            if (m_registry->addPublisher(m_services.back()).has_error())
+            {
+                std::abort();
+            }
+        }
+        // scramble the lookup order
+        std::reverse(m_services.begin(), m_services.end());
+    }
+
+    std::unique_ptr<iox::roudi::ServiceRegistry> m_registry{new iox::roudi::ServiceRegistry};
+    std::vector<iox::capro::ServiceDescription> m_services;
+    uint32_t m_serviceIndex{0U};
+};
+
+/// @brief the lookup of a single service like it is done for every offer and stop offer of a publisher
+uint64_t findService()
+{
+    auto& sut = FilledServiceRegistry::instance();
+    const auto& service = sut.nextService();
+    uint64_t numberOfMatches{0U};
+    sut.registry().find(service.getServiceIDString(),
+                        service.getInstanceIDString(),
+                        service.getEventIDString(),
+                        [&](const auto&) { ++numberOfMatches; });
+    return numberOfMatches;
+}
+
+/// @brief a search for all instances of a service like it is done by 'findService' with an instance wildcard
+uint64_t findAllInstancesOfService()
+{
+    auto& sut = FilledServiceRegistry::instance();
+    const auto& service = sut.nextService();
+    uint64_t numberOfMatches{0U};
+    sut.registry().find(service.getServiceIDString(), iox::nullopt, iox::nullopt, [&](const auto&) {
+        ++numberOfMatches;
+    });
+    return numberOfMatches;
+}
+
+/// @brief a second publisher of an already registered service is offered and stops the offer again
+uint64_t addAndRemovePublisher()
+{
+    auto& sut = FilledServiceRegistry::instance();
+    const auto& service = sut.nextService();
+    if (sut.registry().addPublisher(service).has_error())
+    {
+        std::abort();
+    }
+    sut.registry().removePublisher(service);
+    return 0U;
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    FilledServiceRegistry::instance();
+    std::cout << "number of registered services: " << NUMBER_OF_SERVICES << " (capacity of the service registry)"
+              << std::endl;
+
+    BENCHMARK(findService, timeout);
+    BENCHMARK(findAllInstancesOfService, timeout);
+    BENCHMARK(addAndRemovePublisher, timeout);
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t CHUNK_PAYLOAD_SIZE{32U};
+constexpr uint32_t MAX_USED_CHUNK_LIST_CAPACITY{256U};
+
+struct FreeDeleter
+{
+    void operator()(void* ptr) const noexcept
+    {
+        free(ptr);
+    }
+};
+
+/// @brief a full UsedChunkList like the one of a subscriber which holds as many samples as it is allowed to; the
+/// samples are released in a scrambled order like an application which processes them out of order does
+template <uint32_t Capacity>
+class FullUsedChunkList
+{
+  public:
+    static FullUsedChunkList& instance() noexcept
+    {
+        static FullUsedChunkList usedChunkList;
+        return usedChunkList;
+    }
+
+    iox::popo::UsedChunkList<Capacity> usedChunkList;
+    std::vector<const iox::mepoo::ChunkHeader*> chunkHeaders;
+    std::vector<uint32_t> releaseOrder;
+    uint64_t releaseIndex{0U};
+
+  private:
+    FullUsedChunkList() noexcept
+    {
+        static_assert(Capacity <= MAX_USED_CHUNK_LIST_CAPACITY, "Capacity too large");
+
+        iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, MAX_USED_CHUNK_LIST_CAPACITY});
+
+        auto managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolConfig);
+        auto chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolConfig);
+        m_managementMemory.reset(malloc(managementMemorySize));
+        m_chunkMemory.reset(malloc(chunkMemorySize));
+        iox::BumpAllocator managementAllocator(m_managementMemory.get(), managementMemorySize);
+        iox::BumpAllocator chunkMemoryAllocator(m_chunkMemory.get(), chunkMemorySize);
+        m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, chunkMemoryAllocator);
+
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+        for (uint32_t i = 0U; i < Capacity; ++i)
+        {
+            auto chunk = m_memoryManager.getChunk(chunkSettings).or_else([](auto&) { std::abort(); }).value();
+            chunkHeaders.push_back(chunk.getChunkHeader());
+            if (!usedChunkList.insert(chunk))
+            {
+                std::abort();
+            }
+            // a stride which is coprime to the power of two capacity visits every sample exactly once per cycle
+            releaseOrder.push_back((i * 7U + 3U) % Capacity);
+        }
+    }
+
+    iox::mepoo::MemoryManager m_memoryManager;
+    std::unique_ptr<void, FreeDeleter> m_managementMemory;
+    std::unique_ptr<void, FreeDeleter> m_chunkMemory;
+};
+
+/// @brief releases one sample of the full list and takes it back like a subscriber which received a new one
+template <uint32_t Capacity>
+void releaseAndReinsertSample()
+{
+    auto& sut = FullUsedChunkList<Capacity>::instance();
+    const auto chunkHeader = sut.chunkHeaders[sut.releaseOrder[sut.releaseIndex % Capacity]];
+    ++sut.releaseIndex;
+
+    iox::mepoo::SharedChunk chunk;
+    if (!sut.usedChunkList.remove(chunkHeader, chunk) || !sut.usedChunkList.insert(chunk))
+    {
+        std::abort();
+    }
+}
+
+template <uint32_t Capacity>
+void performBenchmarks(const iox::units::Duration& timeout)
+{
+    FullUsedChunkList<Capacity>::instance();
+    std::cout << "used chunk list capacity: " << Capacity << std::endl;
+    BENCHMARK(releaseAndReinsertSample<Capacity>, timeout);
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    performBenchmarks<8U>(timeout);
+    performBenchmarks<32U>(timeout);
+    performBenchmarks<128U>(timeout);
+    performBenchmarks<MAX_USED_CHUNK_LIST_CAPACITY>(timeout);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+/// @brief uses a ConditionVariableData on the heap to not depend on a running RouDi
+class BenchmarkWaitSet : public iox::popo::WaitSet<>
+{
+  public:
+    explicit BenchmarkWaitSet(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+/// @brief measures the duration of a trigger followed by 'WaitSet::wait()' which collects the notification; only one
+/// of the attached triggers is active, therefore the duration shows how the wakeup scales with the attachments
+void triggerAndWait(const uint64_t numberOfAttachments, const iox::units::Duration& duration)
+{
+    auto condVarData = std::make_unique<iox::popo::ConditionVariableData>("iox-bm-waitset");
+    auto waitSet = std::make_unique<BenchmarkWaitSet>(*condVarData);
+    std::vector<std::unique_ptr<iox::popo::UserTrigger>> triggers;
+    for (uint64_t i = 0U; i < numberOfAttachments; ++i)
+    {
+        triggers.emplace_back(std::make_unique<iox::popo::UserTrigger>());
+        waitSet->attachEvent(*triggers.back()).or_else([](auto) { std::abort(); });
+    }
+
+    auto& activeTrigger = *triggers.back();
+    uint64_t numberOfWakeups{0U};
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::milliseconds(duration.toMilliseconds());
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        activeTrigger.trigger();
+        if (waitSet->wait().size() != 1U)
+        {
+            std::abort();
+        }
+        ++numberOfWakeups;
+    }
+    const auto actualDuration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    // the triggers detach themselves from the WaitSet and must therefore be destroyed first
+    triggers.clear();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " attachments: " << std::setw(3) << numberOfAttachments << " : "
+              << std::setw(8) << static_cast<uint64_t>(actualDuration.count()) / numberOfWakeups
+              << " (ns per trigger and wait)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Off);
+
+    for (uint64_t numberOfAttachments = 1U; numberOfAttachments <= iox::MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET;
+         numberOfAttachments *= 2U)
+    {
+        triggerAndWait(numberOfAttachments, timeout);
+    }
+
+    return 0;
+}
@@ -46,6 +46,10 @@ static constexpr iox::units::Duration MIN_UPDATE_PERIOD = 500_ms;
 static constexpr iox::units::Duration DEFAULT_UPDATE_PERIOD = 1000_ms;
 static constexpr iox::units::Duration MAX_UPDATE_PERIOD = 10000_ms;
 
+/// @brief the process statistics samples contain only the changed processes and are therefore queued between two
+/// updates; the capacity is small since the chunks are taken from the limited introspection memory of RouDi
+static constexpr uint64_t PROCESS_STATISTICS_QUEUE_CAPACITY{4U};
+
 /// @brief color pairs for terminal printing
 enum class ColorPairs : uint8_t
 {
@@ -126,24 +130,30 @@ class IntrospectionApp
     /// @param[in] pr formatting options
     void prettyPrint(const std::string& str, const PrettyOptions pr = PrettyOptions::normal);
 
-    /// @brief prints active process IDs and names
+    /// @brief prints active process IDs and names together with the latest statistics of the processes
     void printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField);
 
+    /// @brief Merges a statistics sample into the cached statistics; the sample contains only the processes with
+    /// changes
+    void updateProcessStatistics(const ProcessStatisticsIntrospectionTopic* statisticsData);
+
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
-    createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
+    createSubscriber(const iox::capro::ServiceDescription& serviceDescription,
+                     const uint64_t queueCapacity = 1U) noexcept;
 
     /// @brief Waits till port is subscribed
     template <typename Subscriber>
     bool waitForSubscription(Subscriber& port);
 
+    /// @brief Merges a throughput sample into the cached throughput; the sample contains only the ports with changes
+    void updatePublisherThroughput(const PortThroughputIntrospectionFieldTopic* throughputData);
+
     /// @brief Prepares the publisher port data before printing
-    std::vector<ComposedPublisherPortData>
-    composePublisherPortData(const PortIntrospectionFieldTopic* portData,
-                             const PortThroughputIntrospectionFieldTopic* throughputData);
+    std::vector<ComposedPublisherPortData> composePublisherPortData(const PortIntrospectionFieldTopic* portData);
 
     /// @brief Prepares the subscriber port data before printing
     std::vector<ComposedSubscriberPortData>
@@ -177,6 +187,12 @@ class IntrospectionApp
 
     /// @brief first pad column to show on the ncurses window
     int32_t xPad{0};
+
+    /// @brief the latest throughput of the publisher ports, the key is the port ID
+    std::map<uint64_t, PortThroughputData> m_publisherThroughput;
+
+    /// @brief the latest statistics of the processes, the key is the PID
+    std::map<int, ProcessStatisticsData> m_processStatistics;
 };
 
 } // namespace introspection
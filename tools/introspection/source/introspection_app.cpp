@@ -29,6 +29,7 @@
 #define HAS_EXPERIMENTAL_POSH
 #endif
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <poll.h>
@@ -268,18 +269,6 @@ void IntrospectionApp::prettyPrint(const std::string& str, const PrettyOptions p
     wattroff(pad, prettyMap.find(pr)->second);
 }
 
-void IntrospectionApp::printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField)
-{
-    constexpr int32_t pidWidth{-10};
-    constexpr int32_t processWidth{-10};
-
-    for (auto& data : processIntrospectionField->m_processList)
-    {
-        wprintw(pad, "PID: %*d Process: %*s\n", pidWidth, data.m_pid, processWidth, data.m_name.c_str());
-    }
-    wprintw(pad, "\n");
-}
-
 template <typename T>
 constexpr const char* format_uint64_t() noexcept;
 template <>
@@ -296,6 +285,58 @@ constexpr const char* format_uint64_t<unsigned long long>() noexcept
 template <typename T>
 static constexpr const char* FORMAT_UINT64_T{format_uint64_t<T>()};
 
+void IntrospectionApp::printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField)
+{
+    constexpr int32_t pidWidth{-10};
+    constexpr int32_t processWidth{-10};
+    constexpr int32_t cpuUsageWidth{6};
+    constexpr int32_t cpuTimeWidth{9};
+    constexpr int32_t memoryWidth{9};
+    constexpr int32_t counterWidth{0};
+    constexpr double NANOSECONDS_PER_SECOND{1000000000.0};
+    constexpr uint64_t BYTES_PER_KIBIBYTE{1024U};
+
+    // remove the statistics of the processes which do not exist anymore
+    auto& processList = processIntrospectionField->m_processList;
+    for (auto iter = m_processStatistics.begin(); iter != m_processStatistics.end();)
+    {
+        auto isActive = std::any_of(
+            processList.begin(), processList.end(), [&](const auto& process) { return process.m_pid == iter->first; });
+        iter = isActive ? std::next(iter) : m_processStatistics.erase(iter);
+    }
+
+    for (auto& process : processList)
+    {
+        // processes which were not sampled yet are printed with empty statistics
+        const auto& data = m_processStatistics[process.m_pid];
+        const double cpuTimeInSeconds =
+            static_cast<double>(data.m_userCpuTimeInNanoseconds + data.m_systemCpuTimeInNanoseconds)
+            / NANOSECONDS_PER_SECOND;
+
+        wprintw(pad, "PID: %*d Process: %*s", pidWidth, process.m_pid, processWidth, process.m_name.c_str());
+        wprintw(pad, " CPU: %*.1f %%", cpuUsageWidth, data.m_cpuUsagePercent);
+        wprintw(pad, " CPU Time: %*.2f s", cpuTimeWidth, cpuTimeInSeconds);
+        wprintw(pad, " RSS: ");
+        wprintw(
+            pad, FORMAT_UINT64_T<uint64_t>, memoryWidth, data.m_residentSetSizeInBytes / BYTES_PER_KIBIBYTE, " KiB");
+        wprintw(pad, " Context Switches (vol/invol): ");
+        wprintw(pad, FORMAT_UINT64_T<uint64_t>, counterWidth, data.m_numberOfVoluntaryContextSwitches, "/");
+        wprintw(pad, FORMAT_UINT64_T<uint64_t>, counterWidth, data.m_numberOfInvoluntaryContextSwitches, "");
+        wprintw(pad, " Page Faults (min/maj): ");
+        wprintw(pad, FORMAT_UINT64_T<uint64_t>, counterWidth, data.m_numberOfMinorPageFaults, "/");
+        wprintw(pad, FORMAT_UINT64_T<uint64_t>, counterWidth, data.m_numberOfMajorPageFaults, "\n");
+    }
+    wprintw(pad, "\n");
+}
+
+void IntrospectionApp::updateProcessStatistics(const ProcessStatisticsIntrospectionTopic* statisticsData)
+{
+    for (const auto& statistics : statisticsData->m_processStatisticsList)
+    {
+        m_processStatistics[statistics.m_pid] = statistics;
+    }
+}
+
 void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo)
 {
     wprintw(pad, "Segment ID: %d\n", introspectionInfo.m_id);
@@ -306,7 +347,20 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(iox::into<std::string>(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
-    wprintw(pad, "\n\n");
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment page size: ");
+    wprintw(pad, FORMAT_UINT64_T<uint64_t>, 0, introspectionInfo.m_pageSize, "\n");
+
+    wprintw(pad, "Shared memory segment NUMA node: ");
+    if (introspectionInfo.m_numaNode == MemPoolIntrospectionInfo::NO_NUMA_NODE)
+    {
+        wprintw(pad, "not bound\n\n");
+    }
+    else
+    {
+        wprintw(pad, "%u\n\n", introspectionInfo.m_numaNode);
+    }
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
@@ -346,11 +400,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t instanceWidth{16};
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
@@ -363,26 +416,25 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", instanceWidth, "Instance");
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
     wprintw(pad, " %*s |", instanceWidth, "");
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
     wprintw(pad,
-            "---------------------------------------------------------------------------------------------------\n");
+            "---------------------------------------------------------------------------------------------------"
+            "-------------------------------------------------------------------\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -419,11 +471,14 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        const auto& throughputData = *publisherPort.throughputData;
+        std::string m_sampleSize{std::to_string(throughputData.m_sampleSize)};
+        std::string m_chunkSize{std::to_string(throughputData.m_chunkSize)};
+        std::stringstream m_chunksPerMinute;
+        m_chunksPerMinute << std::fixed << std::setprecision(1) << throughputData.m_chunksPerMinute;
+        std::stringstream sendInterval;
+        sendInterval << std::fixed << std::setprecision(3)
+                     << static_cast<double>(throughputData.m_lastSendIntervalInNanoseconds) / 1.0e6;
 
         currentLine = 0;
         do
@@ -443,11 +498,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad,
                     " %s |",
                     printEntry(runtimeNameWidth, iox::into<std::string>(publisherPort.portData->m_name)).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute.str()).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval.str()).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -562,10 +616,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
 template <typename Topic>
 iox::unique_ptr<iox::popo::Subscriber<Topic>>
-IntrospectionApp::createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept
+IntrospectionApp::createSubscriber(const iox::capro::ServiceDescription& serviceDescription,
+                                   const uint64_t queueCapacity) noexcept
 {
     popo::SubscriberOptions subscriberOptions;
-    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueCapacity = queueCapacity;
     subscriberOptions.historyRequest = 1U;
 
     return iox::unique_ptr<iox::popo::Subscriber<Topic>>{
@@ -587,43 +642,43 @@ bool IntrospectionApp::waitForSubscription(Subscriber& port)
     return subscribed;
 }
 
+void IntrospectionApp::updatePublisherThroughput(const PortThroughputIntrospectionFieldTopic* throughputData)
+{
+    // the rates of the ports which are missing in the sample dropped to zero
+    for (auto& throughput : m_publisherThroughput)
+    {
+        throughput.second.m_chunksPerMinute = 0;
+        throughput.second.m_lastSendIntervalInNanoseconds = 0;
+        throughput.second.m_sentBytesPerSecond = 0;
+    }
+
+    for (const auto& throughput : throughputData->m_throughputList)
+    {
+        m_publisherThroughput[throughput.m_publisherPortID] = throughput;
+    }
+}
+
 std::vector<ComposedPublisherPortData>
-IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* portData,
-                                           const PortThroughputIntrospectionFieldTopic* throughputData)
+IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* portData)
 {
     std::vector<ComposedPublisherPortData> publisherPortData;
     auto listSize = portData->m_publisherList.size();
     publisherPortData.reserve(static_cast<size_t>(listSize));
 
-    const PortThroughputData dummyThroughputData;
-
+    // remove the throughput of the ports which do not exist anymore
     auto& m_publisherList = portData->m_publisherList;
-    auto& m_throughputList = throughputData->m_throughputList;
-    const bool fastLookup = (m_publisherList.size() == m_throughputList.size());
-    for (uint64_t i = 0u; i < m_publisherList.size(); ++i)
+    for (auto iter = m_publisherThroughput.begin(); iter != m_publisherThroughput.end();)
     {
-        bool found = (fastLookup && m_publisherList[i].m_publisherPortID == m_throughputList[i].m_publisherPortID);
-        if (found)
-        {
-            publisherPortData.push_back({m_publisherList[i], m_throughputList[i]});
-            continue;
-        }
-        else
-        {
-            for (const auto& throughput : m_throughputList)
-            {
-                if (m_publisherList[i].m_publisherPortID == throughput.m_publisherPortID)
-                {
-                    publisherPortData.push_back({m_publisherList[i], throughput});
-                    found = true;
-                    break;
-                }
-            }
-            if (!found)
-            {
-                publisherPortData.push_back({m_publisherList[i], dummyThroughputData});
-            }
-        }
+        auto isActive = std::any_of(m_publisherList.begin(), m_publisherList.end(), [&](const auto& publisher) {
+            return publisher.m_publisherPortID == iter->first;
+        });
+        iter = isActive ? std::next(iter) : m_publisherThroughput.erase(iter);
+    }
+
+    for (const auto& publisher : m_publisherList)
+    {
+        // publishers which did not send anything yet are added with an empty throughput
+        publisherPortData.push_back({publisher, m_publisherThroughput[publisher.m_publisherPortID]});
     }
 
     auto publisherSortCriterion = [](const ComposedPublisherPortData& publisher1,
@@ -718,19 +773,32 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
                                  .history_request(1)
                                  .create<ProcessIntrospectionFieldTopic>()
                                  .expect("Getting subscriber for mempool topic");
+    auto processStatisticsSubscriber = node.subscriber(IntrospectionProcessStatisticsService)
+                                           .queue_capacity(PROCESS_STATISTICS_QUEUE_CAPACITY)
+                                           .history_request(1)
+                                           .create<ProcessStatisticsIntrospectionTopic>()
+                                           .expect("Getting subscriber for process statistics topic");
 #else
     auto processSubscriber = createSubscriber<ProcessIntrospectionFieldTopic>(IntrospectionProcessService);
+    auto processStatisticsSubscriber = createSubscriber<ProcessStatisticsIntrospectionTopic>(
+        IntrospectionProcessStatisticsService, PROCESS_STATISTICS_QUEUE_CAPACITY);
 #endif
 
     if (introspectionSelection.process == true)
     {
         processSubscriber->subscribe();
+        processStatisticsSubscriber->subscribe();
 
         if (waitForSubscription(processSubscriber) == false)
         {
             prettyPrint("Timeout while waiting for subscription for process introspection data!\n",
                         PrettyOptions::error);
         }
+        if (waitForSubscription(processStatisticsSubscriber) == false)
+        {
+            prettyPrint("Timeout while waiting for subscription for process statistics introspection data!\n",
+                        PrettyOptions::error);
+        }
     }
 
     // port
@@ -833,6 +901,16 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         {
             prettyPrint("### Processes ###\n\n", PrettyOptions::highlight);
             processSubscriber->take().and_then([&](auto& sample) { processSample = std::move(sample); });
+            // the statistics samples contain only the changed processes, hence all of them are merged
+            while (true)
+            {
+                auto statisticsSample = processStatisticsSubscriber->take();
+                if (!statisticsSample.has_value())
+                {
+                    break;
+                }
+                updateProcessStatistics(statisticsSample.value().get());
+            }
 
             if (processSample)
             {
@@ -849,7 +927,10 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         {
             portSubscriber->take().and_then([&](auto& sample) { portSample = std::move(sample); });
 
-            portThroughputSubscriber->take().and_then([&](auto& sample) { portThroughputSample = std::move(sample); });
+            portThroughputSubscriber->take().and_then([&](auto& sample) {
+                updatePublisherThroughput(sample.get());
+                portThroughputSample = std::move(sample);
+            });
 
             subscriberPortChangingDataSubscriber->take().and_then(
                 [&](auto& sample) { subscriberPortChangingDataSamples = std::move(sample); });
@@ -857,8 +938,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             if (portSample && portThroughputSample && subscriberPortChangingDataSamples)
             {
                 prettyPrint("### Connections ###\n\n", PrettyOptions::highlight);
-                auto composedPublisherPortData =
-                    composePublisherPortData(portSample.value().get(), portThroughputSample.value().get());
+                auto composedPublisherPortData = composePublisherPortData(portSample.value().get());
                 auto composedSubscriberPortData = composeSubscriberPortData(
                     portSample.value().get(), subscriberPortChangingDataSamples.value().get());
 
@@ -0,0 +1,161 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/log/building_blocks/binary_log_format.hpp"
+#include "iox/log/building_blocks/console_logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace iox::log;
+
+/// @brief the text of the arguments can be larger than the arguments in the record, e.g. for binary formatted numbers
+constexpr uint32_t MAX_TEXT_SIZE{4096U};
+
+void printUsage(const char* name)
+{
+    std::cout << "Usage: " << name << " [--location] <binary log file>\n"
+              << "Prints the records of a log file which was written by the iceoryx BinaryLogger as text.\n\n"
+              << "Options:\n"
+              << "  --location  prints the source file and line of each log message\n"
+              << "  --help      prints this help\n";
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    bool printLocation{false};
+    const char* logFilePath{nullptr};
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument{argv[i]};
+        if (argument == "--location")
+        {
+            printLocation = true;
+        }
+        else if (argument == "--help" || argument == "-h")
+        {
+            printUsage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if (logFilePath == nullptr)
+        {
+            logFilePath = argv[i];
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (logFilePath == nullptr)
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream logFileStream(logFilePath, std::ios::binary);
+    if (!logFileStream)
+    {
+        std::cerr << "Could not open the log file '" << logFilePath << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::vector<char> logFile{std::istreambuf_iterator<char>(logFileStream), std::istreambuf_iterator<char>()};
+
+    if (logFile.size() < sizeof(BinaryLogFileHeader))
+    {
+        std::cerr << "The file '" << logFilePath << "' is not a binary log file" << std::endl;
+        return EXIT_FAILURE;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the file starts with the file header
+    const auto& fileHeader = *reinterpret_cast<const BinaryLogFileHeader*>(logFile.data());
+    if (std::memcmp(&fileHeader.magic[0], &BINARY_LOG_MAGIC[0], sizeof(BINARY_LOG_MAGIC)) != 0)
+    {
+        std::cerr << "The file '" << logFilePath << "' is not a binary log file" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (fileHeader.version != BINARY_LOG_VERSION || fileHeader.recordAlignment != BINARY_LOG_RECORD_ALIGNMENT)
+    {
+        std::cerr << "The log file has version " << fileHeader.version << " but only version " << BINARY_LOG_VERSION
+                  << " is supported" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const uint64_t recordsEnd = std::min({fileHeader.writeOffset.load(std::memory_order_relaxed),
+                                          fileHeader.capacity,
+                                          static_cast<uint64_t>(logFile.size() - sizeof(BinaryLogFileHeader))});
+
+    const char* records = &logFile[sizeof(BinaryLogFileHeader)];
+
+    // the file name record of a source file can be written after the first message which refers to the file
+    std::map<uint32_t, std::string> fileNames;
+    const auto readFileName = [&](const BinaryLogRecordHeader& header, const char* payload, uint64_t size) {
+        if (header.type == BinaryLogRecordType::FileName)
+        {
+            fileNames[header.fileId] = std::string(payload, size);
+        }
+    };
+    forEachBinaryLogRecord(records, recordsEnd, readFileName);
+
+    constexpr uint32_t LINE_ENDING_SIZE{1};
+    constexpr uint32_t NULL_TERMINATION_SIZE{1};
+    constexpr uint32_t BUFFER_SIZE{MAX_TEXT_SIZE + NULL_TERMINATION_SIZE};
+    std::vector<char> buffer(BUFFER_SIZE + LINE_ENDING_SIZE);
+    const auto printMessage = [&](const BinaryLogRecordHeader& header, const char* payload, uint64_t size) {
+        if (header.type != BinaryLogRecordType::Message)
+        {
+            return;
+        }
+
+        timespec timestamp{0, 0};
+        timestamp.tv_sec = static_cast<decltype(timestamp.tv_sec)>(header.seconds);
+        timestamp.tv_nsec = static_cast<decltype(timestamp.tv_nsec)>(header.nanoseconds);
+        auto length = ConsoleLogger::formatLogMessageHeader(timestamp, header.logLevel, buffer.data(), BUFFER_SIZE);
+        std::cout.write(buffer.data(), length);
+
+        if (printLocation)
+        {
+            const auto fileName = fileNames.find(header.fileId);
+            std::cout << ((fileName == fileNames.end()) ? std::string("<unknown>") : fileName->second) << ":"
+                      << header.line << " ";
+        }
+
+        length = decodeBinaryLogArguments(payload, size, buffer.data(), BUFFER_SIZE);
+        buffer[length] = '\n';
+        std::cout.write(buffer.data(), length + LINE_ENDING_SIZE);
+    };
+    // records of a process which was terminated while it was writing them are skipped
+    forEachBinaryLogRecord(records, recordsEnd, printMessage);
+
+    const auto numberOfDroppedRecords = fileHeader.numberOfDroppedRecords.load(std::memory_order_relaxed);
+    if (numberOfDroppedRecords > 0U)
+    {
+        std::cerr << numberOfDroppedRecords << " log records were dropped since the log file was full" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}